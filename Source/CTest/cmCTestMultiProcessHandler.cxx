@@ -11,7 +11,6 @@
 #include <functional>
 #include <iomanip>
 #include <iostream>
-#include <list>
 #include <sstream>
 #include <stack>
 #include <unordered_map>
@@ -35,10 +34,10 @@
 #include "cmCTestBinPacker.h"
 #include "cmCTestRunTest.h"
 #include "cmCTestTestHandler.h"
+#include "cmCTestTestOrdering.h"
 #include "cmInstrumentationInterrupt.h"
 #include "cmJSONState.h"
 #include "cmListFileCache.h"
-#include "cmRange.h"
 #include "cmStringAlgorithms.h"
 #include "cmSystemTools.h"
 #include "cmUVJobServerClient.h"
@@ -973,10 +972,8 @@ void cmCTestMultiProcessHandler::CreateTestCostList()
 void cmCTestMultiProcessHandler::CreateParallelTestCostList()
 {
   TestSet alreadyOrderedTests;
-
-  std::list<TestSet> priorityStack;
-  priorityStack.emplace_back();
-  TestSet& topLevel = priorityStack.back();
+  std::set<int> topLevel;
+  cmCTestOrderingTests tests;
 
   // In parallel test runs add previously failed tests to the front
   // of the cost list and queue other tests for further sorting
@@ -988,42 +985,21 @@ void cmCTestMultiProcessHandler::CreateParallelTestCostList()
     } else {
       topLevel.insert(t.first);
     }
-  }
-
-  // In parallel test runs repeatedly move dependencies of the tests on
-  // the current dependency level to the next level until no
-  // further dependencies exist.
-  while (!priorityStack.back().empty()) {
-    TestSet& previousSet = priorityStack.back();
-    priorityStack.emplace_back();
-    TestSet& currentSet = priorityStack.back();
-
-    for (auto const& i : previousSet) {
-      TestSet const& dependencies = this->PendingTests[i].Depends;
-      currentSet.insert(dependencies.begin(), dependencies.end());
-    }
-
-    for (auto const& i : currentSet) {
-      previousSet.erase(i);
-    }
-  }
-
-  // Remove the empty dependency level
-  priorityStack.pop_back();
-
-  // Reverse iterate over the different dependency levels (deepest first).
-  // Sort tests within each level by COST and append them to the cost list.
-  for (TestSet const& currentSet : cmReverseRange(priorityStack)) {
-    TestList sortedCopy;
-    cm::append(sortedCopy, currentSet);
-    std::stable_sort(sortedCopy.begin(), sortedCopy.end(),
-                     TestComparator(this));
-
-    for (auto const& j : sortedCopy) {
-      if (!cm::contains(alreadyOrderedTests, j)) {
-        this->OrderedTests.push_back(j);
-        alreadyOrderedTests.insert(j);
-      }
+    cmCTestOrderingTest& test = tests[t.first];
+    test.Cost = this->Properties[t.first]->Cost;
+    test.Processors = this->GetProcessorsUsed(t.first);
+    test.Depends = t.second.Depends;
+  }
+
+  // Start the tests with the longest remaining chain of costs first, or
+  // order them by dependency level, deepest dependencies first.
+  std::vector<int> order =
+    this->CTest->GetScheduleType() == "CriticalPath"
+    ? cmCTestOrderTestsByCriticalPath(tests)
+    : cmCTestOrderTestsByDependencyLevel(tests, topLevel);
+  for (int j : order) {
+    if (alreadyOrderedTests.insert(j).second) {
+      this->OrderedTests.push_back(j);
     }
   }
 }
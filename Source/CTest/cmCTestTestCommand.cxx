@@ -209,6 +209,10 @@ std::unique_ptr<cmCTestGenericHandler> cmCTestTestCommand::InitializeHandler(
   if (!args.Repeat.empty()) {
     handler->Repeat = args.Repeat;
   }
+  if (!args.ScheduleCriticalPath.empty()) {
+    handler->TestOptions.ScheduleCriticalPath =
+      cmValue(args.ScheduleCriticalPath).IsOn();
+  }
   if (!args.ScheduleRandom.empty()) {
     handler->TestOptions.ScheduleRandom = cmValue(args.ScheduleRandom).IsOn();
   }
@@ -591,6 +591,9 @@ bool cmCTestTestHandler::ProcessOptions()
 {
   // Update internal data structure from generic one
   this->SetTestsToRunInformation(this->TestOptions.TestsToRunInformation);
+  if (this->TestOptions.ScheduleCriticalPath) {
+    this->CTest->SetScheduleType("CriticalPath");
+  }
   if (this->TestOptions.ScheduleRandom) {
     this->CTest->SetScheduleType("Random");
   }
@@ -33,6 +33,7 @@ struct cmCTestTestOptions
 {
   bool RerunFailed = false;
   bool OutOfDateOnly = false;
+  bool ScheduleCriticalPath = false;
   bool ScheduleRandom = false;
   bool StopOnFailure = false;
   bool UseUnion = false;
@@ -0,0 +1,146 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#include "cmCTestTestOrdering.h"
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <vector>
+
+#include <cmext/algorithm>
+
+#include "cmRange.h"
+
+namespace {
+struct CriticalPath
+{
+  double Cost = 0;
+  std::size_t Tests = 0;
+};
+
+class CriticalPathComputer
+{
+public:
+  CriticalPathComputer(cmCTestOrderingTests const& tests)
+    : Tests(tests)
+  {
+    for (auto const& t : tests) {
+      for (int d : t.second.Depends) {
+        this->Dependents[d].push_back(t.first);
+      }
+    }
+  }
+
+  CriticalPath const& Get(int test)
+  {
+    auto it = this->Paths.find(test);
+    if (it != this->Paths.end()) {
+      return it->second;
+    }
+    // The graph has no cycles, so the recursion ends.
+    CriticalPath path;
+    for (int d : this->Dependents[test]) {
+      CriticalPath const& dependent = this->Get(d);
+      if (dependent.Cost > path.Cost ||
+          (dependent.Cost == path.Cost && dependent.Tests > path.Tests)) {
+        path = dependent;
+      }
+    }
+    auto t = this->Tests.find(test);
+    if (t != this->Tests.end()) {
+      path.Cost += t->second.Cost;
+    }
+    ++path.Tests;
+    return this->Paths.emplace(test, path).first->second;
+  }
+
+private:
+  cmCTestOrderingTests const& Tests;
+  std::map<int, std::vector<int>> Dependents;
+  std::map<int, CriticalPath> Paths;
+};
+}
+
+std::vector<int> cmCTestOrderTestsByDependencyLevel(
+  cmCTestOrderingTests const& tests, std::set<int> const& roots)
+{
+  std::list<std::set<int>> priorityStack;
+  priorityStack.emplace_back(roots);
+
+  // Repeatedly move dependencies of the tests on the current dependency
+  // level to the next level until no further dependencies exist.
+  while (!priorityStack.back().empty()) {
+    std::set<int>& previousSet = priorityStack.back();
+    priorityStack.emplace_back();
+    std::set<int>& currentSet = priorityStack.back();
+
+    for (int i : previousSet) {
+      auto t = tests.find(i);
+      if (t != tests.end()) {
+        currentSet.insert(t->second.Depends.begin(), t->second.Depends.end());
+      }
+    }
+
+    for (int i : currentSet) {
+      previousSet.erase(i);
+    }
+  }
+
+  // Remove the empty dependency level
+  priorityStack.pop_back();
+
+  // Reverse iterate over the different dependency levels (deepest first).
+  // Sort tests within each level by cost and append them to the order.
+  auto cost = [&tests](int test) -> float {
+    auto t = tests.find(test);
+    return t != tests.end() ? t->second.Cost : 0;
+  };
+  std::vector<int> order;
+  std::set<int> alreadyOrderedTests;
+  for (std::set<int> const& currentSet : cmReverseRange(priorityStack)) {
+    std::vector<int> sortedCopy;
+    cm::append(sortedCopy, currentSet);
+    std::stable_sort(sortedCopy.begin(), sortedCopy.end(),
+                     [&cost](int index1, int index2) {
+                       return cost(index1) > cost(index2);
+                     });
+
+    for (int j : sortedCopy) {
+      if (alreadyOrderedTests.insert(j).second) {
+        order.push_back(j);
+      }
+    }
+  }
+  return order;
+}
+
+std::vector<int> cmCTestOrderTestsByCriticalPath(
+  cmCTestOrderingTests const& tests)
+{
+  CriticalPathComputer paths(tests);
+  std::vector<int> order;
+  order.reserve(tests.size());
+  for (auto const& t : tests) {
+    paths.Get(t.first);
+    order.push_back(t.first);
+  }
+
+  std::stable_sort(
+    order.begin(), order.end(), [&paths, &tests](int index1, int index2) {
+      CriticalPath const& p1 = paths.Get(index1);
+      CriticalPath const& p2 = paths.Get(index2);
+      if (p1.Cost != p2.Cost) {
+        return p1.Cost > p2.Cost;
+      }
+      if (p1.Tests != p2.Tests) {
+        return p1.Tests > p2.Tests;
+      }
+      cmCTestOrderingTest const& t1 = tests.at(index1);
+      cmCTestOrderingTest const& t2 = tests.at(index2);
+      if (t1.Processors != t2.Processors) {
+        return t1.Processors > t2.Processors;
+      }
+      return t1.Cost > t2.Cost;
+    });
+  return order;
+}
@@ -0,0 +1,37 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#pragma once
+
+#include "cmConfigure.h" // IWYU pragma: keep
+
+#include <cstddef>
+#include <map>
+#include <set>
+#include <vector>
+
+/** A test as seen by the orderings of a parallel test run.  */
+struct cmCTestOrderingTest
+{
+  float Cost = 0;
+  std::size_t Processors = 1;
+  std::set<int> Depends;
+};
+
+using cmCTestOrderingTests = std::map<int, cmCTestOrderingTest>;
+
+/**
+ * Order the \p roots and their dependencies by dependency level, deepest
+ * dependencies first, and by descending cost within each level.
+ */
+std::vector<int> cmCTestOrderTestsByDependencyLevel(
+  cmCTestOrderingTests const& tests, std::set<int> const& roots);
+
+/**
+ * Order the tests by descending length of their critical path, which is
+ * the longest chain of costs from a test through the tests that depend on
+ * it.  Ties go to longer chains of tests, then to tests that need more
+ * processors, then to more expensive tests.  Every test comes after its
+ * dependencies.
+ */
+std::vector<int> cmCTestOrderTestsByCriticalPath(
+  cmCTestOrderingTests const& tests);
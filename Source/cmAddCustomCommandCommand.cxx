@@ -56,6 +56,8 @@ bool cmAddCustomCommandCommand(std::vector<std::string> const& args,
   bool command_expand_lists = false;
   bool depends_explicit_only =
     mf.IsOn("CMAKE_ADD_CUSTOM_COMMAND_DEPENDS_EXPLICIT_ONLY");
+  bool preserve_unchanged_outputs =
+    mf.IsOn("CMAKE_ADD_CUSTOM_COMMAND_PRESERVE_UNCHANGED_OUTPUTS");
   bool codegen = false;
   std::string implicit_depends_lang;
   cmImplicitDependsList implicit_depends;
@@ -115,6 +117,7 @@ bool cmAddCustomCommandCommand(std::vector<std::string> const& args,
   MAKE_STATIC_KEYWORD(VERBATIM);
   MAKE_STATIC_KEYWORD(WORKING_DIRECTORY);
   MAKE_STATIC_KEYWORD(DEPENDS_EXPLICIT_ONLY);
+  MAKE_STATIC_KEYWORD(PRESERVE_UNCHANGED_OUTPUTS);
   MAKE_STATIC_KEYWORD(CODEGEN);
 #undef MAKE_STATIC_KEYWORD
   static std::unordered_set<std::string> const keywords{
@@ -141,6 +144,7 @@ bool cmAddCustomCommandCommand(std::vector<std::string> const& args,
     keyVERBATIM,
     keyWORKING_DIRECTORY,
     keyDEPENDS_EXPLICIT_ONLY,
+    keyPRESERVE_UNCHANGED_OUTPUTS,
     keyCODEGEN
   };
   /* clang-format off */
@@ -175,6 +179,7 @@ bool cmAddCustomCommandCommand(std::vector<std::string> const& args,
     keyJOB_SERVER_AWARE,
     keyMAIN_DEPENDENCY,
     keyOUTPUT,
+    keyPRESERVE_UNCHANGED_OUTPUTS,
     keyUSES_TERMINAL,
     keyVERBATIM,
     keyWORKING_DIRECTORY
@@ -241,6 +246,8 @@ bool cmAddCustomCommandCommand(std::vector<std::string> const& args,
         command_expand_lists = true;
       } else if (copy == keyDEPENDS_EXPLICIT_ONLY) {
         depends_explicit_only = true;
+      } else if (copy == keyPRESERVE_UNCHANGED_OUTPUTS) {
+        preserve_unchanged_outputs = true;
       } else if (copy == keyCODEGEN) {
         codegen = true;
       } else if (copy == keyTARGET) {
@@ -485,6 +492,7 @@ bool cmAddCustomCommandCommand(std::vector<std::string> const& args,
   cc->SetJobserverAware(cmIsOn(job_server_aware));
   cc->SetCommandExpandLists(command_expand_lists);
   cc->SetDependsExplicitOnly(depends_explicit_only);
+  cc->SetPreserveUnchangedOutputs(preserve_unchanged_outputs);
   if (source.empty() && output.empty()) {
     // Source is empty, use the target.
     if (commandLines.empty()) {
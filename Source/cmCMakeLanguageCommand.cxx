@@ -374,6 +374,22 @@ bool cmCMakeLanguageCommandGET_EXPERIMENTAL_FEATURE_ENABLED(
   return true;
 }
 
+bool cmCMakeLanguageCommandWAIT_FOR_TRY_COMPILE(
+  std::vector<cmListFileArgument> const& args, cmExecutionStatus& status)
+{
+  cmMakefile& makefile = status.GetMakefile();
+  std::vector<std::string> expandedArgs;
+  makefile.ExpandArguments(args, expandedArgs);
+
+  if (expandedArgs.size() != 1) {
+    return FatalError(
+      status, "sub-command WAIT_FOR_TRY_COMPILE does not expect arguments");
+  }
+
+  makefile.GetGlobalGenerator()->WaitForDeferredTryCompiles();
+  return true;
+}
+
 struct PrintTargetsArgs : public ArgumentParser::ParseResult
 {
   cm::optional<std::string> Regex;
@@ -964,6 +980,10 @@ bool cmCMakeLanguageCommand(std::vector<cmListFileArgument> const& args,
                                                                   status);
   }
 
+  if (expArgs[expArg] == "WAIT_FOR_TRY_COMPILE") {
+    return cmCMakeLanguageCommandWAIT_FOR_TRY_COMPILE(args, status);
+  }
+
   if (expArgs[expArg] == "PRINT_TARGETS") {
     return cmCMakeLanguageCommandPRINT_TARGETS(args, status);
   }
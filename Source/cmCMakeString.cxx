@@ -17,6 +17,8 @@
 #include "cmGeneratorExpression.h"
 #include "cmMakefile.h"
 #include "cmPolicies.h"
+#include "cmRegularExpressionCache.h"
+#include "cmState.h"
 #include "cmStringAlgorithms.h"
 #include "cmStringReplaceHelper.h"
 #include "cmSystemTools.h"
@@ -84,8 +86,11 @@ cmList CMakeString::Match(std::string const& matchExpression,
   }
 
   // Compile the regular expression.
-  cmsys::RegularExpression re;
-  if (!re.compile(matchExpression)) {
+  cmRegularExpressionCache::Lease lease = cmRegularExpressionCache::Acquire(
+    makefile ? &makefile->GetState()->GetRegularExpressionCache() : nullptr,
+    matchExpression);
+  cmsys::RegularExpression& re = *lease;
+  if (!re.is_valid()) {
     throw std::invalid_argument(
       cmStrCat("Failed to compile regex \"", matchExpression, '"'));
   }
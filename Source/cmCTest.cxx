@@ -2492,6 +2492,11 @@ int cmCTest::Run(std::vector<std::string> const& args)
                        this->Impl->TestOptions.ExcludeTestListFile = file;
                        return true;
                      } },
+    CommandArgument{ "--schedule-critical-path", CommandArgument::Values::Zero,
+                     [this](std::string const&) -> bool {
+                       this->Impl->TestOptions.ScheduleCriticalPath = true;
+                       return true;
+                     } },
     CommandArgument{ "--schedule-random", CommandArgument::Values::Zero,
                      [this](std::string const&) -> bool {
                        this->Impl->TestOptions.ScheduleRandom = true;
@@ -3,6 +3,8 @@
 #include "cmCacheManager.h"
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <sstream>
@@ -11,8 +13,10 @@
 #include "cmsys/FStream.hxx"
 #include "cmsys/Glob.hxx"
 
+#include "cmFileTime.h"
 #include "cmGeneratedFileStream.h"
 #include "cmList.h"
+#include "cmMappedFile.h"
 #include "cmMessageType.h"
 #include "cmMessenger.h"
 #include "cmState.h"
@@ -43,77 +47,18 @@ bool cmCacheManager::LoadCache(std::string const& path, bool internal,
     return false;
   }
 
-  cmsys::ifstream fin(cacheFile.c_str());
-  if (!fin) {
-    return false;
-  }
-  char const* realbuffer;
-  std::string buffer;
-  std::string entryKey;
-  unsigned int lineno = 0;
-  while (fin) {
-    // Format is key:type=value
-    std::string helpString;
-    CacheEntry e;
-    cmSystemTools::GetLineFromStream(fin, buffer);
-    lineno++;
-    realbuffer = buffer.c_str();
-    while (*realbuffer == ' ' || *realbuffer == '\t' || *realbuffer == '\r' ||
-           *realbuffer == '\n') {
-      if (*realbuffer == '\n') {
-        lineno++;
-      }
-      realbuffer++;
-    }
-    // skip blank lines and comment lines
-    if (realbuffer[0] == '#' || realbuffer[0] == 0) {
-      continue;
-    }
-    while (realbuffer[0] == '/' && realbuffer[1] == '/') {
-      if ((realbuffer[2] == '\\') && (realbuffer[3] == 'n')) {
-        helpString = cmStrCat(std::move(helpString), '\n', &realbuffer[4]);
-      } else {
-        helpString = cmStrCat(std::move(helpString), &realbuffer[2]);
-      }
-      cmSystemTools::GetLineFromStream(fin, buffer);
-      lineno++;
-      realbuffer = buffer.c_str();
-      if (!fin) {
-        continue;
-      }
-    }
-    e.SetProperty("HELPSTRING", helpString);
-    if (cmState::ParseCacheEntry(realbuffer, entryKey, e.Value, e.Type)) {
-      if (excludes.find(entryKey) == excludes.end()) {
-        // Load internal values if internal is set.
-        // If the entry is not internal to the cache being loaded
-        // or if it is in the list of internal entries to be
-        // imported, load it.
-        if (internal || (e.Type != cmStateEnums::INTERNAL) ||
-            (includes.find(entryKey) != includes.end())) {
-          // If we are loading the cache from another project,
-          // make all loaded entries internal so that it is
-          // not visible in the gui
-          if (!internal) {
-            e.Type = cmStateEnums::INTERNAL;
-            helpString = cmStrCat("DO NOT EDIT, ", entryKey,
-                                  " loaded from external file.  "
-                                  "To change this value edit this file: ",
-                                  path, "/CMakeCache.txt");
-            e.SetProperty("HELPSTRING", helpString);
-          }
-          if (!this->ReadPropertyEntry(entryKey, e)) {
-            e.Initialized = true;
-            this->Cache[entryKey] = e;
-          }
-        }
-      }
-    } else {
-      std::ostringstream error;
-      error << "Parse error in cache file " << cacheFile << " on line "
-            << lineno << ". Offending entry: " << realbuffer;
-      cmSystemTools::Error(error.str());
+  auto visit = [&](std::string const& key, cmStateEnums::CacheEntryType type,
+                   std::string const& value, std::string const& helpString) {
+    this->LoadEntry(path, internal, excludes, includes, key, type, value,
+                    helpString);
+  };
+  std::string const imageFile = cmStrCat(path, "/CMakeFiles/CMakeCache.bin");
+  if (!cmCacheManager::ReadCacheImage(cacheFile, imageFile, visit)) {
+    cmsys::ifstream fin(cacheFile.c_str());
+    if (!fin) {
+      return false;
     }
+    cmCacheManager::ReadCacheText(fin, cacheFile, true, visit);
   }
   this->CacheMajorVersion = 0;
   this->CacheMinorVersion = 0;
@@ -165,6 +110,305 @@ bool cmCacheManager::LoadCache(std::string const& path, bool internal,
   return true;
 }
 
+bool cmCacheManager::ReadCacheText(std::istream& fin,
+                                   std::string const& cacheFile,
+                                   bool reportErrors,
+                                   EntryVisitor const& visit)
+{
+  bool ok = true;
+  char const* realbuffer;
+  std::string buffer;
+  std::string entryKey;
+  std::string value;
+  cmStateEnums::CacheEntryType type;
+  unsigned int lineno = 0;
+  while (fin) {
+    // Format is key:type=value
+    std::string helpString;
+    cmSystemTools::GetLineFromStream(fin, buffer);
+    lineno++;
+    realbuffer = buffer.c_str();
+    while (*realbuffer == ' ' || *realbuffer == '\t' || *realbuffer == '\r' ||
+           *realbuffer == '\n') {
+      if (*realbuffer == '\n') {
+        lineno++;
+      }
+      realbuffer++;
+    }
+    // skip blank lines and comment lines
+    if (realbuffer[0] == '#' || realbuffer[0] == 0) {
+      continue;
+    }
+    while (realbuffer[0] == '/' && realbuffer[1] == '/') {
+      if ((realbuffer[2] == '\\') && (realbuffer[3] == 'n')) {
+        helpString = cmStrCat(std::move(helpString), '\n', &realbuffer[4]);
+      } else {
+        helpString = cmStrCat(std::move(helpString), &realbuffer[2]);
+      }
+      cmSystemTools::GetLineFromStream(fin, buffer);
+      lineno++;
+      realbuffer = buffer.c_str();
+      if (!fin) {
+        continue;
+      }
+    }
+    type = cmStateEnums::UNINITIALIZED;
+    if (cmState::ParseCacheEntry(realbuffer, entryKey, value, type)) {
+      visit(entryKey, type, value, helpString);
+    } else {
+      ok = false;
+      if (reportErrors) {
+        std::ostringstream error;
+        error << "Parse error in cache file " << cacheFile << " on line "
+              << lineno << ". Offending entry: " << realbuffer;
+        cmSystemTools::Error(error.str());
+      }
+    }
+  }
+  return ok;
+}
+
+namespace {
+// Layout of a cache image: the header, one record per entry in the order
+// of CMakeCache.txt, and the strings referenced by the records.  Images
+// are written and read only on the same host, so the native byte order
+// is used and checked with the magic number.
+char const CacheImageMagic[8] = { 'C', 'M', 'C', 'A', 'C', 'H', 'E', 0 };
+std::uint32_t const CacheImageVersion = 1;
+std::uint32_t const CacheImageByteOrder = 0x01020304;
+
+struct CacheImageHeader
+{
+  char Magic[8];
+  std::uint32_t Version;
+  std::uint32_t ByteOrder;
+  std::uint64_t TextSize;
+  std::int64_t TextTime;
+  std::uint64_t EntryCount;
+  std::uint64_t StringsSize;
+};
+
+struct CacheImageEntry
+{
+  std::uint64_t Key;
+  std::uint64_t Value;
+  std::uint64_t HelpString;
+  std::uint32_t KeySize;
+  std::uint32_t ValueSize;
+  std::uint32_t HelpStringSize;
+  std::uint32_t Type;
+};
+
+bool GetCacheTextStamp(std::string const& cacheFile, std::uint64_t& size,
+                       cmFileTime& time)
+{
+  if (!time.Load(cacheFile)) {
+    return false;
+  }
+  size = cmSystemTools::FileLength(cacheFile);
+  return true;
+}
+}
+
+bool cmCacheManager::ReadCacheImage(std::string const& cacheFile,
+                                    std::string const& imageFile,
+                                    EntryVisitor const& visit)
+{
+  std::uint64_t textSize = 0;
+  cmFileTime textTime;
+  if (!cmSystemTools::FileExists(imageFile, true) ||
+      !GetCacheTextStamp(cacheFile, textSize, textTime)) {
+    return false;
+  }
+  cmMappedFile image(imageFile);
+  char const* data = image.GetData();
+  std::size_t const size = image.GetSize();
+  if (!data || size < sizeof(CacheImageHeader)) {
+    return false;
+  }
+
+  CacheImageHeader header;
+  memcpy(&header, data, sizeof(header));
+  if (memcmp(header.Magic, CacheImageMagic, sizeof(header.Magic)) != 0 ||
+      header.Version != CacheImageVersion ||
+      header.ByteOrder != CacheImageByteOrder ||
+      header.TextSize != textSize || header.TextTime != textTime.GetTime()) {
+    return false;
+  }
+  std::size_t const available = size - sizeof(CacheImageHeader);
+  if (header.EntryCount > available / sizeof(CacheImageEntry) ||
+      header.StringsSize !=
+        available - header.EntryCount * sizeof(CacheImageEntry)) {
+    return false;
+  }
+  char const* const entries = data + sizeof(CacheImageHeader);
+  char const* const strings =
+    entries + header.EntryCount * sizeof(CacheImageEntry);
+  std::uint64_t const stringsSize = header.StringsSize;
+  auto const inStrings = [stringsSize](std::uint64_t offset,
+                                       std::uint32_t length) -> bool {
+    return offset <= stringsSize && length <= stringsSize - offset;
+  };
+
+  // Check the whole image before passing on any entry.
+  std::vector<CacheImageEntry> records(
+    static_cast<std::size_t>(header.EntryCount));
+  for (std::size_t i = 0; i < records.size(); ++i) {
+    CacheImageEntry& record = records[i];
+    memcpy(&record, entries + i * sizeof(CacheImageEntry), sizeof(record));
+    if (!inStrings(record.Key, record.KeySize) ||
+        !inStrings(record.Value, record.ValueSize) ||
+        !inStrings(record.HelpString, record.HelpStringSize) ||
+        record.Type > cmStateEnums::UNINITIALIZED) {
+      return false;
+    }
+  }
+
+  std::string key;
+  std::string value;
+  std::string helpString;
+  for (CacheImageEntry const& record : records) {
+    key.assign(strings + record.Key, record.KeySize);
+    value.assign(strings + record.Value, record.ValueSize);
+    helpString.assign(strings + record.HelpString, record.HelpStringSize);
+    visit(key, static_cast<cmStateEnums::CacheEntryType>(record.Type), value,
+          helpString);
+  }
+  return true;
+}
+
+void cmCacheManager::WriteCacheImage(std::string const& cacheFile,
+                                     std::string const& imageFile,
+                                     std::string const& checkCacheFile)
+{
+  CacheImageHeader header;
+  memcpy(header.Magic, CacheImageMagic, sizeof(header.Magic));
+  header.Version = CacheImageVersion;
+  header.ByteOrder = CacheImageByteOrder;
+  cmFileTime textTime;
+  cmFileTime checkTime;
+  if (!GetCacheTextStamp(cacheFile, header.TextSize, textTime) ||
+      !checkTime.Load(checkCacheFile)) {
+    cmSystemTools::RemoveFile(imageFile);
+    return;
+  }
+  header.TextTime = textTime.GetTime();
+
+  // The image is valid only as long as the size and time of the text file
+  // do not change.  If the text file was modified within the timestamp
+  // resolution of the file system, it may still be modified again without
+  // changing its time, so leave it to a later run to write the image.
+  if (!textTime.Older(checkTime)) {
+    cmSystemTools::RemoveFile(imageFile);
+    return;
+  }
+  if (ReadCacheImage(cacheFile, imageFile,
+                     [](std::string const&, cmStateEnums::CacheEntryType,
+                        std::string const&, std::string const&) {})) {
+    return;
+  }
+
+  std::vector<CacheImageEntry> records;
+  std::string strings;
+  auto append = [&strings](std::string const& s, std::uint64_t& offset,
+                           std::uint32_t& size) {
+    offset = strings.size();
+    size = static_cast<std::uint32_t>(s.size());
+    strings += s;
+  };
+  bool tooLarge = false;
+  cmsys::ifstream fin(cacheFile.c_str());
+  bool const parsed = fin &&
+    ReadCacheText(fin, cacheFile, false,
+                  [&](std::string const& key,
+                      cmStateEnums::CacheEntryType type,
+                      std::string const& value,
+                      std::string const& helpString) {
+                    if (key.size() > UINT32_MAX || value.size() > UINT32_MAX ||
+                        helpString.size() > UINT32_MAX) {
+                      tooLarge = true;
+                      return;
+                    }
+                    records.emplace_back();
+                    CacheImageEntry& record = records.back();
+                    append(key, record.Key, record.KeySize);
+                    append(value, record.Value, record.ValueSize);
+                    append(helpString, record.HelpString,
+                           record.HelpStringSize);
+                    record.Type = static_cast<std::uint32_t>(type);
+                  });
+  fin.close();
+  if (!parsed || tooLarge) {
+    // Leave entries that cannot be parsed to the text parser to report.
+    cmSystemTools::RemoveFile(imageFile);
+    return;
+  }
+  header.EntryCount = records.size();
+  header.StringsSize = strings.size();
+
+  std::string const tempFile = cmStrCat(imageFile, ".tmp");
+  {
+    cmsys::ofstream fout(tempFile.c_str(), std::ios::out | std::ios::binary);
+    fout.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    if (!records.empty()) {
+      fout.write(reinterpret_cast<char const*>(records.data()),
+                 static_cast<std::streamsize>(records.size() *
+                                              sizeof(CacheImageEntry)));
+    }
+    fout.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+    if (!fout) {
+      fout.close();
+      cmSystemTools::RemoveFile(tempFile);
+      cmSystemTools::RemoveFile(imageFile);
+      return;
+    }
+  }
+  if (!cmSystemTools::RenameFile(tempFile, imageFile)) {
+    cmSystemTools::RemoveFile(tempFile);
+    cmSystemTools::RemoveFile(imageFile);
+  }
+}
+
+void cmCacheManager::LoadEntry(std::string const& path, bool internal,
+                               std::set<std::string> const& excludes,
+                               std::set<std::string> const& includes,
+                               std::string const& key,
+                               cmStateEnums::CacheEntryType type,
+                               std::string const& value,
+                               std::string const& helpString)
+{
+  if (excludes.find(key) != excludes.end()) {
+    return;
+  }
+  // Load internal values if internal is set.
+  // If the entry is not internal to the cache being loaded
+  // or if it is in the list of internal entries to be
+  // imported, load it.
+  if (!internal && type == cmStateEnums::INTERNAL &&
+      includes.find(key) == includes.end()) {
+    return;
+  }
+  CacheEntry e;
+  e.Value = value;
+  e.Type = type;
+  e.SetProperty("HELPSTRING", helpString);
+  // If we are loading the cache from another project,
+  // make all loaded entries internal so that it is
+  // not visible in the gui
+  if (!internal) {
+    e.Type = cmStateEnums::INTERNAL;
+    e.SetProperty("HELPSTRING",
+                  cmStrCat("DO NOT EDIT, ", key,
+                           " loaded from external file.  "
+                           "To change this value edit this file: ",
+                           path, "/CMakeCache.txt"));
+  }
+  if (!this->ReadPropertyEntry(key, e)) {
+    e.Initialized = true;
+    this->Cache[key] = std::move(e);
+  }
+}
+
 char const* cmCacheManager::PersistentProperties[] = { "ADVANCED", "MODIFIED",
                                                        "STRINGS" };
 
@@ -352,6 +596,14 @@ bool cmCacheManager::SaveCache(std::string const& path, cmMessenger* messenger)
   }
   checkCache << "# This file is generated by cmake for dependency checking "
                 "of the CMakeCache.txt file\n";
+  checkCache.close();
+
+  std::string const imageFile = cmStrCat(path, "/CMakeFiles/CMakeCache.bin");
+  if (this->GetInitializedCacheValue("CMAKE_CACHE_IMAGE").IsOn()) {
+    cmCacheManager::WriteCacheImage(cacheFile, imageFile, checkCacheFile);
+  } else if (cmSystemTools::FileExists(imageFile, true)) {
+    cmSystemTools::RemoveFile(imageFile);
+  }
   return true;
 }
 
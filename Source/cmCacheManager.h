@@ -4,6 +4,7 @@
 
 #include "cmConfigure.h" // IWYU pragma: keep
 
+#include <functional>
 #include <iosfwd>
 #include <map>
 #include <set>
@@ -22,6 +23,10 @@ class cmMessenger;
  *
  * Load and Save CMake cache files.
  *
+ * If CMAKE_CACHE_IMAGE is enabled, SaveCache also writes the entries of
+ * CMakeCache.txt to a binary image in the CMakeFiles directory.  The image
+ * records the size and modification time of the text file, and LoadCache
+ * reads it instead of parsing the text only as long as both still match.
  */
 class cmCacheManager
 {
@@ -213,6 +218,30 @@ private:
   static void OutputValueNoNewlines(std::ostream& fout,
                                     std::string const& value);
 
+  using EntryVisitor = std::function<void(
+    std::string const& key, cmStateEnums::CacheEntryType type,
+    std::string const& value, std::string const& helpString)>;
+
+  //! Parse the entries of a CMakeCache.txt file.  Returns false on errors.
+  static bool ReadCacheText(std::istream& fin, std::string const& cacheFile,
+                            bool reportErrors, EntryVisitor const& visit);
+
+  //! Read the entries of a cache image if it matches the text file.
+  static bool ReadCacheImage(std::string const& cacheFile,
+                             std::string const& imageFile,
+                             EntryVisitor const& visit);
+
+  //! Write a cache image for the text file unless an up to date one exists.
+  static void WriteCacheImage(std::string const& cacheFile,
+                              std::string const& imageFile,
+                              std::string const& checkCacheFile);
+
+  void LoadEntry(std::string const& path, bool internal,
+                 std::set<std::string> const& excludes,
+                 std::set<std::string> const& includes,
+                 std::string const& key, cmStateEnums::CacheEntryType type,
+                 std::string const& value, std::string const& helpString);
+
   static char const* PersistentProperties[];
   bool ReadPropertyEntry(std::string const& key, CacheEntry const& e);
   void WritePropertyEntries(std::ostream& os, std::string const& entryKey,
@@ -0,0 +1,255 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#include "cmCommandHelperServer.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include <cm/optional>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <sys/file.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+
+#include "cmStdIoConsole.h"
+#include "cmcmd.h"
+
+extern char** environ;
+
+namespace {
+
+// Exit after this long without a connection.
+int const IdleTimeoutMilliseconds = 60 * 1000;
+
+bool ReadAll(int fd, char* data, std::size_t size)
+{
+  while (size > 0) {
+    ssize_t n = read(fd, data, size);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      return false;
+    }
+    data += n;
+    size -= static_cast<std::size_t>(n);
+  }
+  return true;
+}
+
+void Reply(int fd, char tag, std::int32_t const* code = nullptr)
+{
+  char reply[1 + sizeof(std::int32_t)] = { tag };
+  std::size_t size = 1;
+  if (code) {
+    memcpy(reply + 1, code, sizeof(*code));
+    size += sizeof(*code);
+  }
+  ssize_t n;
+  do {
+    n = write(fd, reply, size);
+  } while (n < 0 && errno == EINTR);
+}
+
+// Receive one request and run it.  Runs in a process forked for the
+// connection, which exits afterwards.
+void Serve(int conn, std::string const& cmake)
+{
+  std::uint32_t size = 0;
+  int fds[3] = { -1, -1, -1 };
+  char control[CMSG_SPACE(sizeof(fds))];
+  iovec iov;
+  iov.iov_base = &size;
+  iov.iov_len = sizeof(size);
+  msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+  ssize_t n;
+  do {
+    n = recvmsg(conn, &msg, 0);
+  } while (n < 0 && errno == EINTR);
+  cmsghdr* cmsg = n == static_cast<ssize_t>(sizeof(size))
+    ? CMSG_FIRSTHDR(&msg)
+    : nullptr;
+  if (!cmsg || cmsg->cmsg_level != SOL_SOCKET ||
+      cmsg->cmsg_type != SCM_RIGHTS ||
+      cmsg->cmsg_len != CMSG_LEN(sizeof(fds))) {
+    return;
+  }
+  memcpy(fds, CMSG_DATA(cmsg), sizeof(fds));
+
+  std::string payload(size, '\0');
+  if (size == 0 || !ReadAll(conn, &payload[0], size) ||
+      payload.back() != '\0') {
+    Reply(conn, cmCommandHelper::ReplyDeclined);
+    return;
+  }
+  std::vector<char*> fields;
+  for (std::size_t pos = 0; pos < payload.size();
+       pos = payload.find('\0', pos) + 1) {
+    fields.push_back(&payload[pos]);
+  }
+  unsigned long argc = 0;
+  if (fields.size() < 2 ||
+      (argc = strtoul(fields[1], nullptr, 10)) == 0 ||
+      argc > fields.size() - 2 || !cmCommandHelper::IsServed(fields[2]) ||
+      chdir(fields[0]) != 0) {
+    Reply(conn, cmCommandHelper::ReplyDeclined);
+    return;
+  }
+
+  // Take over the environment and streams of the client.
+  std::vector<std::string> args;
+  args.reserve(argc + 1);
+  args.emplace_back(cmake);
+  for (unsigned long i = 0; i < argc; ++i) {
+    args.emplace_back(fields[2 + i]);
+  }
+  std::vector<char*> env(fields.begin() + 2 + argc, fields.end());
+  env.push_back(nullptr);
+  environ = env.data();
+  for (int i = 0; i < 3; ++i) {
+    dup2(fds[i], i);
+    close(fds[i]);
+  }
+
+  // Let the build tool stop the command by stopping the client.
+  setpgid(0, 0);
+#if defined(F_SETOWN) && defined(O_ASYNC)
+  fcntl(conn, F_SETOWN, -getpid());
+  fcntl(conn, F_SETFL, fcntl(conn, F_GETFL) | O_ASYNC);
+#endif
+
+  Reply(conn, cmCommandHelper::ReplyAccepted);
+  std::int32_t const code =
+    cmcmd::ExecuteCMakeCommand(args, cm::StdIo::Console());
+  std::cout.flush();
+  std::cerr.flush();
+  fflush(nullptr);
+  // The exit code follows the tag sent above.
+  do {
+    n = write(conn, &code, sizeof(code));
+  } while (n < 0 && errno == EINTR);
+}
+
+void Accept(int server, std::string const& cmake, std::size_t& children)
+{
+  int conn;
+  do {
+    conn = accept(server, nullptr, nullptr);
+  } while (conn < 0 && errno == EINTR);
+  if (conn < 0) {
+    return;
+  }
+  pid_t pid = fork();
+  if (pid == 0) {
+    close(server);
+    Serve(conn, cmake);
+    _exit(0);
+  }
+  if (pid > 0) {
+    ++children;
+  }
+  close(conn);
+}
+
+void Reap(std::size_t& children)
+{
+  while (children > 0 && waitpid(-1, nullptr, WNOHANG) > 0) {
+    --children;
+  }
+}
+}
+
+namespace cmCommandHelper {
+
+bool IsServed(std::string const& command)
+{
+  return command == "cmake_echo_color" ||
+    command == "cmake_progress_report" || command == "cmake_ninja_dyndep" ||
+    command == "cmake_transform_depfile" ||
+    command == "cmake_preserve_unchanged_outputs" ||
+    command == "__run_co_compile";
+}
+
+int RunServer(std::vector<std::string> const& args)
+{
+  if (args.size() != 3) {
+    std::cerr << "-E " << ServerCommand << " requires a socket path\n";
+    return 1;
+  }
+  std::string const& path = args[2];
+  sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (path.size() >= sizeof(addr.sun_path)) {
+    return 1;
+  }
+  memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+
+  // Only one server may use the socket.  The lock is held until the
+  // socket is gone again.
+  std::string const lockPath = path + ".lock";
+  int lock = open(lockPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+  if (lock < 0 || flock(lock, LOCK_EX | LOCK_NB) != 0) {
+    return 0;
+  }
+  unlink(path.c_str());
+  int server = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (server < 0 ||
+      bind(server, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+      listen(server, 128) != 0) {
+    return 1;
+  }
+  fcntl(server, F_SETFD, FD_CLOEXEC);
+
+  std::size_t children = 0;
+  for (;;) {
+    pollfd pfd;
+    pfd.fd = server;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    int ready = poll(&pfd, 1, children > 0 ? 1000 : IdleTimeoutMilliseconds);
+    Reap(children);
+    if (ready > 0) {
+      Accept(server, args[0], children);
+    } else if (ready == 0 && children == 0) {
+      break;
+    } else if (ready < 0 && errno != EINTR) {
+      break;
+    }
+  }
+
+  // Stop new clients from connecting, then serve those that already did.
+  unlink(path.c_str());
+  fcntl(server, F_SETFL, fcntl(server, F_GETFL) | O_NONBLOCK);
+  for (;;) {
+    pollfd pfd;
+    pfd.fd = server;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    if (poll(&pfd, 1, 0) <= 0) {
+      break;
+    }
+    Accept(server, args[0], children);
+  }
+  close(server);
+  while (children > 0 && waitpid(-1, nullptr, 0) > 0) {
+    --children;
+  }
+  close(lock);
+  return 0;
+}
+}
@@ -0,0 +1,40 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#pragma once
+
+#include "cmConfigure.h" // IWYU pragma: keep
+
+#include <string>
+#include <vector>
+
+/** \namespace cmCommandHelper
+ * \brief Run "cmake -E" commands of build edges in a long-lived process.
+ *
+ * The cmcmdhelper client connects to a server listening on a local
+ * socket and sends it, in one message, a 32-bit payload size and its
+ * standard input, output and error.  The payload holds the working
+ * directory, the number of arguments, the arguments after "-E", and the
+ * environment, each terminated by a null character.
+ *
+ * The server forks a process for each connection, which answers with
+ * ReplyDeclined if it does not run the command, or with ReplyAccepted
+ * once it runs the command with the client's streams, working directory
+ * and environment.  After ReplyAccepted, it sends the 32-bit exit code
+ * of the command.  The process runs in a process group of its own that
+ * receives SIGIO when the client goes away, so interrupting the client
+ * also stops the command.
+ */
+namespace cmCommandHelper {
+
+/** The hidden "cmake -E" command that runs the server.  */
+char const* const ServerCommand = "__command_helper_server";
+
+char const ReplyDeclined = 'D';
+char const ReplyAccepted = 'A';
+
+/** Whether the server runs the given "cmake -E" command.  */
+bool IsServed(std::string const& command);
+
+/** Run the server on the socket given by args[2] until it is idle.  */
+int RunServer(std::vector<std::string> const& args);
+}
@@ -440,6 +440,18 @@ std::string cmCommonTargetGenerator::GetCompilerLauncher(
   return compilerLauncher;
 }
 
+std::string cmCommonTargetGenerator::GetCommandHelperCMakeCommand(
+  std::string cmakeCmd) const
+{
+  std::string const& helper = this->GlobalCommonGenerator->GetCommandHelper();
+  if (helper.empty()) {
+    return cmakeCmd;
+  }
+  return cmStrCat(this->LocalCommonGenerator->ConvertToOutputFormat(
+                    helper, cmOutputConverter::SHELL),
+                  ' ', cmakeCmd);
+}
+
 std::string cmCommonTargetGenerator::GenerateCodeCheckRules(
   cmSourceFile const& source, std::string& compilerLauncher,
   std::string const& cmakeCmd, std::string const& config,
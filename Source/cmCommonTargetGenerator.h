@@ -75,6 +75,9 @@ protected:
   std::string GetCompilerLauncher(std::string const& lang,
                                   std::string const& config);
 
+  // Prefix a cmake command for "cmake -E" with the command helper.
+  std::string GetCommandHelperCMakeCommand(std::string cmakeCmd) const;
+
   struct LinkedTargetDirs
   {
     std::vector<std::string> Direct;
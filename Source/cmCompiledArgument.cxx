@@ -0,0 +1,220 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#include "cmCompiledArgument.h"
+
+#include <cstddef>
+#include <utility>
+
+#include <cmext/string_view>
+
+#include "cmsys/String.h"
+
+#include "cmList.h"
+#include "cmListFileCache.h"
+#include "cmMakefile.h"
+#include "cmState.h"
+#include "cmStringAlgorithms.h"
+#include "cmSystemTools.h"
+#include "cmValue.h"
+
+namespace {
+bool IsVariableNameChar(char c)
+{
+  return cmsysString_isalnum(c) || c == '_' || c == '/' || c == '.' ||
+    c == '+' || c == '-';
+}
+
+// Match "^[A-Za-z0-9/_.+-]+{", which names an unsupported "$name{}" syntax.
+bool IsNamedCurly(cm::string_view text)
+{
+  std::size_t i = 0;
+  while (i < text.size() && IsVariableNameChar(text[i])) {
+    ++i;
+  }
+  return i > 0 && i < text.size() && text[i] == '{';
+}
+}
+
+// The tokenizer below mirrors cmMakefile::ExpandVariablesInStringImpl for
+// command arguments, i.e., without @VAR@ replacement and with escape
+// sequences enabled.  Any input that would make that function report an
+// error leaves the argument unsupported.
+std::shared_ptr<cmCompiledArgument const> cmCompiledArgument::Compile(
+  cm::string_view value)
+{
+  auto compiled = std::make_shared<cmCompiledArgument>();
+
+  struct OpenReference
+  {
+    PieceType Type;
+    std::vector<Piece> Name;
+  };
+  std::vector<OpenReference> open;
+  std::vector<Piece> top;
+  std::string literal;
+  long newlines = 0;
+
+  auto current = [&]() -> std::vector<Piece>& {
+    return open.empty() ? top : open.back().Name;
+  };
+  auto flush = [&]() {
+    if (!literal.empty()) {
+      Piece piece;
+      piece.Text = std::move(literal);
+      literal.clear();
+      current().push_back(std::move(piece));
+    }
+  };
+  auto openReference = [&](PieceType type) {
+    flush();
+    open.push_back({ type, {} });
+  };
+
+  std::size_t const n = value.size();
+  for (std::size_t i = 0; i < n; ++i) {
+    char const c = value[i];
+    char const next = i + 1 < n ? value[i + 1] : '\0';
+    switch (c) {
+      case '\0':
+        // The string-based expansion stops at an embedded null.
+        return compiled;
+      case '}':
+        if (open.empty()) {
+          literal += c;
+        } else {
+          flush();
+          Piece piece;
+          piece.Type = open.back().Type;
+          piece.Name = std::move(open.back().Name);
+          piece.LineOffset = newlines;
+          open.pop_back();
+          current().push_back(std::move(piece));
+        }
+        break;
+      case '$': {
+        cm::string_view const rest = value.substr(i + 1);
+        if (next == '{') {
+          openReference(PieceType::Variable);
+          i += 1;
+        } else if (next == '<' || next == '\0') {
+          literal += c;
+        } else if (cmHasLiteralPrefix(rest, "ENV{")) {
+          openReference(PieceType::EnvironmentVariable);
+          i += 4;
+        } else if (cmHasLiteralPrefix(rest, "CACHE{")) {
+          openReference(PieceType::CacheVariable);
+          i += 6;
+        } else if (IsNamedCurly(rest)) {
+          return compiled;
+        } else {
+          literal += c;
+        }
+      } break;
+      case '\\':
+        if (next == 't') {
+          literal += '\t';
+        } else if (next == 'n') {
+          literal += '\n';
+        } else if (next == 'r') {
+          literal += '\r';
+        } else if (next == ';' && open.empty()) {
+          // Handled when the argument is split as a list.
+          literal += "\\;";
+        } else if (cmsysString_isalnum(next) || next == '\0') {
+          return compiled;
+        } else {
+          literal += next;
+        }
+        ++i;
+        break;
+      case '\n':
+        ++newlines;
+        literal += c;
+        break;
+      default:
+        if (!open.empty() && !IsVariableNameChar(c)) {
+          return compiled;
+        }
+        literal += c;
+        break;
+    }
+  }
+  if (!open.empty()) {
+    return compiled;
+  }
+  flush();
+
+  compiled->Supported = true;
+  if (top.empty() ||
+      (top.size() == 1 && top.front().Type == PieceType::Literal)) {
+    compiled->Literal = true;
+    if (!top.empty()) {
+      compiled->LiteralValue = std::move(top.front().Text);
+    }
+    cmExpandList(compiled->LiteralValue, compiled->LiteralList);
+  } else {
+    compiled->Pieces = std::move(top);
+  }
+  return compiled;
+}
+
+void cmCompiledArgument::Expand(cmMakefile const& mf, char const* filename,
+                                long line, std::string& out) const
+{
+  if (this->Literal) {
+    out += this->LiteralValue;
+    return;
+  }
+  cmCompiledArgument::ExpandPieces(this->Pieces, mf, filename, line, out);
+}
+
+void cmCompiledArgument::ExpandPieces(std::vector<Piece> const& pieces,
+                                      cmMakefile const& mf,
+                                      char const* filename, long line,
+                                      std::string& out)
+{
+  static std::string const lineVar = "CMAKE_CURRENT_LIST_LINE";
+  for (Piece const& piece : pieces) {
+    if (piece.Type == PieceType::Literal) {
+      out += piece.Text;
+      continue;
+    }
+
+    std::string lookup;
+    cmCompiledArgument::ExpandPieces(piece.Name, mf, filename, line, lookup);
+
+    cmValue value = nullptr;
+    std::string varresult;
+    std::string svalue;
+    switch (piece.Type) {
+      case PieceType::Variable:
+        if (filename && lookup == lineVar) {
+          cmListFileContext const& top = mf.GetBacktrace().Top();
+          if (top.DeferId) {
+            varresult = cmStrCat("DEFERRED:"_s, *top.DeferId);
+          } else {
+            varresult = std::to_string(line + piece.LineOffset);
+          }
+        } else {
+          value = mf.GetDefinition(lookup);
+        }
+        break;
+      case PieceType::EnvironmentVariable:
+        if (cmSystemTools::GetEnv(lookup, svalue)) {
+          value = cmValue(svalue);
+        }
+        break;
+      case PieceType::CacheVariable:
+        value = mf.GetState()->GetCacheEntryValue(lookup);
+        break;
+      case PieceType::Literal:
+        break;
+    }
+    if (value) {
+      out += *value;
+    } else {
+      mf.MaybeWarnUninitialized(lookup, filename);
+      out += varresult;
+    }
+  }
+}
@@ -0,0 +1,84 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#pragma once
+
+#include "cmConfigure.h" // IWYU pragma: keep
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cm/string_view>
+
+class cmMakefile;
+
+/** \class cmCompiledArgument
+ * \brief Pre-tokenized form of a quoted or unquoted list file argument.
+ *
+ * cmMakefile::ExpandArguments expands variable references in command
+ * arguments every time a command is invoked.  A cmCompiledArgument is
+ * computed once per argument and splits its value into literal pieces
+ * and (possibly nested) variable references, so that repeated calls of
+ * a function body or loop body do not scan the argument text again.
+ *
+ * Values whose expansion would report an error, such as invalid escape
+ * sequences or unterminated variable references, are not compiled.
+ * They are expanded by cmMakefile::ExpandVariablesInString as before,
+ * so that diagnostics do not change.
+ */
+class cmCompiledArgument
+{
+public:
+  static std::shared_ptr<cmCompiledArgument const> Compile(
+    cm::string_view value);
+
+  /** Whether the argument could be compiled.  */
+  bool IsSupported() const { return this->Supported; }
+
+  /** Whether the argument contains no variable references.  */
+  bool IsLiteral() const { return this->Literal; }
+
+  /** The expanded value of a literal argument.  */
+  std::string const& GetLiteral() const { return this->LiteralValue; }
+
+  /** The elements of a literal argument when split as a list.  */
+  std::vector<std::string> const& GetLiteralList() const
+  {
+    return this->LiteralList;
+  }
+
+  /** Append the expanded value of the argument to the output.  */
+  void Expand(cmMakefile const& mf, char const* filename, long line,
+              std::string& out) const;
+
+private:
+  enum class PieceType
+  {
+    Literal,
+    Variable,
+    EnvironmentVariable,
+    CacheVariable,
+  };
+
+  struct Piece
+  {
+    PieceType Type = PieceType::Literal;
+    // The text of a literal piece.
+    std::string Text;
+    // The pieces forming the name of a variable reference.
+    std::vector<Piece> Name;
+    // The number of newlines preceding the closing brace of a variable
+    // reference, for the value of CMAKE_CURRENT_LIST_LINE.
+    long LineOffset = 0;
+  };
+
+  static void ExpandPieces(std::vector<Piece> const& pieces,
+                           cmMakefile const& mf, char const* filename,
+                           long line, std::string& out);
+
+  std::vector<Piece> Pieces;
+  std::string LiteralValue;
+  std::vector<std::string> LiteralList;
+  bool Supported = false;
+  bool Literal = false;
+};
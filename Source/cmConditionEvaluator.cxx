@@ -23,6 +23,7 @@
 #include "cmList.h"
 #include "cmMakefile.h"
 #include "cmMessageType.h"
+#include "cmRegularExpressionCache.h"
 #include "cmState.h"
 #include "cmStringAlgorithms.h"
 #include "cmSystemTools.h"
@@ -574,8 +575,9 @@ bool cmConditionEvaluator::HandleLevel2(cmArgumentList& newArgs,
       this->Makefile.ClearMatches();
 
       auto const& rex = args.nextnext->GetValue();
-      cmsys::RegularExpression regEntry;
-      if (!regEntry.compile(rex)) {
+      cmRegularExpressionCache::Lease regEntry =
+        this->Makefile.GetState()->GetRegularExpressionCache().Acquire(rex);
+      if (!regEntry->is_valid()) {
         std::ostringstream error;
         error << "Regular expression \"" << rex << "\" cannot compile";
         errorString = error.str();
@@ -583,9 +585,9 @@ bool cmConditionEvaluator::HandleLevel2(cmArgumentList& newArgs,
         return false;
       }
 
-      auto const match = regEntry.find(*def);
+      auto const match = regEntry->find(*def);
       if (match) {
-        this->Makefile.StoreMatches(regEntry);
+        this->Makefile.StoreMatches(*regEntry);
       }
       newArgs.ReduceTwoArgs(match, args);
     }
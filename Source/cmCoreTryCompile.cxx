@@ -5,10 +5,12 @@
 #include <array>
 #include <cstdio>
 #include <functional>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <utility>
 
+#include <cm/memory>
 #include <cm/string_view>
 #include <cmext/string_view>
 
@@ -121,8 +123,10 @@ ArgumentParser::Continue TryCompileCompileDefs(Arguments& args,
 cmArgumentParser<Arguments> makeTryCompileParser(
   cmArgumentParser<Arguments> const& base)
 {
-  return cmArgumentParser<Arguments>{ base }.Bind("OUTPUT_VARIABLE"_s,
-                                                  &Arguments::OutputVariable);
+  return cmArgumentParser<Arguments>{ base }
+    .Bind("OUTPUT_VARIABLE"_s, &Arguments::OutputVariable)
+    .Bind("DEFER"_s, &Arguments::Defer)
+    /* keep semicolon on own line */;
 }
 
 cmArgumentParser<Arguments> makeTryRunParser(
@@ -315,6 +319,24 @@ Arguments cmCoreTryCompile::ParseArgs(
 
 cm::optional<cmTryCompileResult> cmCoreTryCompile::TryCompileCode(
   Arguments& arguments, cm::TargetType targetType)
+{
+  return this->TryCompileCode(arguments, targetType, nullptr);
+}
+
+void cmCoreTryCompile::DeferTryCompileCode(Arguments& arguments,
+                                           cm::TargetType targetType,
+                                           FinishCallback finish)
+{
+  cm::optional<cmTryCompileResult> result =
+    this->TryCompileCode(arguments, targetType, &finish);
+  // The callback has been queued if the build was deferred.
+  if (finish) {
+    finish(*this, arguments, result);
+  }
+}
+
+cm::optional<cmTryCompileResult> cmCoreTryCompile::TryCompileCode(
+  Arguments& arguments, cm::TargetType targetType, FinishCallback* finish)
 {
   this->OutputFile.clear();
   // which signature were we called with ?
@@ -371,6 +393,11 @@ cm::optional<cmTryCompileResult> cmCoreTryCompile::TryCompileCode(
     if (this->SrcFileSignature) {
       this->BinaryDirectory += "/CMakeFiles/CMakeTmp";
     }
+    // A deferred test project may still wait to be built there.
+    cmGlobalGenerator* gg = this->Makefile->GetGlobalGenerator();
+    if (gg->IsTryCompileDeferred(this->BinaryDirectory)) {
+      gg->WaitForDeferredTryCompiles();
+    }
   }
 
   std::vector<std::string> targets;
@@ -1247,6 +1274,10 @@ cm::optional<cmTryCompileResult> cmCoreTryCompile::TryCompileCode(
     this->Makefile->IssueMessage(MessageType::LOG, msg);
   }
 
+  std::unique_ptr<cmDeferredTryCompile> deferred;
+  if (finish) {
+    deferred = cm::make_unique<cmDeferredTryCompile>();
+  }
   bool erroroc = cmSystemTools::GetErrorOccurredFlag();
   cmSystemTools::ResetErrorOccurredFlag();
   std::string output;
@@ -1254,11 +1285,40 @@ cm::optional<cmTryCompileResult> cmCoreTryCompile::TryCompileCode(
   int res = this->Makefile->TryCompile(
     sourceDirectory, this->BinaryDirectory, projectName, targetName,
     this->SrcFileSignature, cmake::NO_BUILD_PARALLEL_LEVEL,
-    &arguments.CMakeFlags, output);
+    &arguments.CMakeFlags, output, deferred.get());
   if (erroroc) {
     cmSystemTools::SetErrorOccurred();
   }
 
+  // The build commands are missing if the test project could not be
+  // generated, or if the build cannot be deferred.
+  if (deferred && !deferred->Commands.empty()) {
+    cmCoreTryCompile tc = *this;
+    Arguments args = arguments;
+    FinishCallback callback = std::move(*finish);
+    *finish = nullptr;
+    deferred->Finish = [tc, args, callback, sourceDirectory, targetName,
+                        cmakeVariables](
+                         cmDeferredTryCompile const& built) mutable {
+      cm::optional<cmTryCompileResult> result = tc.FinishTryCompileCode(
+        args, built.Result, built.Output, sourceDirectory, targetName,
+        std::move(cmakeVariables));
+      callback(tc, args, result);
+    };
+    this->Makefile->GetGlobalGenerator()->DeferTryCompile(std::move(deferred));
+    return cm::nullopt;
+  }
+
+  return this->FinishTryCompileCode(arguments, res, std::move(output),
+                                    sourceDirectory, targetName,
+                                    std::move(cmakeVariables));
+}
+
+cm::optional<cmTryCompileResult> cmCoreTryCompile::FinishTryCompileCode(
+  Arguments& arguments, int res, std::string output,
+  std::string const& sourceDirectory, std::string const& targetName,
+  std::map<std::string, std::string> cmakeVariables)
+{
   // set the result var to the return value to indicate success or failure
   if (arguments.NoCache) {
     this->Makefile->AddDefinition(*arguments.CompileResultVariable,
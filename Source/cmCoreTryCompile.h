@@ -4,6 +4,7 @@
 
 #include "cmConfigure.h" // IWYU pragma: keep
 
+#include <functional>
 #include <map>
 #include <string>
 #include <utility>
@@ -103,6 +104,7 @@ public:
     cm::optional<ArgumentParser::NonEmpty<std::string>> LogDescription;
     bool NoCache = false;
     bool NoLog = false;
+    bool Defer = false;
 
     ArgumentParser::Continue SetSourceType(cm::string_view sourceType);
     SourceType SourceTypeContext = SourceType::Normal;
@@ -131,6 +133,19 @@ public:
   cm::optional<cmTryCompileResult> TryCompileCode(Arguments& arguments,
                                                   cm::TargetType targetType);
 
+  using FinishCallback =
+    std::function<void(cmCoreTryCompile&, Arguments const&,
+                       cm::optional<cmTryCompileResult> const&)>;
+
+  /**
+   * Like TryCompileCode, but build the test project later together with
+   * the other deferred test projects.  The \p finish callback receives a
+   * copy of this object and of the \p arguments with the result.  It is
+   * called before this returns if the build cannot be deferred.
+   */
+  void DeferTryCompileCode(Arguments& arguments, cm::TargetType targetType,
+                           FinishCallback finish);
+
   /**
    * Returns \c true if \p path resides within a CMake temporary directory,
    * otherwise returns \c false.
@@ -161,6 +176,14 @@ public:
   cmMakefile* Makefile;
 
 private:
+  cm::optional<cmTryCompileResult> TryCompileCode(Arguments& arguments,
+                                                  cm::TargetType targetType,
+                                                  FinishCallback* finish);
+  cm::optional<cmTryCompileResult> FinishTryCompileCode(
+    Arguments& arguments, int res, std::string output,
+    std::string const& sourceDirectory, std::string const& targetName,
+    std::map<std::string, std::string> cmakeVariables);
+
   std::string WriteSource(std::string const& name, std::string const& content,
                           char const* command) const;
 
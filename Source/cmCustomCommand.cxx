@@ -184,6 +184,16 @@ void cmCustomCommand::SetDependsExplicitOnly(bool b)
   this->DependsExplicitOnly = b;
 }
 
+bool cmCustomCommand::GetPreserveUnchangedOutputs() const
+{
+  return this->PreserveUnchangedOutputs;
+}
+
+void cmCustomCommand::SetPreserveUnchangedOutputs(bool b)
+{
+  this->PreserveUnchangedOutputs = b;
+}
+
 std::string const& cmCustomCommand::GetDepfile() const
 {
   return this->Depfile;
@@ -107,6 +107,11 @@ public:
   bool GetDependsExplicitOnly() const;
   void SetDependsExplicitOnly(bool b);
 
+  /** Set/Get whether outputs the command rewrites with identical content
+      keep their previous file (used by the Ninja generator).  */
+  bool GetPreserveUnchangedOutputs() const;
+  void SetPreserveUnchangedOutputs(bool b);
+
   /** Set/Get the depfile (used by the Ninja generator) */
   std::string const& GetDepfile() const;
   void SetDepfile(std::string const& depfile);
@@ -162,6 +167,7 @@ private:
   bool StdPipesUTF8 = false;
   bool HasMainDependency_ = false;
   bool DependsExplicitOnly = false;
+  bool PreserveUnchangedOutputs = false;
   bool Codegen = false;
 
 // Policies are NEW for synthesized custom commands, and set by cmMakefile for
@@ -228,6 +228,11 @@ cmCustomCommandGenerator::cmCustomCommandGenerator(
       !cc.GetDepfile().empty() &&
       this->LG->GetGlobalGenerator()->DepfileFormat()) {
     cmCustomCommandLine argv;
+    std::string const& helper =
+      this->LG->GetGlobalGenerator()->GetCommandHelper();
+    if (!helper.empty()) {
+      argv.push_back(helper);
+    }
     argv.push_back(cmSystemTools::GetCMakeCommand());
     argv.emplace_back("-E");
     argv.emplace_back("cmake_transform_depfile");
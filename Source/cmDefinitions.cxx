@@ -3,54 +3,182 @@
 #include "cmDefinitions.h"
 
 #include <cassert>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
 #include <cm/string_view>
 
 cmDefinitions::Def cmDefinitions::NoDef;
+cmDefinitions::Atom const cmDefinitions::NoAtom;
 
-cmDefinitions::Def const& cmDefinitions::GetInternal(std::string const& key,
+namespace {
+struct AtomTable
+{
+  std::unordered_map<cm::String, std::uint32_t> Atoms;
+  std::vector<std::string> Names;
+};
+
+AtomTable& GetAtomTable()
+{
+  static AtomTable table;
+  return table;
+}
+
+// Spread consecutive atoms over the table.  Multiplication by an odd
+// constant is a bijection modulo any power of two.
+std::size_t SlotIndex(std::uint32_t atom, std::size_t mask)
+{
+  return static_cast<std::size_t>(atom * 0x9e3779b1u) & mask;
+}
+}
+
+cmDefinitions::Atom cmDefinitions::Intern(std::string const& key)
+{
+  AtomTable& table = GetAtomTable();
+  auto it = table.Atoms.find(cm::String::borrow(key));
+  if (it != table.Atoms.end()) {
+    return it->second;
+  }
+  Atom const atom = static_cast<Atom>(table.Names.size());
+  assert(atom != NoAtom);
+  table.Names.push_back(key);
+  table.Atoms.emplace(table.Names.back(), atom);
+  return atom;
+}
+
+cmDefinitions::Atom cmDefinitions::Lookup(std::string const& key)
+{
+  AtomTable const& table = GetAtomTable();
+  auto it = table.Atoms.find(cm::String::borrow(key));
+  return it != table.Atoms.end() ? it->second : NoAtom;
+}
+
+std::string const& cmDefinitions::Name(Atom atom)
+{
+  return GetAtomTable().Names[atom];
+}
+
+cmDefinitions::Def const* cmDefinitions::Find(Atom atom) const
+{
+  if (this->Table.empty()) {
+    return nullptr;
+  }
+  std::size_t const mask = this->Table.size() - 1;
+  for (std::size_t i = SlotIndex(atom, mask);; i = (i + 1) & mask) {
+    Slot const& slot = this->Table[i];
+    if (slot.Key == atom) {
+      return &slot.Value;
+    }
+    if (slot.Key == NoAtom) {
+      return nullptr;
+    }
+  }
+}
+
+cmDefinitions::Def& cmDefinitions::Insert(Atom atom)
+{
+  if (2 * (this->Count + 1) > this->Table.size()) {
+    std::vector<Slot> old;
+    old.swap(this->Table);
+    this->Table.resize(old.empty() ? 8 : 2 * old.size());
+    std::size_t const mask = this->Table.size() - 1;
+    for (Slot& slot : old) {
+      if (slot.Key == NoAtom) {
+        continue;
+      }
+      std::size_t i = SlotIndex(slot.Key, mask);
+      while (this->Table[i].Key != NoAtom) {
+        i = (i + 1) & mask;
+      }
+      this->Table[i] = std::move(slot);
+    }
+  }
+  std::size_t const mask = this->Table.size() - 1;
+  std::size_t i = SlotIndex(atom, mask);
+  while (this->Table[i].Key != atom) {
+    if (this->Table[i].Key == NoAtom) {
+      this->Table[i].Key = atom;
+      ++this->Count;
+      break;
+    }
+    i = (i + 1) & mask;
+  }
+  return this->Table[i].Value;
+}
+
+cmDefinitions::Def const* cmDefinitions::FindOrCompute(Atom atom,
+                                                     std::string const& key)
+{
+  if (atom != NoAtom) {
+    if (Def const* def = this->Find(atom)) {
+      return def;
+    }
+  }
+  std::string value;
+  if (!this->Lazy || !this->Lazy->Compute(key, value)) {
+    return nullptr;
+  }
+  Def& def = this->Insert(atom != NoAtom ? atom : cmDefinitions::Intern(key));
+  def.Value = std::move(value);
+  return &def;
+}
+
+bool cmDefinitions::Defines(Atom atom, std::string const& key) const
+{
+  return (atom != NoAtom && this->Find(atom)) ||
+    (this->Lazy && this->Lazy->Has(key));
+}
+
+cmDefinitions::Def const& cmDefinitions::GetInternal(Atom atom,
                                                      StackIter begin,
                                                      StackIter end, bool raise)
 {
   assert(begin != end);
-  {
-    auto it = begin->Map.find(cm::String::borrow(key));
-    if (it != begin->Map.end()) {
-      return it->second;
-    }
+  if (Def const* def =
+        begin->FindOrCompute(atom, cmDefinitions::Name(atom))) {
+    return *def;
   }
   StackIter it = begin;
   ++it;
   if (it == end) {
     return cmDefinitions::NoDef;
   }
-  Def const& def = cmDefinitions::GetInternal(key, it, end, raise);
+  Def const& def = cmDefinitions::GetInternal(atom, it, end, raise);
   if (!raise) {
     return def;
   }
-  return begin->Map.emplace(key, def).first->second;
+  Def& local = begin->Insert(atom);
+  local = def;
+  return local;
 }
 
 cmValue cmDefinitions::Get(std::string const& key, StackIter begin,
                            StackIter end)
 {
-  Def const& def = cmDefinitions::GetInternal(key, begin, end, false);
-  return def.Value ? cmValue(def.Value.str_if_stable()) : nullptr;
+  // A name that was never interned has no definition in any scope,
+  // unless a scope computes it on demand.
+  Atom const atom = cmDefinitions::Lookup(key);
+  for (StackIter it = begin; it != end; ++it) {
+    if (Def const* def = it->FindOrCompute(atom, key)) {
+      return def->Value ? cmValue(def->Value.str_if_stable()) : nullptr;
+    }
+  }
+  return nullptr;
 }
 
 void cmDefinitions::Raise(std::string const& key, StackIter begin,
                           StackIter end)
 {
-  cmDefinitions::GetInternal(key, begin, end, true);
+  cmDefinitions::GetInternal(cmDefinitions::Intern(key), begin, end, true);
 }
 
 bool cmDefinitions::HasKey(std::string const& key, StackIter begin,
                            StackIter end)
 {
+  Atom const atom = cmDefinitions::Lookup(key);
   for (StackIter it = begin; it != end; ++it) {
-    if (it->Map.find(cm::String::borrow(key)) != it->Map.end()) {
+    if (it->Defines(atom, key)) {
       return true;
     }
   }
@@ -60,17 +188,31 @@ bool cmDefinitions::HasKey(std::string const& key, StackIter begin,
 cmDefinitions cmDefinitions::MakeClosure(StackIter begin, StackIter end)
 {
   cmDefinitions closure;
-  std::unordered_set<cm::string_view> undefined;
+  std::unordered_set<Atom> undefined;
   for (StackIter it = begin; it != end; ++it) {
     // Consider local definitions.
-    for (auto const& mi : it->Map) {
+    for (Slot const& slot : it->Table) {
       // Use this key if it is not already set or unset.
-      if (closure.Map.find(mi.first) == closure.Map.end() &&
-          undefined.find(mi.first.view()) == undefined.end()) {
-        if (mi.second.Value) {
-          closure.Map.insert(mi);
+      if (slot.Key != NoAtom && !closure.Find(slot.Key) &&
+          undefined.find(slot.Key) == undefined.end()) {
+        if (slot.Value.Value) {
+          closure.Insert(slot.Key) = slot.Value;
         } else {
-          undefined.emplace(mi.first.view());
+          undefined.emplace(slot.Key);
+        }
+      }
+    }
+    // Consider definitions computed on demand.
+    if (it->Lazy) {
+      std::vector<std::string> keys;
+      it->Lazy->AppendKeys(keys);
+      for (std::string const& key : keys) {
+        Atom const atom = cmDefinitions::Intern(key);
+        if (!it->Find(atom) && !closure.Find(atom) &&
+            undefined.find(atom) == undefined.end()) {
+          std::string value;
+          it->Lazy->Compute(key, value);
+          closure.Insert(atom).Value = std::move(value);
         }
       }
     }
@@ -82,14 +224,24 @@ std::vector<std::string> cmDefinitions::ClosureKeys(StackIter begin,
                                                     StackIter end)
 {
   std::vector<std::string> defined;
-  std::unordered_set<cm::string_view> bound;
+  std::unordered_set<Atom> bound;
 
   for (StackIter it = begin; it != end; ++it) {
-    defined.reserve(defined.size() + it->Map.size());
-    for (auto const& mi : it->Map) {
+    defined.reserve(defined.size() + it->Count);
+    for (Slot const& slot : it->Table) {
       // Use this key if it is not already set or unset.
-      if (bound.emplace(mi.first.view()).second && mi.second.Value) {
-        defined.push_back(*mi.first.str_if_stable());
+      if (slot.Key != NoAtom && bound.emplace(slot.Key).second &&
+          slot.Value.Value) {
+        defined.push_back(cmDefinitions::Name(slot.Key));
+      }
+    }
+    if (it->Lazy) {
+      std::vector<std::string> keys;
+      it->Lazy->AppendKeys(keys);
+      for (std::string& key : keys) {
+        if (bound.emplace(cmDefinitions::Intern(key)).second) {
+          defined.push_back(std::move(key));
+        }
       }
     }
   }
@@ -99,10 +251,15 @@ std::vector<std::string> cmDefinitions::ClosureKeys(StackIter begin,
 
 void cmDefinitions::Set(std::string const& key, cm::string_view value)
 {
-  this->Map[key] = Def(value);
+  this->Insert(cmDefinitions::Intern(key)) = Def(value);
 }
 
 void cmDefinitions::Unset(std::string const& key)
 {
-  this->Map[key] = Def();
+  this->Insert(cmDefinitions::Intern(key)) = Def();
+}
+
+void cmDefinitions::SetLazy(std::shared_ptr<cmLazyDefinitions const> lazy)
+{
+  this->Lazy = std::move(lazy);
 }
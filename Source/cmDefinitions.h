@@ -4,8 +4,10 @@
 
 #include "cmConfigure.h" // IWYU pragma: keep
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include <cm/string_view>
@@ -14,12 +16,40 @@
 #include "cmString.hxx"
 #include "cmValue.h"
 
+/** \class cmLazyDefinitions
+ * \brief Provide variable definitions whose values are computed on demand.
+ *
+ * A scope may hold a provider of definitions that are expensive to
+ * compute but rarely read, such as the ARG* variables of a function call.
+ * A value is computed the first time its variable is read and then stored
+ * in the scope like any other definition.  Definitions set or unset in the
+ * scope take precedence over the provider.
+ */
+class cmLazyDefinitions
+{
+public:
+  virtual ~cmLazyDefinitions() = default;
+
+  /** Whether the provider defines the given variable.  */
+  virtual bool Has(std::string const& key) const = 0;
+
+  /** Compute the value of the given variable, if the provider defines it.  */
+  virtual bool Compute(std::string const& key, std::string& value) const = 0;
+
+  /** Append the names of all variables the provider defines.  */
+  virtual void AppendKeys(std::vector<std::string>& keys) const = 0;
+};
+
 /** \class cmDefinitions
  * \brief Store a scope of variable definitions for CMake language.
  *
  * This stores the state of variable definitions (set or unset) for
  * one scope.  Sets are always local.  Gets search parent scopes
- * transitively and save results locally.
+ * transitively without modifying the scopes they visit.
+ *
+ * Variable names are interned into process-wide integer atoms so that
+ * a lookup hashes the name once and then probes each scope's flat
+ * table with the atom alone.
  */
 class cmDefinitions
 {
@@ -46,7 +76,23 @@ public:
   /** Unset a definition.  */
   void Unset(std::string const& key);
 
+  /** Provide definitions of this scope that are computed on demand.  */
+  void SetLazy(std::shared_ptr<cmLazyDefinitions const> lazy);
+
 private:
+  /** Interned variable name.  */
+  using Atom = std::uint32_t;
+  static Atom const NoAtom = 0xffffffff;
+
+  /** Get the atom for a name, interning it if necessary.  */
+  static Atom Intern(std::string const& key);
+
+  /** Get the atom for a name, or NoAtom if it was never interned.  */
+  static Atom Lookup(std::string const& key);
+
+  /** Get the name of an atom.  */
+  static std::string const& Name(Atom atom);
+
   /** String with existence boolean.  */
   struct Def
   {
@@ -60,8 +106,32 @@ private:
   };
   static Def NoDef;
 
-  std::unordered_map<cm::String, Def> Map;
+  struct Slot
+  {
+    Atom Key = NoAtom;
+    Def Value;
+  };
+
+  /** Open-addressed table of definitions with linear probing.  Its
+      size is zero or a power of two, and it is never more than half
+      full.  Entries are never removed; unsetting a variable stores a
+      null value instead.  */
+  std::vector<Slot> Table;
+  std::size_t Count = 0;
+
+  std::shared_ptr<cmLazyDefinitions const> Lazy;
+
+  Def const* Find(Atom atom) const;
+  Def& Insert(Atom atom);
+
+  /** Find a definition of this scope, computing it from the lazy
+      definitions if necessary.  The atom may be NoAtom if the key
+      was never interned.  */
+  Def const* FindOrCompute(Atom atom, std::string const& key);
+
+  /** Whether this scope has a definition, computed or not.  */
+  bool Defines(Atom atom, std::string const& key) const;
 
-  static Def const& GetInternal(std::string const& key, StackIter begin,
-                                StackIter end, bool raise);
+  static Def const& GetInternal(Atom atom, StackIter begin, StackIter end,
+                                bool raise);
 };
@@ -2,15 +2,27 @@
    file LICENSE.rst or https://cmake.org/licensing for details.  */
 #include "cmDependsC.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <unordered_set>
 #include <utility>
 
+#if !defined(CMAKE_BOOTSTRAP)
+#  include <atomic>
+#  include <thread>
+#endif
+
 #include "cmsys/FStream.hxx"
 
-#include "cmFileTime.h"
+#include "cmCryptoHash.h"
+#include "cmGeneratedFileStream.h"
 #include "cmGlobalUnixMakefileGenerator3.h"
 #include "cmList.h"
 #include "cmLocalUnixMakefileGenerator3.h"
 #include "cmMakefile.h"
+#include "cmMappedFile.h"
 #include "cmStringAlgorithms.h"
 #include "cmSystemTools.h"
 #include "cmValue.h"
@@ -23,6 +35,45 @@
 #define INCLUDE_REGEX_COMPLAIN_MARKER "#IncludeRegexComplain: "
 #define INCLUDE_REGEX_TRANSFORM_MARKER "#IncludeRegexTransform: "
 
+#if !defined(CMAKE_BOOTSTRAP)
+// Upper limit of the number of threads scanning the files of one level.
+static unsigned int const MaxScanThreads = 8;
+#endif
+
+/** Scan files for include directives.  Each worker thread has its own
+    instance because matching a regular expression modifies it.  */
+class cmDependsC::Scanner
+{
+public:
+  Scanner(cmDependsC const& depends)
+    : IncludeRegexLine(depends.IncludeRegexLine)
+    , IncludeRegexScan(depends.IncludeRegexScan)
+    , IncludeRegexTransform(depends.IncludeRegexTransform)
+    , TransformRules(depends.TransformRules)
+  {
+  }
+
+  struct Result
+  {
+    bool Read = false;
+    bool HaveTime = false;
+    cmFileTime::TimeType Time = 0;
+    std::vector<UnscannedEntry> UnscannedEntries;
+  };
+
+  void Scan(std::string const& fullName, Result& result);
+
+private:
+  void ScanLine(std::string& line, std::string const& directory,
+                Result& result);
+  void TransformLine(std::string& line);
+
+  cmsys::RegularExpression IncludeRegexLine;
+  cmsys::RegularExpression IncludeRegexScan;
+  cmsys::RegularExpression IncludeRegexTransform;
+  TransformRulesType const& TransformRules;
+};
+
 cmDependsC::cmDependsC() = default;
 
 cmDependsC::cmDependsC(cmLocalUnixMakefileGenerator3* lg,
@@ -65,12 +116,24 @@ cmDependsC::cmDependsC(cmLocalUnixMakefileGenerator3* lg,
   this->CacheFileName =
     cmStrCat(this->TargetDirectory, '/', lang, ".includecache");
 
+  // Targets that scan with the same rules share an include cache.
+  cmCryptoHash hasher(cmCryptoHash::AlgoMD5);
+  std::string const rulesHash =
+    hasher.HashString(cmStrCat(this->IncludeRegexLineString, '\n',
+                               this->IncludeRegexScanString, '\n',
+                               this->IncludeRegexTransformString));
+  this->SharedCacheFileName =
+    cmStrCat(lg->GetBinaryDirectory(), "/CMakeFiles/IncludeCache/", lang,
+             '-', rulesHash.substr(0, 16), ".includecache");
+
   this->ReadCacheFile();
+  this->ReadSharedCacheFile(this->SharedCache, this->SharedCacheFileTime);
 }
 
 cmDependsC::~cmDependsC()
 {
   this->WriteCacheFile();
+  this->WriteSharedCacheFile();
 }
 
 bool cmDependsC::WriteDependencies(std::set<std::string> const& sources,
@@ -116,94 +179,98 @@ bool cmDependsC::WriteDependencies(std::set<std::string> const& sources,
       this->Encountered.insert(src);
     }
 
-    std::set<std::string> scanned;
+    // Walk the graph one level at a time so that the files of a level
+    // can be scanned together.  The files are processed in the same order
+    // as by a plain breadth-first walk.
+    std::unordered_set<std::string> scanned;
+    std::vector<UnscannedEntry> level;
+    std::vector<std::string> levelFiles;
+    std::vector<std::string> unscannedFiles;
     while (!this->Unscanned.empty()) {
-      // Get the next file to scan.
-      UnscannedEntry current = this->Unscanned.front();
-      this->Unscanned.pop();
-
-      // If not a full path, find the file in the include path.
-      std::string fullName;
-      if ((srcFiles > 0) || cmSystemTools::FileIsFullPath(current.FileName)) {
-        if (cmSystemTools::FileExists(current.FileName, true)) {
-          fullName = current.FileName;
-        }
-      } else if (!current.QuotedLocation.empty() &&
-                 cmSystemTools::FileExists(current.QuotedLocation, true)) {
-        // The include statement producing this entry was a double-quote
-        // include and the included file is present in the directory of
-        // the source containing the include statement.
-        fullName = current.QuotedLocation;
-      } else {
-        auto headerLocationIt =
-          this->HeaderLocationCache.find(current.FileName);
-        if (headerLocationIt != this->HeaderLocationCache.end()) {
-          fullName = headerLocationIt->second;
+      level.clear();
+      while (!this->Unscanned.empty()) {
+        level.push_back(std::move(this->Unscanned.front()));
+        this->Unscanned.pop();
+      }
+
+      levelFiles.clear();
+      unscannedFiles.clear();
+      for (UnscannedEntry const& current : level) {
+        // If not a full path, find the file in the include path.
+        std::string fullName;
+        if ((srcFiles > 0) ||
+            cmSystemTools::FileIsFullPath(current.FileName)) {
+          if (this->FileExists(current.FileName)) {
+            fullName = current.FileName;
+          }
+        } else if (!current.QuotedLocation.empty() &&
+                   this->FileExists(current.QuotedLocation)) {
+          // The include statement producing this entry was a double-quote
+          // include and the included file is present in the directory of
+          // the source containing the include statement.
+          fullName = current.QuotedLocation;
         } else {
-          for (std::string const& iPath : this->IncludePath) {
-            // Construct the name of the file as if it were in the current
-            // include directory.  Avoid using a leading "./".
-            std::string tmpPath =
-              cmSystemTools::CollapseFullPath(current.FileName, iPath);
-
-            // Look for the file in this location.
-            if (cmSystemTools::FileExists(tmpPath, true)) {
-              fullName = tmpPath;
-              this->HeaderLocationCache[current.FileName] = std::move(tmpPath);
-              break;
+          auto headerLocationIt =
+            this->HeaderLocationCache.find(current.FileName);
+          if (headerLocationIt != this->HeaderLocationCache.end()) {
+            fullName = headerLocationIt->second;
+          } else {
+            for (std::string const& iPath : this->IncludePath) {
+              // Construct the name of the file as if it were in the current
+              // include directory.  Avoid using a leading "./".
+              std::string tmpPath =
+                cmSystemTools::CollapseFullPath(current.FileName, iPath);
+
+              // Look for the file in this location.
+              if (this->FileExists(tmpPath)) {
+                fullName = tmpPath;
+                this->HeaderLocationCache[current.FileName] =
+                  std::move(tmpPath);
+                break;
+              }
             }
           }
         }
-      }
 
-      // Complain if the file cannot be found and matches the complain
-      // regex.
-      if (fullName.empty() &&
-          this->IncludeRegexComplain.find(current.FileName)) {
-        cmSystemTools::Error(
-          cmStrCat("Cannot find file \"", current.FileName, "\"."));
-        return false;
+        // Complain if the file cannot be found and matches the complain
+        // regex.
+        if (fullName.empty() &&
+            this->IncludeRegexComplain.find(current.FileName)) {
+          cmSystemTools::Error(
+            cmStrCat("Cannot find file \"", current.FileName, "\"."));
+          return false;
+        }
+        srcFiles--;
+
+        // Process the file if it was found and has not been scanned
+        // already.  Scan it unless it is already in a cache.
+        if (fullName.empty() || !scanned.insert(fullName).second) {
+          continue;
+        }
+        if (this->FileCache.find(fullName) == this->FileCache.end() &&
+            !this->FindInSharedCache(fullName)) {
+          unscannedFiles.push_back(fullName);
+        }
+        levelFiles.push_back(std::move(fullName));
       }
 
-      // Scan the file if it was found and has not been scanned already.
-      if (!fullName.empty() && (scanned.find(fullName) == scanned.end())) {
-        // Record scanned files.
-        scanned.insert(fullName);
+      this->ScanFiles(unscannedFiles);
 
-        // Check whether this file is already in the cache
+      // Add the files that could be read as dependencies and queue the
+      // files they include.  Just leave out files that cannot be read.
+      for (std::string const& fullName : levelFiles) {
         auto fileIt = this->FileCache.find(fullName);
-        if (fileIt != this->FileCache.end()) {
-          fileIt->second.Used = true;
-          dependencies.insert(fullName);
-          for (UnscannedEntry const& inc : fileIt->second.UnscannedEntries) {
-            if (this->Encountered.insert(inc.FileName).second) {
-              this->Unscanned.push(inc);
-            }
-          }
-        } else {
-
-          // Try to scan the file.  Just leave it out if we cannot find
-          // it.
-          cmsys::ifstream fin(fullName.c_str());
-          if (fin) {
-            cmsys::FStream::BOM bom = cmsys::FStream::ReadBOM(fin);
-            if (bom == cmsys::FStream::BOM_None ||
-                bom == cmsys::FStream::BOM_UTF8) {
-              // Add this file as a dependency.
-              dependencies.insert(fullName);
-
-              // Scan this file for new dependencies.  Pass the directory
-              // containing the file to handle double-quote includes.
-              std::string dir = cmSystemTools::GetFilenamePath(fullName);
-              this->Scan(fin, dir, fullName);
-            } else {
-              // Skip file with encoding we do not implement.
-            }
+        if (fileIt == this->FileCache.end()) {
+          continue;
+        }
+        fileIt->second.Used = true;
+        dependencies.insert(fullName);
+        for (UnscannedEntry const& inc : fileIt->second.UnscannedEntries) {
+          if (this->Encountered.insert(inc.FileName).second) {
+            this->Unscanned.push(inc);
           }
         }
       }
-
-      srcFiles--;
     }
   }
 
@@ -224,8 +291,17 @@ bool cmDependsC::WriteDependencies(std::set<std::string> const& sources,
       makeDepends << obj_m << ':';
     }
     for (std::string const& dep : dependencies) {
-      std::string dependee = this->LocalGenerator->ConvertToMakefilePath(
-        this->LocalGenerator->MaybeRelativeToTopBinDir(dep));
+      // Objects of a target tend to share most dependencies.
+      auto dependeeIt = this->MakefileDependees.find(dep);
+      if (dependeeIt == this->MakefileDependees.end()) {
+        dependeeIt =
+          this->MakefileDependees
+            .emplace(dep,
+                     this->LocalGenerator->ConvertToMakefilePath(
+                       this->LocalGenerator->MaybeRelativeToTopBinDir(dep)))
+            .first;
+      }
+      std::string const& dependee = dependeeIt->second;
       if (supportLongLineDepend) {
         makeDepends << ' ' << lineContinue << ' ' << dependee;
       } else {
@@ -339,53 +415,293 @@ void cmDependsC::WriteCacheFile() const
   }
 }
 
-void cmDependsC::Scan(std::istream& is, std::string const& directory,
-                      std::string const& fullName)
+bool cmDependsC::FileExists(std::string const& path)
 {
-  cmIncludeLines& newCacheEntry = this->FileCache[fullName];
-  newCacheEntry.Used = true;
+  auto it = this->FileExistsCache.find(path);
+  if (it == this->FileExistsCache.end()) {
+    it = this->FileExistsCache
+           .emplace(path, cmSystemTools::FileExists(path, true))
+           .first;
+  }
+  return it->second;
+}
 
-  // Read one line at a time.
+bool cmDependsC::FindInSharedCache(std::string const& fullName)
+{
+  auto it = this->SharedCache.find(fullName);
+  if (it == this->SharedCache.end()) {
+    return false;
+  }
+  // Use the entry only if the file did not change since it was scanned.
+  cmFileTime fileTime;
+  if (!fileTime.Load(fullName) || fileTime.GetTime() != it->second.Time) {
+    return false;
+  }
+  cmIncludeLines& cacheEntry = this->FileCache[fullName];
+  cacheEntry.UnscannedEntries = it->second.UnscannedEntries;
+  cacheEntry.Used = true;
+  return true;
+}
+
+bool cmDependsC::ReadSharedCacheFile(SharedCacheMap& entries,
+                                     cmFileTime& time) const
+{
+  if (this->SharedCacheFileName.empty() ||
+      !time.Load(this->SharedCacheFileName)) {
+    return false;
+  }
+  cmsys::ifstream fin(this->SharedCacheFileName.c_str());
+  if (!fin) {
+    return false;
+  }
+
+  // The file starts with the rules it was scanned with.
   std::string line;
-  while (cmSystemTools::GetLineFromStream(is, line)) {
-    // Transform the line content first.
-    if (!this->TransformRules.empty()) {
-      this->TransformLine(line);
+  if (!cmSystemTools::GetLineFromStream(fin, line) ||
+      line != this->IncludeRegexLineString ||
+      !cmSystemTools::GetLineFromStream(fin, line) ||
+      line != this->IncludeRegexScanString ||
+      !cmSystemTools::GetLineFromStream(fin, line) ||
+      line != this->IncludeRegexTransformString) {
+    return false;
+  }
+
+  // Each entry consists of the name of the scanned file, its time when
+  // it was scanned, and pairs of lines for the files it includes.  Skip
+  // entries of files that changed in the same time step as the cache
+  // was written, because their changes may not show in their time.
+  SharedCacheEntry ignored;
+  SharedCacheEntry* entry = nullptr;
+  while (cmSystemTools::GetLineFromStream(fin, line)) {
+    if (line.empty()) {
+      entry = nullptr;
+      continue;
+    }
+    if (!entry) {
+      std::string timeLine;
+      long long fileTime;
+      if (!cmSystemTools::GetLineFromStream(fin, timeLine) ||
+          !cmStrToLongLong(timeLine, &fileTime)) {
+        return false;
+      }
+      if (fileTime < time.GetTime()) {
+        entry = &entries[line];
+        entry->Time = fileTime;
+        entry->UnscannedEntries.clear();
+      } else {
+        entry = &ignored;
+      }
+      continue;
+    }
+    UnscannedEntry inc;
+    inc.FileName = line;
+    if (!cmSystemTools::GetLineFromStream(fin, line)) {
+      break;
     }
+    if (line != "-") {
+      inc.QuotedLocation = line;
+    }
+    entry->UnscannedEntries.push_back(std::move(inc));
+  }
+  return true;
+}
 
-    // Match include directives.
-    if (this->IncludeRegexLine.find(line)) {
-      // Get the file being included.
-      UnscannedEntry entry;
-      entry.FileName = this->IncludeRegexLine.match(2);
-      cmSystemTools::ConvertToUnixSlashes(entry.FileName);
-      if (this->IncludeRegexLine.match(3) == "\"" &&
-          !cmSystemTools::FileIsFullPath(entry.FileName)) {
-        // This was a double-quoted include with a relative path.  We
-        // must check for the file in the directory containing the
-        // file we are scanning.
-        entry.QuotedLocation =
-          cmSystemTools::CollapseFullPath(entry.FileName, directory);
+void cmDependsC::WriteSharedCacheFile() const
+{
+  if (this->SharedCacheScanned.empty()) {
+    return;
+  }
+
+  // Other targets may have updated the cache since it was loaded.
+  SharedCacheMap entries;
+  cmFileTime time;
+  this->ReadSharedCacheFile(entries, time);
+  for (auto const& scanned : this->SharedCacheScanned) {
+    entries[scanned.first] = scanned.second;
+  }
+
+  // Replace the file atomically so that concurrent scans of other
+  // targets never read a partial cache.
+  cmGeneratedFileStream cacheOut(this->SharedCacheFileName);
+  if (!cacheOut) {
+    return;
+  }
+  cacheOut << this->IncludeRegexLineString << '\n'
+           << this->IncludeRegexScanString << '\n'
+           << this->IncludeRegexTransformString << "\n\n";
+  for (auto const& entry : entries) {
+    cacheOut << entry.first << '\n' << entry.second.Time << '\n';
+    for (UnscannedEntry const& inc : entry.second.UnscannedEntries) {
+      cacheOut << inc.FileName << '\n';
+      if (inc.QuotedLocation.empty()) {
+        cacheOut << '-' << '\n';
+      } else {
+        cacheOut << inc.QuotedLocation << '\n';
       }
+    }
+    cacheOut << '\n';
+  }
+}
 
-      // Queue the file if it has not yet been encountered and it
-      // matches the regular expression for recursive scanning.  Note
-      // that this check does not account for the possibility of two
-      // headers with the same name in different directories when one
-      // is included by double-quotes and the other by angle brackets.
-      // It also does not work properly if two header files with the same
-      // name exist in different directories, and both are included from a
-      // file their own directory by simply using "filename.h" (#12619)
-      // This kind of problem will be fixed when a more
-      // preprocessor-like implementation of this scanner is created.
-      if (this->IncludeRegexScan.find(entry.FileName)) {
-        newCacheEntry.UnscannedEntries.push_back(entry);
-        if (this->Encountered.insert(entry.FileName).second) {
-          this->Unscanned.push(entry);
-        }
+void cmDependsC::ScanFiles(std::vector<std::string> const& files)
+{
+  if (files.empty()) {
+    return;
+  }
+  std::vector<Scanner::Result> results(files.size());
+
+#if !defined(CMAKE_BOOTSTRAP)
+  unsigned int threads = std::min(
+    { std::max(std::thread::hardware_concurrency(), 1u), MaxScanThreads,
+      static_cast<unsigned int>(files.size()) });
+  if (threads > 1) {
+    std::atomic<std::size_t> next(0);
+    auto work = [this, &files, &results, &next]() {
+      Scanner scanner(*this);
+      for (std::size_t i = next++; i < files.size(); i = next++) {
+        scanner.Scan(files[i], results[i]);
       }
+    };
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (unsigned int i = 1; i < threads; ++i) {
+      workers.emplace_back(work);
+    }
+    work();
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+  } else
+#endif
+  {
+    Scanner scanner(*this);
+    for (std::size_t i = 0; i < files.size(); ++i) {
+      scanner.Scan(files[i], results[i]);
     }
   }
+
+  for (std::size_t i = 0; i < files.size(); ++i) {
+    Scanner::Result& result = results[i];
+    if (!result.Read) {
+      continue;
+    }
+    this->FileCache[files[i]].UnscannedEntries = result.UnscannedEntries;
+    if (result.HaveTime) {
+      SharedCacheEntry& shared = this->SharedCacheScanned[files[i]];
+      shared.Time = result.Time;
+      shared.UnscannedEntries = std::move(result.UnscannedEntries);
+    }
+  }
+}
+
+void cmDependsC::Scanner::Scan(std::string const& fullName, Result& result)
+{
+  // Take the time before reading so that a change while the file is
+  // read invalidates the shared cache entry.
+  cmFileTime fileTime;
+  result.HaveTime = fileTime.Load(fullName);
+  result.Time = fileTime.GetTime();
+
+  cmMappedFile mapped(fullName);
+  char const* begin = mapped.GetData();
+  std::size_t size = mapped.GetSize();
+  std::string content;
+  if (!begin) {
+    // The file is empty or cannot be mapped.  Read it normally.
+    cmsys::ifstream fin(fullName.c_str(), std::ios::in | std::ios::binary);
+    if (!fin) {
+      return;
+    }
+    content.assign(std::istreambuf_iterator<char>(fin),
+                   std::istreambuf_iterator<char>());
+    begin = content.data();
+    size = content.size();
+  }
+  char const* const end = begin + size;
+
+  // Skip a UTF-8 byte order mark.  Skip files with an encoding we do not
+  // implement.
+  auto hasPrefix = [begin, size](char const* prefix, std::size_t n) {
+    return size >= n && memcmp(begin, prefix, n) == 0;
+  };
+  if (hasPrefix("\xEF\xBB\xBF", 3)) {
+    begin += 3;
+  } else if (hasPrefix("\xFE\xFF", 2) || hasPrefix("\xFF\xFE", 2) ||
+             hasPrefix("\0\0\xFE\xFF", 4)) {
+    return;
+  }
+  result.Read = true;
+
+  // Pass the directory containing the file to handle double-quote
+  // includes.
+  std::string const directory = cmSystemTools::GetFilenamePath(fullName);
+
+  // Only lines whose first non-blank character is '#' or '%' can match
+  // the include directive and transformation expressions, so look at
+  // other lines no further.
+  std::string line;
+  for (char const* lineBegin = begin; lineBegin < end;) {
+    char const* lineEnd = static_cast<char const*>(
+      memchr(lineBegin, '\n', static_cast<std::size_t>(end - lineBegin)));
+    if (!lineEnd) {
+      lineEnd = end;
+    }
+    char const* c = lineBegin;
+    while (c != lineEnd && (*c == ' ' || *c == '\t')) {
+      ++c;
+    }
+    if (c != lineEnd && (*c == '#' || *c == '%')) {
+      char const* contentEnd = lineEnd;
+      if (contentEnd[-1] == '\r') {
+        --contentEnd;
+      }
+      line.assign(lineBegin, contentEnd);
+      this->ScanLine(line, directory, result);
+    }
+    lineBegin = lineEnd + 1;
+  }
+}
+
+void cmDependsC::Scanner::ScanLine(std::string& line,
+                                   std::string const& directory,
+                                   Result& result)
+{
+  // Transform the line content first.
+  if (!this->TransformRules.empty()) {
+    this->TransformLine(line);
+  }
+
+  // Match include directives.
+  if (!this->IncludeRegexLine.find(line)) {
+    return;
+  }
+
+  // Get the file being included.
+  UnscannedEntry entry;
+  entry.FileName = this->IncludeRegexLine.match(2);
+  cmSystemTools::ConvertToUnixSlashes(entry.FileName);
+  if (this->IncludeRegexLine.match(3) == "\"" &&
+      !cmSystemTools::FileIsFullPath(entry.FileName)) {
+    // This was a double-quoted include with a relative path.  We
+    // must check for the file in the directory containing the
+    // file we are scanning.
+    entry.QuotedLocation =
+      cmSystemTools::CollapseFullPath(entry.FileName, directory);
+  }
+
+  // Record the file if it matches the regular expression for recursive
+  // scanning.  The walk queues it if it has not yet been encountered.
+  // Note that this check does not account for the possibility of two
+  // headers with the same name in different directories when one
+  // is included by double-quotes and the other by angle brackets.
+  // It also does not work properly if two header files with the same
+  // name exist in different directories, and both are included from a
+  // file their own directory by simply using "filename.h" (#12619)
+  // This kind of problem will be fixed when a more
+  // preprocessor-like implementation of this scanner is created.
+  if (this->IncludeRegexScan.find(entry.FileName)) {
+    result.UnscannedEntries.push_back(std::move(entry));
+  }
 }
 
 void cmDependsC::SetupTransforms()
@@ -437,7 +753,7 @@ void cmDependsC::ParseTransform(std::string const& xform)
   this->TransformRules[name] = value;
 }
 
-void cmDependsC::TransformLine(std::string& line)
+void cmDependsC::Scanner::TransformLine(std::string& line)
 {
   // Check for a transform rule match.  Return if none.
   if (!this->IncludeRegexTransform.find(line)) {
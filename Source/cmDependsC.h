@@ -9,16 +9,26 @@
 #include <queue>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "cmsys/RegularExpression.hxx"
 
 #include "cmDepends.h"
+#include "cmFileTime.h"
 
 class cmLocalUnixMakefileGenerator3;
 
 /** \class cmDependsC
  * \brief Dependency scanner for C and C++ object files.
+ *
+ * The include graph is walked one level at a time.  Files of a level
+ * that are not in the include cache of the target are read through a
+ * memory mapping and scanned on worker threads.  Scanned files are also
+ * recorded in an include cache shared by all targets in the build tree
+ * that use the same scanning rules, so that a header included by many
+ * targets is scanned only once.
  */
 class cmDependsC : public cmDepends
 {
@@ -41,9 +51,10 @@ protected:
                          std::string const& obj, std::ostream& makeDepends,
                          std::ostream& internalDepends) override;
 
-  // Method to scan a single file.
-  void Scan(std::istream& is, std::string const& directory,
-            std::string const& fullName);
+  // Scan files that are not in the cache yet and add them to the cache.
+  // Files that cannot be read are left out.
+  void ScanFiles(std::vector<std::string> const& files);
+  class Scanner;
 
   // Regular expression to identify C preprocessor include directives.
   cmsys::RegularExpression IncludeRegexLine;
@@ -63,7 +74,6 @@ protected:
   TransformRulesType TransformRules;
   void SetupTransforms();
   void ParseTransform(std::string const& xform);
-  void TransformLine(std::string& line);
 
 public:
   // Data structures for dependency graph walk.
@@ -81,14 +91,38 @@ public:
 
 protected:
   DependencyMap const* ValidDeps = nullptr;
-  std::set<std::string> Encountered;
+  std::unordered_set<std::string> Encountered;
   std::queue<UnscannedEntry> Unscanned;
 
   std::map<std::string, cmIncludeLines> FileCache;
   std::map<std::string, std::string> HeaderLocationCache;
 
+  // The walks of all objects of the target look up mostly the same
+  // files, so remember whether they exist and how the depend file
+  // names them.
+  std::unordered_map<std::string, bool> FileExistsCache;
+  std::unordered_map<std::string, std::string> MakefileDependees;
+  bool FileExists(std::string const& path);
+
   std::string CacheFileName;
 
   void WriteCacheFile() const;
   void ReadCacheFile();
+
+  // Include cache shared by the targets of the build tree.  Entries
+  // record the modification time of the file when it was scanned.
+  struct SharedCacheEntry
+  {
+    cmFileTime::TimeType Time = 0;
+    std::vector<UnscannedEntry> UnscannedEntries;
+  };
+  using SharedCacheMap = std::map<std::string, SharedCacheEntry>;
+  SharedCacheMap SharedCache;
+  SharedCacheMap SharedCacheScanned;
+  cmFileTime SharedCacheFileTime;
+  std::string SharedCacheFileName;
+
+  bool FindInSharedCache(std::string const& fullName);
+  bool ReadSharedCacheFile(SharedCacheMap& entries, cmFileTime& time) const;
+  void WriteSharedCacheFile() const;
 };
@@ -0,0 +1,598 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#include "cmDyndepCache.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include <cm3p/json/reader.h>
+#include <cm3p/rapidhash.h>
+
+#include "cmGeneratedFileStream.h"
+#include "cmMappedFile.h"
+#include "cmScanDepFormat.h"
+#include "cmStringAlgorithms.h"
+#include "cmSystemTools.h"
+
+namespace {
+
+// Every entry starts with this, followed by the size of the content it
+// was parsed from.  Change the version whenever the encoding changes.
+char const EntryMagic[8] = { 'C', 'M', 'D', 'Y', 'N', 'D', '0', '1' };
+
+// Guard against unbounded recursion on damaged entries.
+int const MaxJsonDepth = 256;
+
+enum JsonTag : unsigned char
+{
+  JsonNull,
+  JsonFalse,
+  JsonTrue,
+  JsonInt,
+  JsonUInt,
+  JsonReal,
+  JsonString,
+  JsonArray,
+  JsonObject,
+};
+
+class Encoder
+{
+public:
+  explicit Encoder(std::size_t contentSize)
+  {
+    this->Data.append(EntryMagic, sizeof(EntryMagic));
+    this->Varint(contentSize);
+  }
+
+  void Byte(unsigned char b) { this->Data.push_back(static_cast<char>(b)); }
+
+  void Varint(std::uint64_t v)
+  {
+    while (v >= 0x80) {
+      this->Byte(static_cast<unsigned char>(v | 0x80));
+      v >>= 7;
+    }
+    this->Byte(static_cast<unsigned char>(v));
+  }
+
+  void String(std::string const& s)
+  {
+    this->Varint(s.size());
+    this->Data.append(s);
+  }
+
+  void Json(Json::Value const& value)
+  {
+    switch (value.type()) {
+      case Json::nullValue:
+        this->Byte(JsonNull);
+        break;
+      case Json::booleanValue:
+        this->Byte(value.asBool() ? JsonTrue : JsonFalse);
+        break;
+      case Json::intValue: {
+        // Zig-zag encode so that small negative numbers stay small.
+        std::int64_t const i = value.asInt64();
+        this->Byte(JsonInt);
+        this->Varint((static_cast<std::uint64_t>(i) << 1) ^
+                     static_cast<std::uint64_t>(i >> 63));
+      } break;
+      case Json::uintValue:
+        this->Byte(JsonUInt);
+        this->Varint(value.asUInt64());
+        break;
+      case Json::realValue: {
+        double const d = value.asDouble();
+        std::uint64_t bits;
+        memcpy(&bits, &d, sizeof(bits));
+        this->Byte(JsonReal);
+        this->Varint(bits);
+      } break;
+      case Json::stringValue:
+        this->Byte(JsonString);
+        this->String(value.asString());
+        break;
+      case Json::arrayValue:
+        this->Byte(JsonArray);
+        this->Varint(value.size());
+        for (Json::Value const& item : value) {
+          this->Json(item);
+        }
+        break;
+      case Json::objectValue:
+        this->Byte(JsonObject);
+        this->Varint(value.size());
+        for (auto i = value.begin(); i != value.end(); ++i) {
+          this->String(i.name());
+          this->Json(*i);
+        }
+        break;
+    }
+  }
+
+  void Strings(std::vector<std::string> const& strings)
+  {
+    this->Varint(strings.size());
+    for (std::string const& s : strings) {
+      this->String(s);
+    }
+  }
+
+  void Request(cmSourceReqInfo const& req)
+  {
+    this->String(req.LogicalName);
+    this->String(req.SourcePath);
+    this->String(req.CompiledModulePath);
+    this->Byte(static_cast<unsigned char>((req.UseSourcePath ? 1 : 0) |
+                                          (req.IsInterface ? 2 : 0)));
+    this->Byte(static_cast<unsigned char>(req.Method));
+  }
+
+  void TargetModules(cmDyndepCache::TargetModules const& modules)
+  {
+    this->Varint(modules.Modules.size());
+    for (auto const& module : modules.Modules) {
+      this->String(module.Name);
+      this->String(module.BmiPath);
+      this->Byte(module.IsPrivate ? 1 : 0);
+    }
+    this->Varint(modules.References.size());
+    for (auto const& reference : modules.References) {
+      this->String(reference.first);
+      this->String(reference.second.Path);
+      this->Byte(static_cast<unsigned char>(reference.second.Method));
+    }
+    this->Varint(modules.Usages.size());
+    for (auto const& usage : modules.Usages) {
+      this->String(usage.first);
+      this->Strings(usage.second);
+    }
+    this->String(modules.ImportErrorMessage);
+    this->Strings(modules.ImportErrorModules);
+    this->Json(modules.InterfaceObjects);
+  }
+
+  std::string Data;
+};
+
+class Decoder
+{
+public:
+  Decoder(char const* data, std::size_t size)
+    : Next(data)
+    , End(data + size)
+  {
+  }
+
+  bool Header(std::size_t contentSize)
+  {
+    std::uint64_t size;
+    if (static_cast<std::size_t>(this->End - this->Next) <
+          sizeof(EntryMagic) ||
+        memcmp(this->Next, EntryMagic, sizeof(EntryMagic)) != 0) {
+      return false;
+    }
+    this->Next += sizeof(EntryMagic);
+    return this->Varint(size) && size == contentSize;
+  }
+
+  bool AtEnd() const { return this->Next == this->End; }
+
+  bool Byte(unsigned char& b)
+  {
+    if (this->Next == this->End) {
+      return false;
+    }
+    b = static_cast<unsigned char>(*this->Next++);
+    return true;
+  }
+
+  bool Varint(std::uint64_t& v)
+  {
+    v = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      unsigned char b;
+      if (!this->Byte(b)) {
+        return false;
+      }
+      v |= static_cast<std::uint64_t>(b & 0x7f) << shift;
+      if (!(b & 0x80)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Read a size or count.  Every byte or item takes at least one byte,
+  // so larger values only occur in damaged entries.
+  bool Size(std::size_t& size)
+  {
+    std::uint64_t v;
+    if (!this->Varint(v) ||
+        v > static_cast<std::uint64_t>(this->End - this->Next)) {
+      return false;
+    }
+    size = static_cast<std::size_t>(v);
+    return true;
+  }
+
+  bool String(std::string& s)
+  {
+    std::size_t size;
+    if (!this->Size(size)) {
+      return false;
+    }
+    s.assign(this->Next, size);
+    this->Next += size;
+    return true;
+  }
+
+  bool Json(Json::Value& value, int depth)
+  {
+    unsigned char tag;
+    if (depth > MaxJsonDepth || !this->Byte(tag)) {
+      return false;
+    }
+    std::uint64_t v;
+    std::size_t size;
+    switch (tag) {
+      case JsonNull:
+        value = Json::Value();
+        return true;
+      case JsonFalse:
+      case JsonTrue:
+        value = (tag == JsonTrue);
+        return true;
+      case JsonInt:
+        if (!this->Varint(v)) {
+          return false;
+        }
+        value = static_cast<Json::Int64>((v >> 1) ^ (~(v & 1) + 1));
+        return true;
+      case JsonUInt:
+        if (!this->Varint(v)) {
+          return false;
+        }
+        value = static_cast<Json::UInt64>(v);
+        return true;
+      case JsonReal: {
+        if (!this->Varint(v)) {
+          return false;
+        }
+        double d;
+        memcpy(&d, &v, sizeof(d));
+        value = d;
+        return true;
+      }
+      case JsonString: {
+        std::string s;
+        if (!this->String(s)) {
+          return false;
+        }
+        value = std::move(s);
+        return true;
+      }
+      case JsonArray:
+        if (!this->Size(size)) {
+          return false;
+        }
+        value = Json::Value(Json::arrayValue);
+        for (std::size_t i = 0; i < size; ++i) {
+          if (!this->Json(value.append(Json::Value()), depth + 1)) {
+            return false;
+          }
+        }
+        return true;
+      case JsonObject: {
+        if (!this->Size(size)) {
+          return false;
+        }
+        value = Json::Value(Json::objectValue);
+        std::string key;
+        for (std::size_t i = 0; i < size; ++i) {
+          if (!this->String(key) || !this->Json(value[key], depth + 1)) {
+            return false;
+          }
+        }
+        return true;
+      }
+      default:
+        return false;
+    }
+  }
+
+  bool Request(cmSourceReqInfo& req)
+  {
+    unsigned char flags;
+    unsigned char method;
+    if (!this->String(req.LogicalName) || !this->String(req.SourcePath) ||
+        !this->String(req.CompiledModulePath) || !this->Byte(flags) ||
+        !this->Byte(method) ||
+        method > static_cast<unsigned char>(LookupMethod::IncludeQuote)) {
+      return false;
+    }
+    req.UseSourcePath = (flags & 1) != 0;
+    req.IsInterface = (flags & 2) != 0;
+    req.Method = static_cast<LookupMethod>(method);
+    return true;
+  }
+
+  bool Strings(std::vector<std::string>& strings)
+  {
+    std::size_t size;
+    if (!this->Size(size)) {
+      return false;
+    }
+    strings.resize(size);
+    for (std::string& s : strings) {
+      if (!this->String(s)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool Requests(std::vector<cmSourceReqInfo>& reqs)
+  {
+    std::size_t size;
+    if (!this->Size(size)) {
+      return false;
+    }
+    reqs.resize(size);
+    for (cmSourceReqInfo& req : reqs) {
+      if (!this->Request(req)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool TargetModules(cmDyndepCache::TargetModules& modules)
+  {
+    std::size_t size;
+    if (!this->Size(size)) {
+      return false;
+    }
+    modules.Modules.resize(size);
+    for (auto& module : modules.Modules) {
+      unsigned char isPrivate;
+      if (!this->String(module.Name) || !this->String(module.BmiPath) ||
+          !this->Byte(isPrivate)) {
+        return false;
+      }
+      module.IsPrivate = isPrivate != 0;
+    }
+    if (!this->Size(size)) {
+      return false;
+    }
+    modules.References.resize(size);
+    for (auto& reference : modules.References) {
+      unsigned char method;
+      if (!this->String(reference.first) ||
+          !this->String(reference.second.Path) || !this->Byte(method) ||
+          method > static_cast<unsigned char>(LookupMethod::IncludeQuote)) {
+        return false;
+      }
+      reference.second.Method = static_cast<LookupMethod>(method);
+    }
+    if (!this->Size(size)) {
+      return false;
+    }
+    modules.Usages.resize(size);
+    for (auto& usage : modules.Usages) {
+      if (!this->String(usage.first) || !this->Strings(usage.second)) {
+        return false;
+      }
+    }
+    return this->String(modules.ImportErrorMessage) &&
+      this->Strings(modules.ImportErrorModules) &&
+      this->Json(modules.InterfaceObjects, 0);
+  }
+
+private:
+  char const* Next;
+  char const* End;
+};
+
+// Extract what dependents use from a module information file.  This must
+// match the file written by cmGlobalNinjaGenerator::WriteDyndepFile.
+void ExtractTargetModules(Json::Value const& ltm,
+                          cmDyndepCache::TargetModules& modules)
+{
+  if (!ltm.isObject()) {
+    return;
+  }
+  Json::Value const& target_modules = ltm["modules"];
+  if (target_modules.isObject()) {
+    for (auto i = target_modules.begin(); i != target_modules.end(); ++i) {
+      Json::Value const& visible_module = *i;
+      if (visible_module.isObject()) {
+        cmDyndepCache::TargetModules::Module module;
+        module.Name = i.key().asString();
+        module.BmiPath = visible_module["bmi"].asString();
+        module.IsPrivate = visible_module["is-private"].asBool();
+        modules.Modules.push_back(std::move(module));
+      }
+    }
+  }
+  Json::Value const& target_modules_references = ltm["references"];
+  if (target_modules_references.isObject()) {
+    for (auto i = target_modules_references.begin();
+         i != target_modules_references.end(); ++i) {
+      if (i->isObject()) {
+        Json::Value const& reference_path = (*i)["path"];
+        CxxModuleReference module_reference;
+        module_reference.Method = LookupMethod::ByName;
+        if (reference_path.isString()) {
+          module_reference.Path = reference_path.asString();
+        }
+        Json::Value const& reference_method = (*i)["lookup-method"];
+        if (reference_method.isString()) {
+          std::string reference = reference_method.asString();
+          if (reference == "include-angle") {
+            module_reference.Method = LookupMethod::IncludeAngle;
+          } else if (reference == "include-quote") {
+            module_reference.Method = LookupMethod::IncludeQuote;
+          }
+        }
+        modules.References.emplace_back(i.key().asString(),
+                                        std::move(module_reference));
+      }
+    }
+  }
+  Json::Value const& target_modules_usage = ltm["usages"];
+  if (target_modules_usage.isObject()) {
+    for (auto i = target_modules_usage.begin();
+         i != target_modules_usage.end(); ++i) {
+      if (i->isArray()) {
+        std::vector<std::string> usage;
+        for (auto j = i->begin(); j != i->end(); ++j) {
+          usage.push_back(j->asString());
+        }
+        modules.Usages.emplace_back(i.key().asString(), std::move(usage));
+      }
+    }
+  }
+  Json::Value const& import_error = ltm["import-error"];
+  if (import_error.isObject()) {
+    modules.ImportErrorMessage = import_error["message"].asString();
+    Json::Value const& errModules = import_error["modules"];
+    if (errModules.isArray()) {
+      for (auto const& m : errModules) {
+        modules.ImportErrorModules.push_back(m.asString());
+      }
+    }
+  }
+  Json::Value const& interface_objects = ltm["interface-objects"];
+  if (interface_objects.isObject()) {
+    modules.InterfaceObjects = interface_objects;
+  }
+}
+}
+
+cmDyndepCache::cmDyndepCache(std::string const& topBinaryDir)
+  : Directory(cmStrCat(topBinaryDir, "/CMakeFiles/DyndepCache"))
+{
+}
+
+bool cmDyndepCache::LoadTargetModules(std::string const& path,
+                                      TargetModules& modules,
+                                      std::string& errors)
+{
+  cmMappedFile file(path);
+  char const* data = file.GetData();
+  std::size_t const size = file.GetSize();
+  if (!data && !cmSystemTools::FileExists(path, true)) {
+    return false;
+  }
+
+  std::string const entryPath = this->EntryPath(data, size, "modules");
+  {
+    cmMappedFile entry(entryPath);
+    if (entry.GetData()) {
+      Decoder decoder(entry.GetData(), entry.GetSize());
+      if (decoder.Header(size) && decoder.TargetModules(modules) &&
+          decoder.AtEnd()) {
+        return true;
+      }
+      modules = TargetModules();
+    }
+  }
+
+  Json::Value ltm;
+  Json::Reader reader;
+  if (!reader.parse(data, data + size, ltm, false)) {
+    errors = reader.getFormattedErrorMessages();
+    return false;
+  }
+  ExtractTargetModules(ltm, modules);
+  Encoder encoder(size);
+  encoder.TargetModules(modules);
+  this->WriteEntry(entryPath, encoder.Data);
+  return true;
+}
+
+void cmDyndepCache::StoreTargetModules(std::string const& content,
+                                       Json::Value const& value)
+{
+  std::string const entryPath =
+    this->EntryPath(content.data(), content.size(), "modules");
+  if (cmSystemTools::FileExists(entryPath, true)) {
+    return;
+  }
+  TargetModules modules;
+  ExtractTargetModules(value, modules);
+  Encoder encoder(content.size());
+  encoder.TargetModules(modules);
+  this->WriteEntry(entryPath, encoder.Data);
+}
+
+bool cmDyndepCache::ParseScanDepInfo(std::string const& path,
+                                     cmScanDepInfo& info)
+{
+  std::string entryPath;
+  std::size_t size = 0;
+  {
+    cmMappedFile file(path);
+    if (file.GetData()) {
+      size = file.GetSize();
+      entryPath = this->EntryPath(file.GetData(), size, "ddi");
+      cmMappedFile entry(entryPath);
+      if (entry.GetData()) {
+        Decoder decoder(entry.GetData(), entry.GetSize());
+        if (decoder.Header(size) && decoder.String(info.PrimaryOutput) &&
+            decoder.Strings(info.ExtraOutputs) &&
+            decoder.Requests(info.Provides) &&
+            decoder.Requests(info.Requires) && decoder.AtEnd()) {
+          return true;
+        }
+        info = cmScanDepInfo();
+      }
+    }
+  }
+
+  if (!cmScanDepFormat_P1689_Parse(path, &info)) {
+    return false;
+  }
+  if (!entryPath.empty()) {
+    Encoder encoder(size);
+    encoder.String(info.PrimaryOutput);
+    encoder.Strings(info.ExtraOutputs);
+    encoder.Varint(info.Provides.size());
+    for (cmSourceReqInfo const& req : info.Provides) {
+      encoder.Request(req);
+    }
+    encoder.Varint(info.Requires.size());
+    for (cmSourceReqInfo const& req : info.Requires) {
+      encoder.Request(req);
+    }
+    this->WriteEntry(entryPath, encoder.Data);
+  }
+  return true;
+}
+
+std::string cmDyndepCache::EntryPath(char const* data, std::size_t size,
+                                     char const* kind) const
+{
+  char hash[17];
+  snprintf(hash, sizeof(hash), "%016llx",
+           static_cast<unsigned long long>(rapidhash(data, size)));
+  return cmStrCat(this->Directory, '/', hash, '.', kind);
+}
+
+void cmDyndepCache::WriteEntry(std::string const& path,
+                               std::string const& data) const
+{
+  // The stream writes a temporary file and renames it into place, so
+  // concurrent steps never see a partial entry.
+  cmGeneratedFileStream fout;
+  fout.Open(path, true, true);
+  if (fout) {
+    fout.write(data.data(), static_cast<std::streamsize>(data.size()));
+  }
+}
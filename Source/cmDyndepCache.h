@@ -0,0 +1,85 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#pragma once
+
+#include "cmConfigure.h" // IWYU pragma: keep
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cm3p/json/value.h>
+
+#include "cmCxxModuleMapper.h"
+
+struct cmScanDepInfo;
+
+/** \class cmDyndepCache
+ * \brief Share parsed dyndep collation inputs between dyndep steps.
+ *
+ * Every cmake_ninja_dyndep step reads the .ddi files of its target and
+ * the module information files of all targets it links to.  The latter
+ * carry the module references and usages of all targets below them, so
+ * in deep target graphs most of the time of a step goes to parsing the
+ * same large files that the steps of other targets parsed before.
+ *
+ * This cache stores what the steps extract from these files in a compact
+ * binary encoding in the build tree.  Entries are addressed by a hash of
+ * the content of the file they were extracted from, so they never go
+ * stale and can be shared by all steps without coordination.  Entries
+ * are written atomically, and any entry that cannot be decoded is
+ * treated as absent.
+ */
+class cmDyndepCache
+{
+public:
+  /** The information a dependent extracts from a module information
+      file of a linked target.  */
+  struct TargetModules
+  {
+    struct Module
+    {
+      std::string Name;
+      std::string BmiPath;
+      bool IsPrivate = false;
+    };
+    std::vector<Module> Modules;
+    std::vector<std::pair<std::string, CxxModuleReference>> References;
+    std::vector<std::pair<std::string, std::vector<std::string>>> Usages;
+    std::string ImportErrorMessage;
+    std::vector<std::string> ImportErrorModules;
+    Json::Value InterfaceObjects;
+  };
+
+  cmDyndepCache(std::string const& topBinaryDir);
+
+  cmDyndepCache(cmDyndepCache const&) = delete;
+  cmDyndepCache& operator=(cmDyndepCache const&) = delete;
+
+  /**
+   * @brief Load a module information file of a linked target.
+   * @return false with a message in @a errors if the file cannot be read
+   * or parsed.
+   */
+  bool LoadTargetModules(std::string const& path, TargetModules& modules,
+                         std::string& errors);
+
+  /** Record the content of a module information file written by this
+      step along with the information that dependents extract from it.  */
+  void StoreTargetModules(std::string const& content,
+                          Json::Value const& value);
+
+  /**
+   * @brief Parse a P1689 .ddi file, reusing the result for identical
+   * content.
+   * @return false after reporting an error if the file is invalid.
+   */
+  bool ParseScanDepInfo(std::string const& path, cmScanDepInfo& info);
+
+private:
+  std::string EntryPath(char const* data, std::size_t size,
+                        char const* kind) const;
+  void WriteEntry(std::string const& path, std::string const& data) const;
+
+  std::string Directory;
+};
@@ -7,6 +7,7 @@
 #include "cmsys/Process.h"
 
 #include "cmExecutionStatus.h"
+#include "cmFileSystemCache.h"
 #include "cmMakefile.h"
 #include "cmProcessOutput.h"
 #include "cmStringAlgorithms.h"
@@ -210,6 +211,7 @@ bool RunCommand(std::string command, std::string& output, int& retVal,
   cmsysProcess_SetCommand(cp, cmd);
 #endif
 
+  cmFileSystemCache::Invalidate();
   cmsysProcess_Execute(cp);
 
   // Read the process output.
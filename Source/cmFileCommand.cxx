@@ -41,6 +41,7 @@
 #include "cmFileCopier.h"
 #include "cmFileInstaller.h"
 #include "cmFileLockPool.h"
+#include "cmFileSystemCache.h"
 #include "cmFileTimes.h"
 #include "cmGeneratedFileStream.h"
 #include "cmGeneratorExpression.h"
@@ -4142,6 +4143,37 @@ bool HandleChmodRecurseCommand(std::vector<std::string> const& args,
   return HandleChmodCommandImpl(args, true, status);
 }
 
+bool IsReadOnlySubcommand(std::string const& name)
+{
+  static std::set<cm::string_view> const readOnly{
+    "READ"_s,
+    "MD5"_s,
+    "SHA1"_s,
+    "SHA224"_s,
+    "SHA256"_s,
+    "SHA384"_s,
+    "SHA512"_s,
+    "SHA3_224"_s,
+    "SHA3_256"_s,
+    "SHA3_384"_s,
+    "SHA3_512"_s,
+    "STRINGS"_s,
+    "GLOB"_s,
+    "GLOB_RECURSE"_s,
+    "DIFFERENT"_s,
+    "READ_ELF"_s,
+    "READ_MACHO"_s,
+    "REAL_PATH"_s,
+    "RELATIVE_PATH"_s,
+    "TO_CMAKE_PATH"_s,
+    "TO_NATIVE_PATH"_s,
+    "TIMESTAMP"_s,
+    "SIZE"_s,
+    "READ_SYMLINK"_s,
+  };
+  return readOnly.count(name) != 0;
+}
+
 } // namespace
 
 bool cmFileCommand(std::vector<std::string> const& args,
@@ -4207,5 +4239,11 @@ bool cmFileCommand(std::vector<std::string> const& args,
     { "CHMOD_RECURSE"_s, HandleChmodRecurseCommand },
   };
 
-  return subcommand(args[0], args, status);
+  bool const result = subcommand(args[0], args, status);
+
+  // Later file system queries must see what the subcommand did.
+  if (!IsReadOnlySubcommand(args[0])) {
+    cmFileSystemCache::Invalidate();
+  }
+  return result;
 }
@@ -0,0 +1,188 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#include "cmFileSystemCache.h"
+
+#include <cstddef>
+#include <unordered_map>
+
+#if !defined(CMAKE_BOOTSTRAP)
+#  include <mutex>
+#endif
+
+#include "cmSystemTools.h"
+
+namespace {
+enum class Known : signed char
+{
+  Unknown,
+  No,
+  Yes,
+};
+
+struct Entry
+{
+  std::size_t Generation = 0;
+  Known Exists = Known::Unknown;
+  Known IsDirectory = Known::Unknown;
+  bool HaveRealPath = false;
+  std::string RealPath;
+};
+
+struct State
+{
+#if !defined(CMAKE_BOOTSTRAP)
+  // Child processes may be spawned from worker threads.
+  std::mutex Mutex;
+#endif
+  std::unordered_map<std::string, Entry> Entries;
+  // Entries of older generations are stale.
+  std::size_t Generation = 1;
+
+  std::size_t Hits = 0;
+  std::size_t Misses = 0;
+  std::size_t Invalidations = 0;
+};
+
+State& GetState()
+{
+  static State state;
+  return state;
+}
+
+// Serialize access to the state outside of the bootstrap build.
+class Guard
+{
+public:
+  Guard(State& state)
+#if !defined(CMAKE_BOOTSTRAP)
+    : Lock(state.Mutex)
+#endif
+  {
+    static_cast<void>(state);
+  }
+
+private:
+#if !defined(CMAKE_BOOTSTRAP)
+  std::lock_guard<std::mutex> Lock;
+#endif
+};
+
+Entry& Lookup(State& state, std::string const& path)
+{
+  Entry& entry = state.Entries[path];
+  if (entry.Generation != state.Generation) {
+    entry = Entry();
+    entry.Generation = state.Generation;
+  }
+  return entry;
+}
+
+template <typename Query>
+bool Load(Known Entry::*field, std::string const& path, Query query)
+{
+  State& state = GetState();
+  std::size_t generation;
+  {
+    Guard guard(state);
+    Known known = Lookup(state, path).*field;
+    if (known != Known::Unknown) {
+      ++state.Hits;
+      return known == Known::Yes;
+    }
+    ++state.Misses;
+    generation = state.Generation;
+  }
+  // Query the file system without holding the lock.  Drop the result if
+  // the file system was modified meanwhile.
+  bool const result = query(path);
+  {
+    Guard guard(state);
+    if (generation == state.Generation) {
+      Lookup(state, path).*field = result ? Known::Yes : Known::No;
+    }
+  }
+  return result;
+}
+}
+
+bool cmFileSystemCache::FileExists(std::string const& path)
+{
+  if (path.empty()) {
+    return false;
+  }
+  return Load(&Entry::Exists, path, [](std::string const& p) -> bool {
+    return cmSystemTools::FileExists(p);
+  });
+}
+
+bool cmFileSystemCache::FileExists(std::string const& path, bool isFile)
+{
+  if (cmFileSystemCache::FileExists(path)) {
+    return !isFile || !cmFileSystemCache::FileIsDirectory(path);
+  }
+  return false;
+}
+
+bool cmFileSystemCache::FileIsDirectory(std::string const& path)
+{
+  if (path.empty()) {
+    return false;
+  }
+  return Load(&Entry::IsDirectory, path, [](std::string const& p) -> bool {
+    return cmSystemTools::FileIsDirectory(p);
+  });
+}
+
+std::string cmFileSystemCache::GetRealPath(std::string const& path)
+{
+  State& state = GetState();
+  std::size_t generation;
+  {
+    Guard guard(state);
+    Entry const& entry = Lookup(state, path);
+    if (entry.HaveRealPath) {
+      ++state.Hits;
+      return entry.RealPath;
+    }
+    ++state.Misses;
+    generation = state.Generation;
+  }
+  std::string realPath = cmSystemTools::GetRealPath(path);
+  {
+    Guard guard(state);
+    if (generation == state.Generation) {
+      Entry& entry = Lookup(state, path);
+      entry.HaveRealPath = true;
+      entry.RealPath = realPath;
+    }
+  }
+  return realPath;
+}
+
+void cmFileSystemCache::Invalidate()
+{
+  State& state = GetState();
+  Guard guard(state);
+  ++state.Generation;
+  ++state.Invalidations;
+}
+
+std::size_t cmFileSystemCache::GetGeneration()
+{
+  State& state = GetState();
+  Guard guard(state);
+  return state.Generation;
+}
+
+#if !defined(CMAKE_BOOTSTRAP)
+Json::Value cmFileSystemCache::GetStatistics()
+{
+  State& state = GetState();
+  Guard guard(state);
+  Json::Value stats = Json::objectValue;
+  stats["hits"] = static_cast<Json::UInt64>(state.Hits);
+  stats["misses"] = static_cast<Json::UInt64>(state.Misses);
+  stats["invalidations"] = static_cast<Json::UInt64>(state.Invalidations);
+  return stats;
+}
+#endif
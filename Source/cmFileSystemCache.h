@@ -0,0 +1,57 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#pragma once
+
+#include "cmConfigure.h" // IWYU pragma: keep
+
+#include <cstddef>
+#include <string>
+
+#if !defined(CMAKE_BOOTSTRAP)
+#  include <cm3p/json/value.h>
+#endif
+
+/** \class cmFileSystemCache
+ * \brief Process-wide cache of file system queries.
+ *
+ * The find_* commands and the lookup of source files probe the same
+ * paths over and over during the configure and generate steps, and each
+ * probe costs a system call that may go to a network file system.  This
+ * cache remembers whether a path exists, whether it is a directory and
+ * what it resolves to, with the same results as the corresponding
+ * cmSystemTools functions.
+ *
+ * CMake must not see stale results of its own actions, so everything
+ * that writes to the file system during configure and generate, such
+ * as file(), configure_file(), generated files and child processes,
+ * calls Invalidate() to drop all cached results.  Changes made by other
+ * processes running at the same time are not noticed, just as with the
+ * directory listings of cmGlobalGenerator::GetDirectoryContent.
+ */
+class cmFileSystemCache
+{
+public:
+  /** Cached cmSystemTools::FileExists.  */
+  static bool FileExists(std::string const& path);
+  static bool FileExists(std::string const& path, bool isFile);
+
+  /** Cached cmSystemTools::FileIsDirectory.  */
+  static bool FileIsDirectory(std::string const& path);
+
+  /** Cached cmSystemTools::GetRealPath.  */
+  static std::string GetRealPath(std::string const& path);
+
+  /** Forget all cached results after the file system was modified.  */
+  static void Invalidate();
+
+  /** Get a number that changes with every call to Invalidate().  Other
+      caches of file system content may compare it to skip checking
+      whether their content is still up to date.  */
+  static std::size_t GetGeneration();
+
+#if !defined(CMAKE_BOOTSTRAP)
+  /** Hit, miss and invalidation counts for the profiling output.  Every
+      hit is a file system query that was avoided.  */
+  static Json::Value GetStatistics();
+#endif
+};
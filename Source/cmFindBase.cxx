@@ -17,6 +17,7 @@
 #include "cmCMakePath.h"
 #include "cmConfigureLog.h"
 #include "cmExecutionStatus.h"
+#include "cmFileSystemCache.h"
 #include "cmList.h"
 #include "cmListFileCache.h"
 #include "cmMakefile.h"
@@ -538,7 +539,7 @@ void cmFindBase::NormalizeFindResult()
             this->Makefile->GetCMakeInstance()->GetCMakeWorkingDirectory()))
           .Normal()
           .GenericString();
-      if (!cmSystemTools::FileExists(value, false)) {
+      if (!cmFileSystemCache::FileExists(value, false)) {
         value = *existingValue;
       }
     }
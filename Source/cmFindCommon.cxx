@@ -9,6 +9,8 @@
 #include <cmext/algorithm>
 
 #include "cmExecutionStatus.h"
+#include "cmFileSystemCache.h"
+#include "cmGlobalGenerator.h"
 #include "cmList.h"
 #include "cmMakefile.h"
 #include "cmMessageType.h"
@@ -96,6 +98,12 @@ bool cmFindCommon::DebugModeEnabled() const
   return this->FullDebugMode;
 }
 
+bool cmFindCommon::MayExist(std::string const& path) const
+{
+  return this->Makefile->GetGlobalGenerator()->MayExistInDirectoryContent(
+    path);
+}
+
 void cmFindCommon::DebugMessage(std::string const& msg) const
 {
   if (this->Makefile) {
@@ -301,8 +309,8 @@ void cmFindCommon::RerootPaths(std::vector<std::string>& paths,
 
   auto isSameDirectoryOrSubDirectory = [](std::string const& l,
                                           std::string const& r) {
-    std::string const lReal = cmSystemTools::GetRealPath(l);
-    std::string const rReal = cmSystemTools::GetRealPath(r);
+    std::string const lReal = cmFileSystemCache::GetRealPath(l);
+    std::string const rReal = cmFileSystemCache::GetRealPath(r);
     return (lReal == rReal) || cmSystemTools::IsSubDirectory(lReal, rReal);
   };
 
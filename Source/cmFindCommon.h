@@ -37,6 +37,11 @@ public:
 
   bool DebugModeEnabled() const;
 
+  /** Check whether a file may exist before querying the file system.
+      This uses the directory content indexed by the global generator,
+      which is shared by all find commands.  */
+  bool MayExist(std::string const& path) const;
+
 protected:
   friend class cmSearchPath;
   friend class cmFindBaseDebugState;
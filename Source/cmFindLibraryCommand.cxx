@@ -14,6 +14,7 @@
 #include "cmsys/RegularExpression.hxx"
 #include "cmsys/String.h"
 
+#include "cmFileSystemCache.h"
 #include "cmFindCommon.h"
 #include "cmGlobalGenerator.h"
 #include "cmList.h"
@@ -109,7 +110,7 @@ static bool cmLibDirsLinked(std::string const& l, std::string const& r)
   // to avoid excessive realpath calls.
   return (cmSystemTools::FileIsSymlink(l) ||
           cmSystemTools::FileIsSymlink(r)) &&
-    cmSystemTools::GetRealPath(l) == cmSystemTools::GetRealPath(r);
+    cmFileSystemCache::GetRealPath(l) == cmFileSystemCache::GetRealPath(r);
 }
 
 void cmFindLibraryCommand::AddArchitecturePath(
@@ -121,11 +122,11 @@ void cmFindLibraryCommand::AddArchitecturePath(
   if (pos != std::string::npos) {
     // Check for "lib".
     std::string lib = dir.substr(0, pos + 3);
-    bool use_lib = cmSystemTools::FileIsDirectory(lib);
+    bool use_lib = cmFileSystemCache::FileIsDirectory(lib);
 
     // Check for "lib<suffix>" and use it first.
     std::string libX = lib + suffix;
-    bool use_libX = cmSystemTools::FileIsDirectory(libX);
+    bool use_libX = cmFileSystemCache::FileIsDirectory(libX);
 
     // Avoid copies of the same directory due to symlinks.
     if (use_libX && use_lib && cmLibDirsLinked(libX, lib)) {
@@ -145,11 +146,11 @@ void cmFindLibraryCommand::AddArchitecturePath(
 
   if (fresh) {
     // Check for the original unchanged path.
-    bool use_dir = cmSystemTools::FileIsDirectory(dir);
+    bool use_dir = cmFileSystemCache::FileIsDirectory(dir);
 
     // Check for <dir><suffix>/ and use it first.
     std::string dirX = dir + suffix;
-    bool use_dirX = cmSystemTools::FileIsDirectory(dirX);
+    bool use_dirX = cmFileSystemCache::FileIsDirectory(dirX);
 
     // Avoid copies of the same directory due to symlinks.
     if (use_dirX && use_dir && cmLibDirsLinked(dirX, dir)) {
@@ -248,6 +249,9 @@ struct cmFindLibraryHelper
   void SetName(std::string const& name);
   bool CheckDirectory(std::string const& path);
   bool CheckDirectoryForName(std::string const& path, Name& name);
+  void CheckDirectoryIndexForName(std::string const& path,
+                                  Name const& name);
+  void CheckDirectoryContentForName(std::string const& path, Name& name);
 
   bool Validate(std::string const& path) const
   {
@@ -456,7 +460,7 @@ bool cmFindLibraryHelper::CheckDirectoryForName(std::string const& path,
   if (name.TryRaw) {
     std::string testPath = cmStrCat(path, name.Raw);
 
-    if (cmSystemTools::FileExists(testPath, true)) {
+    if (cmFileSystemCache::FileExists(testPath, true)) {
       testPath = cmSystemTools::ToNormalizedPathOnDisk(testPath);
       if (this->Validate(testPath)) {
         this->DebugLibraryFound(name.Raw, path);
@@ -468,6 +472,51 @@ bool cmFindLibraryHelper::CheckDirectoryForName(std::string const& path,
   }
 
   // No library file has yet been found.
+  if (this->IsOpenBSD) {
+    this->CheckDirectoryContentForName(path, name);
+  } else {
+    this->CheckDirectoryIndexForName(path, name);
+  }
+
+  if (this->BestPath.empty()) {
+    this->DebugLibraryFailed(name.Raw, path);
+  } else {
+    this->DebugLibraryFound(name.Raw, this->BestPath);
+  }
+
+  // Use the best candidate found in this directory, if any.
+  return !this->BestPath.empty();
+}
+
+void cmFindLibraryHelper::CheckDirectoryIndexForName(std::string const& path,
+                                                     Name const& name)
+{
+  // Without version numbers to compare, earlier prefixes are preferred,
+  // followed by earlier suffixes.  Look up the file names in that order.
+  for (std::string const& prefix : this->Prefixes) {
+    for (std::string const& suffix : this->Suffixes) {
+      std::string const* entry = this->GG->FindDirectoryEntry(
+        path, cmStrCat(prefix, name.Raw, suffix));
+      if (!entry) {
+        continue;
+      }
+      std::string testPath = cmStrCat(path, *entry);
+      // Make sure the path is readable and is not a directory.
+      if (cmFileSystemCache::FileExists(testPath, true)) {
+        testPath = cmSystemTools::ToNormalizedPathOnDisk(testPath);
+        if (this->Validate(testPath)) {
+          this->DebugLibraryFound(name.Raw, path);
+          this->BestPath = testPath;
+          return;
+        }
+      }
+    }
+  }
+}
+
+void cmFindLibraryHelper::CheckDirectoryContentForName(
+  std::string const& path, Name& name)
+{
   size_type bestPrefix = this->Prefixes.size();
   size_type bestSuffix = this->Suffixes.size();
   unsigned int bestMajor = 0;
@@ -489,7 +538,7 @@ bool cmFindLibraryHelper::CheckDirectoryForName(std::string const& path,
     if (regex.find(testName)) {
       std::string testPath = cmStrCat(path, origName);
       // Make sure the path is readable and is not a directory.
-      if (cmSystemTools::FileExists(testPath, true)) {
+      if (cmFileSystemCache::FileExists(testPath, true)) {
         testPath = cmSystemTools::ToNormalizedPathOnDisk(testPath);
         if (!this->Validate(testPath)) {
           continue;
@@ -521,15 +570,6 @@ bool cmFindLibraryHelper::CheckDirectoryForName(std::string const& path,
       }
     }
   }
-
-  if (this->BestPath.empty()) {
-    this->DebugLibraryFailed(name.Raw, path);
-  } else {
-    this->DebugLibraryFound(name.Raw, this->BestPath);
-  }
-
-  // Use the best candidate found in this directory, if any.
-  return !this->BestPath.empty();
 }
 
 std::string cmFindLibraryCommand::FindNormalLibrary()
@@ -591,7 +631,7 @@ std::string cmFindLibraryCommand::FindFrameworkLibraryNamesPerDir()
   for (std::string const& d : this->SearchPaths) {
     for (std::string const& n : this->Names) {
       fwPath = cmStrCat(d, n, ".xcframework");
-      if (cmSystemTools::FileIsDirectory(fwPath)) {
+      if (cmFileSystemCache::FileIsDirectory(fwPath)) {
         auto finalPath = cmSystemTools::ToNormalizedPathOnDisk(fwPath);
         if (this->Validate(finalPath)) {
           return finalPath;
@@ -599,7 +639,7 @@ std::string cmFindLibraryCommand::FindFrameworkLibraryNamesPerDir()
       }
 
       fwPath = cmStrCat(d, n, ".framework");
-      if (cmSystemTools::FileIsDirectory(fwPath)) {
+      if (cmFileSystemCache::FileIsDirectory(fwPath)) {
         auto finalPath = cmSystemTools::ToNormalizedPathOnDisk(fwPath);
         if (this->Validate(finalPath)) {
           return finalPath;
@@ -619,7 +659,7 @@ std::string cmFindLibraryCommand::FindFrameworkLibraryDirsPerName()
   for (std::string const& n : this->Names) {
     for (std::string const& d : this->SearchPaths) {
       fwPath = cmStrCat(d, n, ".xcframework");
-      if (cmSystemTools::FileIsDirectory(fwPath)) {
+      if (cmFileSystemCache::FileIsDirectory(fwPath)) {
         auto finalPath = cmSystemTools::ToNormalizedPathOnDisk(fwPath);
         if (this->Validate(finalPath)) {
           return finalPath;
@@ -627,7 +667,7 @@ std::string cmFindLibraryCommand::FindFrameworkLibraryDirsPerName()
       }
 
       fwPath = cmStrCat(d, n, ".framework");
-      if (cmSystemTools::FileIsDirectory(fwPath)) {
+      if (cmFileSystemCache::FileIsDirectory(fwPath)) {
         auto finalPath = cmSystemTools::ToNormalizedPathOnDisk(fwPath);
         if (this->Validate(finalPath)) {
           return finalPath;
@@ -28,6 +28,10 @@
 #include "cmDependencyProvider.h"
 #include "cmDiagnostics.h"
 #include "cmExecutionStatus.h"
+#include "cmFileSystemCache.h"
+#if !defined(CMAKE_BOOTSTRAP)
+#  include "cmFindPackageResolutionCache.h"
+#endif
 #include "cmFindPackageStack.h"
 #include "cmList.h"
 #include "cmListFileCache.h"
@@ -46,6 +50,7 @@
 #include "cmValue.h"
 #include "cmVersionMacros.h"
 #include "cmWindowsRegistry.h"
+#include "cmake.h"
 
 #if defined(__HAIKU__)
 #  include <FindDirectory.h>
@@ -195,7 +200,7 @@ public:
       }
       if (cmsysString_strcasecmp(fname.c_str(), this->DirName.data()) == 0) {
         auto candidate = cmStrCat(parent, fname, '/');
-        if (cmSystemTools::FileIsDirectory(candidate)) {
+        if (cmFileSystemCache::FileIsDirectory(candidate)) {
           return candidate;
         }
       }
@@ -405,6 +410,7 @@ bool TryGeneratedPaths(CallbackFn&& filesCollector,
                        std::string const& startPath, Generator&& gen,
                        Rest&&... tail)
 {
+  filesCollector.Visit(startPath);
   ResetGenerator(std::forward<Generator&&>(gen));
   for (auto path = gen.GetNextCandidate(startPath); !path.empty();
        path = gen.GetNextCandidate(startPath)) {
@@ -1258,9 +1264,9 @@ bool cmFindPackageCommand::FindPackage(
       }
     }
 
-    if (cmSystemTools::FileExists(
+    if (cmFileSystemCache::FileExists(
           cmStrCat(redirectsDir, '/', nameLower, "-config.cmake")) ||
-        cmSystemTools::FileExists(
+        cmFileSystemCache::FileExists(
           cmStrCat(redirectsDir, '/', overrideName, "Config.cmake"))) {
       // Force the use of this redirected config package file, regardless of
       // the type of find_package() call. Files in the redirectsDir must always
@@ -1935,6 +1941,34 @@ bool cmFindPackageCommand::FindConfig()
                                  this->Name, "'s Config module:\n");
   }
 
+#if !defined(CMAKE_BOOTSTRAP)
+  // Check the candidates of an earlier search with the same parameters
+  // again if none of the directories it looked at changed.  Otherwise,
+  // record the search.
+  cmFindPackageResolutionCache* cache = this->DebugModeEnabled()
+    ? nullptr
+    : this->Makefile->GetCMakeInstance()->GetFindPackageResolutionCache();
+  std::string cacheKey;
+  cmFindPackageResolution resolution;
+  if (cache) {
+    cacheKey = this->GetResolutionCacheKey();
+    if (auto const* candidates = cache->Find(cacheKey)) {
+      found = std::any_of(
+        candidates->begin(), candidates->end(),
+        [this](cmFindPackageResolution::Candidate const& c) -> bool {
+          if (c.Prefix) {
+            return this->SearchPrefix(c.Directory);
+          }
+          return this->CheckDirectory(
+            c.Directory, static_cast<PackageDescriptionType>(c.Type));
+        });
+    }
+    if (!found) {
+      this->Resolution = &resolution;
+    }
+  }
+#endif
+
   if (!found && this->UseCpsFiles) {
     found = this->FindEnvironmentConfig();
   }
@@ -1964,6 +1998,15 @@ bool cmFindPackageCommand::FindConfig()
     found = this->FindAppBundleConfig();
   }
 
+#if !defined(CMAKE_BOOTSTRAP)
+  if (this->Resolution) {
+    this->Resolution = nullptr;
+    if (found) {
+      cache->Insert(cacheKey, resolution);
+    }
+  }
+#endif
+
   if (this->DebugModeEnabled()) {
     if (found) {
       this->DebugBuffer = cmStrCat(
@@ -1987,6 +2030,63 @@ bool cmFindPackageCommand::FindConfig()
   return found;
 }
 
+std::string cmFindPackageCommand::GetResolutionCacheKey() const
+{
+  // Everything that selects the directories to search, the candidates in
+  // them and their order.  The version and components only select which
+  // candidate is accepted, but a search for a different version is likely
+  // to find a different package.
+  std::string key;
+  auto add = [&key](cm::string_view part) {
+    key += cmStrCat(part.size(), ':', part);
+  };
+  auto addList = [&add](std::vector<std::string> const& parts) {
+    add(std::to_string(parts.size()));
+    for (std::string const& part : parts) {
+      add(part);
+    }
+  };
+  auto addSet = [&add](std::set<std::string> const& parts) {
+    add(std::to_string(parts.size()));
+    for (std::string const& part : parts) {
+      add(part);
+    }
+  };
+
+  add(this->Name);
+  add(this->VersionComplete);
+  add(this->Components);
+  addSet(this->RequiredTargets);
+  addList(this->Names);
+  add(std::to_string(this->Configs.size()));
+  for (ConfigName const& config : this->Configs) {
+    add(config.Name);
+    add(std::to_string(static_cast<int>(config.Type)));
+  }
+  addList(this->SearchPaths);
+  addList(this->SearchPathSuffixes);
+  addSet(this->IgnoredPaths);
+  addSet(this->IgnoredPrefixPaths);
+  add(this->LibraryArchitecture);
+  if (this->UseCpsFiles) {
+    addList(cmSystemTools::GetEnvPathNormalized("CPS_PATH"));
+  }
+  bool const flags[] = {
+    this->VersionExact,         this->UseCpsFiles,
+    this->UseLib32Paths,        this->UseLib64Paths,
+    this->UseLibx32Paths,       this->UseRealPath,
+    this->SearchFrameworkFirst, this->SearchFrameworkOnly,
+    this->SearchFrameworkLast,  this->SearchAppBundleFirst,
+    this->SearchAppBundleOnly,  this->SearchAppBundleLast,
+  };
+  for (bool flag : flags) {
+    key += flag ? '1' : '0';
+  }
+  key += cmStrCat(static_cast<int>(this->SortOrder), ':',
+                  static_cast<int>(this->SortDirection));
+  return key;
+}
+
 void cmFindPackageCommand::SetConfigDirCacheVariable(std::string const& value)
 {
   std::string const help =
@@ -2906,9 +3006,16 @@ bool cmFindPackageCommand::CheckDirectory(std::string const& dir,
   }
 
   // Look for the file in this directory.
+  this->RecordSearchPath(dir);
+  std::size_t const considered = this->ConsideredConfigs.size();
   std::string file;
   FoundPackageMode foundMode = FoundPackageMode::None;
-  if (this->FindConfigFile(d, type, file, foundMode)) {
+  bool const found = this->FindConfigFile(d, type, file, foundMode);
+  if (this->ConsideredConfigs.size() != considered) {
+    // A configuration file exists in this directory.
+    this->RecordCandidate(dir, type);
+  }
+  if (found) {
     this->FileFound = std::move(file);
     this->FileFoundMode = foundMode;
     return true;
@@ -2916,6 +3023,33 @@ bool cmFindPackageCommand::CheckDirectory(std::string const& dir,
   return false;
 }
 
+void cmFindPackageCommand::RecordSearchPath(std::string const& path)
+{
+#if !defined(CMAKE_BOOTSTRAP)
+  if (this->Resolution) {
+    this->Resolution->Paths.push_back(path);
+  }
+#else
+  static_cast<void>(path);
+#endif
+}
+
+void cmFindPackageCommand::RecordCandidate(std::string const& dir,
+                                           PackageDescriptionType type)
+{
+#if !defined(CMAKE_BOOTSTRAP)
+  if (this->Resolution) {
+    cmFindPackageResolution::Candidate candidate;
+    candidate.Directory = dir;
+    candidate.Type = static_cast<unsigned int>(type);
+    this->Resolution->Candidates.emplace_back(std::move(candidate));
+  }
+#else
+  static_cast<void>(dir);
+  static_cast<void>(type);
+#endif
+}
+
 bool cmFindPackageCommand::FindConfigFile(std::string const& dir,
                                           PackageDescriptionType type,
                                           std::string& file,
@@ -2929,10 +3063,10 @@ bool cmFindPackageCommand::FindConfigFile(std::string const& dir,
     if (this->DebugModeEnabled()) {
       this->DebugBuffer = cmStrCat(this->DebugBuffer, "  ", file, '\n');
     }
-    if (cmSystemTools::FileExists(file, true)) {
+    if (this->MayExist(file) && cmFileSystemCache::FileExists(file, true)) {
       // Allow resolving symlinks when the config file is found through a link
       if (this->UseRealPath) {
-        file = cmSystemTools::GetRealPath(file);
+        file = cmFileSystemCache::GetRealPath(file);
       } else {
         file = cmSystemTools::ToNormalizedPathOnDisk(file);
       }
@@ -3127,14 +3261,14 @@ bool cmFindPackageCommand::CheckVersion(std::string const& config_file)
 
     // Look for foo-config-version.cmake
     std::string version_file = cmStrCat(version_file_base, "-version.cmake");
-    if (!haveResult && cmSystemTools::FileExists(version_file, true)) {
+    if (!haveResult && cmFileSystemCache::FileExists(version_file, true)) {
       result = this->CheckVersionFile(version_file, version);
       haveResult = true;
     }
 
     // Look for fooConfigVersion.cmake
     version_file = cmStrCat(version_file_base, "Version.cmake");
-    if (!haveResult && cmSystemTools::FileExists(version_file, true)) {
+    if (!haveResult && cmFileSystemCache::FileExists(version_file, true)) {
       result = this->CheckVersionFile(version_file, version);
       haveResult = true;
     }
@@ -3289,8 +3423,28 @@ bool cmFindPackageCommand::SearchPrefix(std::string const& prefix)
 {
   assert(!prefix.empty() && prefix.back() == '/');
 
+#if !defined(CMAKE_BOOTSTRAP)
+  // The package redirects directory is written anew on every run, so a
+  // recorded search looks at it again instead of recording its content.
+  if (this->Resolution &&
+      cm::string_view(prefix).substr(0, prefix.size() - 1) ==
+        this->Makefile->GetSafeDefinition(
+          "CMAKE_FIND_PACKAGE_REDIRECTS_DIR")) {
+    cmFindPackageResolution::Candidate candidate;
+    candidate.Directory = prefix;
+    candidate.Prefix = true;
+    this->Resolution->Candidates.emplace_back(std::move(candidate));
+    cmFindPackageResolution* resolution = this->Resolution;
+    this->Resolution = nullptr;
+    bool const found = this->SearchPrefix(prefix);
+    this->Resolution = resolution;
+    return found;
+  }
+#endif
+
   // Skip this if the prefix does not exist.
-  if (!cmSystemTools::FileIsDirectory(prefix)) {
+  this->RecordSearchPath(prefix);
+  if (!cmFileSystemCache::FileIsDirectory(prefix)) {
     return false;
   }
 
@@ -3304,10 +3458,7 @@ bool cmFindPackageCommand::SearchPrefix(std::string const& prefix)
     return false;
   }
 
-  auto searchFn = [this](std::string const& fullPath,
-                         PackageDescriptionType type) -> bool {
-    return this->SearchDirectory(fullPath, type);
-  };
+  auto searchFn = DirectorySearch{ this };
 
   auto iCpsGen = cmCaseInsensitiveDirectoryListGenerator{ "cps"_s };
   auto iCMakeGen = cmCaseInsensitiveDirectoryListGenerator{ "cmake"_s };
@@ -3457,10 +3608,7 @@ bool cmFindPackageCommand::SearchFrameworkPrefix(std::string const& prefix)
 {
   assert(!prefix.empty() && prefix.back() == '/');
 
-  auto searchFn = [this](std::string const& fullPath,
-                         PackageDescriptionType type) -> bool {
-    return this->SearchDirectory(fullPath, type);
-  };
+  auto searchFn = DirectorySearch{ this };
 
   auto iCMakeGen = cmCaseInsensitiveDirectoryListGenerator{ "cmake"_s };
   auto iCpsGen = cmCaseInsensitiveDirectoryListGenerator{ "cps"_s };
@@ -3508,10 +3656,7 @@ bool cmFindPackageCommand::SearchAppBundlePrefix(std::string const& prefix)
 {
   assert(!prefix.empty() && prefix.back() == '/');
 
-  auto searchFn = [this](std::string const& fullPath,
-                         PackageDescriptionType type) -> bool {
-    return this->SearchDirectory(fullPath, type);
-  };
+  auto searchFn = DirectorySearch{ this };
 
   auto appGen = cmMacProjectDirectoryListGenerator{ &this->Names, ".app"_s };
   auto crGen = cmAppendPathSegmentGenerator{ "Contents/Resources"_s };
@@ -3538,14 +3683,12 @@ bool cmFindPackageCommand::SearchEnvironmentPrefix(std::string const& prefix)
   assert(!prefix.empty() && prefix.back() == '/');
 
   // Skip this if the prefix does not exist.
-  if (!cmSystemTools::FileIsDirectory(prefix)) {
+  this->RecordSearchPath(prefix);
+  if (!cmFileSystemCache::FileIsDirectory(prefix)) {
     return false;
   }
 
-  auto searchFn = [this](std::string const& fullPath,
-                         PackageDescriptionType type) -> bool {
-    return this->SearchDirectory(fullPath, type);
-  };
+  auto searchFn = DirectorySearch{ this };
 
   auto pkgDirGen =
     cmProjectDirectoryListGenerator{ &this->Names, this->SortOrder,
@@ -40,6 +40,7 @@ class cmExecutionStatus;
 class cmPackageState;
 class cmSearchPath;
 class cmPackageInformation;
+struct cmFindPackageResolution;
 
 /** \class cmFindPackageCommand
  * \brief Load settings from an external project.
@@ -207,6 +208,9 @@ private:
                                  cmSearchPath& outPaths);
   bool SearchDirectory(std::string const& dir, PackageDescriptionType type);
   bool CheckDirectory(std::string const& dir, PackageDescriptionType type);
+  void RecordSearchPath(std::string const& path);
+  void RecordCandidate(std::string const& dir, PackageDescriptionType type);
+  std::string GetResolutionCacheKey() const;
   bool FindConfigFile(std::string const& dir, PackageDescriptionType type,
                       std::string& file, FoundPackageMode& foundMode);
   bool CheckVersion(std::string const& config_file);
@@ -219,6 +223,29 @@ private:
 
   bool IsRequired() const;
 
+  // Search the directories produced by the path generators and record
+  // every directory that the generators look at.
+  class DirectorySearch
+  {
+  public:
+    DirectorySearch(cmFindPackageCommand* command)
+      : Command(command)
+    {
+    }
+
+    bool operator()(std::string const& dir, PackageDescriptionType type) const
+    {
+      return this->Command->SearchDirectory(dir, type);
+    }
+    void Visit(std::string const& dir) const
+    {
+      this->Command->RecordSearchPath(dir);
+    }
+
+  private:
+    cmFindPackageCommand* Command;
+  };
+
   struct OriginalDef
   {
     bool exists;
@@ -285,6 +312,8 @@ private:
   std::set<std::string> RequiredTargets;
   std::string DebugBuffer;
   std::shared_ptr<cmPackageInformation> PackageInfo;
+  // The search recorded for the find_package resolution cache, if any.
+  cmFindPackageResolution* Resolution = nullptr;
 
   enum class SearchResult
   {
@@ -0,0 +1,338 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#include "cmFindPackageResolutionCache.h"
+
+#include <cstdint>
+#include <ctime>
+#include <ios>
+#include <iterator>
+#include <unordered_set>
+#include <utility>
+
+#include <cm/string_view>
+#include <cmext/string_view>
+
+#include "cmsys/FStream.hxx"
+
+#include "cmFileSystemCache.h"
+#include "cmGeneratedFileStream.h"
+#include "cmStringAlgorithms.h"
+#include "cmSystemTools.h"
+#include "cmVersion.h"
+
+namespace {
+
+// Increment this whenever the layout of the cache file changes.
+std::uint32_t const FormatVersion = 1;
+cm::string_view const Magic = "CMFPRC\n"_s;
+
+bool ReadFileContent(std::string const& path, std::string& content)
+{
+  cmsys::ifstream fin(path.c_str(), std::ios::in | std::ios::binary);
+  if (!fin) {
+    return false;
+  }
+  content.assign(std::istreambuf_iterator<char>(fin),
+                 std::istreambuf_iterator<char>());
+  return !fin.bad();
+}
+
+class Writer
+{
+public:
+  void U64(std::uint64_t v)
+  {
+    for (int i = 0; i < 8; ++i) {
+      this->Data += static_cast<char>((v >> (8 * i)) & 0xff);
+    }
+  }
+  void I64(std::int64_t v) { this->U64(static_cast<std::uint64_t>(v)); }
+  void String(cm::string_view s)
+  {
+    this->U64(s.size());
+    this->Data.append(s.data(), s.size());
+  }
+
+  std::string Data;
+};
+
+class Reader
+{
+public:
+  Reader(std::string const& data)
+    : Data(data)
+  {
+  }
+
+  bool U64(std::uint64_t& v)
+  {
+    if (this->Data.size() - this->Pos < 8) {
+      return false;
+    }
+    v = 0;
+    for (int i = 0; i < 8; ++i) {
+      v |= static_cast<std::uint64_t>(
+             static_cast<unsigned char>(this->Data[this->Pos++]))
+        << (8 * i);
+    }
+    return true;
+  }
+  bool I64(std::int64_t& v)
+  {
+    std::uint64_t u;
+    if (!this->U64(u)) {
+      return false;
+    }
+    v = static_cast<std::int64_t>(u);
+    return true;
+  }
+  bool String(std::string& s)
+  {
+    std::uint64_t n;
+    if (!this->U64(n) || this->Data.size() - this->Pos < n) {
+      return false;
+    }
+    s.assign(this->Data, this->Pos, static_cast<std::size_t>(n));
+    this->Pos += static_cast<std::size_t>(n);
+    return true;
+  }
+  bool AtEnd() const { return this->Pos == this->Data.size(); }
+
+private:
+  std::string const& Data;
+  std::size_t Pos = 0;
+};
+}
+
+cmFindPackageResolutionCache::cmFindPackageResolutionCache(
+  std::string const& binaryDir)
+  : FilePath(cmStrCat(binaryDir, "/.cmake/FindPackageResolutionCache.bin"))
+{
+}
+
+long cmFindPackageResolutionCache::GetCurrentTime(std::size_t path)
+{
+  // Directories cannot change unless CMake modified the file system since
+  // they were checked, or some other process did so meanwhile.
+  PathInfo& info = this->Paths[path];
+  std::size_t const generation = cmFileSystemCache::GetGeneration();
+  if (info.Generation != generation) {
+    info.Generation = generation;
+    info.CurrentTime = cmSystemTools::ModifiedTime(info.Path);
+  }
+  return info.CurrentTime;
+}
+
+std::size_t cmFindPackageResolutionCache::GetPathIndex(std::string const& path)
+{
+  auto it = this->PathIndex.find(path);
+  if (it != this->PathIndex.end()) {
+    return it->second;
+  }
+  std::size_t const index = this->Paths.size();
+  PathInfo info;
+  info.Path = path;
+  this->Paths.emplace_back(std::move(info));
+  this->PathIndex.emplace(path, index);
+  return index;
+}
+
+std::vector<cmFindPackageResolutionCache::Candidate> const*
+cmFindPackageResolutionCache::Find(std::string const& key)
+{
+  auto it = this->Entries.find(key);
+  if (it == this->Entries.end()) {
+    ++this->Misses;
+    return nullptr;
+  }
+  for (auto const& t : it->second.Times) {
+    if (this->GetCurrentTime(t.first) != t.second) {
+      ++this->Misses;
+      return nullptr;
+    }
+  }
+  ++this->Hits;
+  it->second.Used = true;
+  return &it->second.Candidates;
+}
+
+void cmFindPackageResolutionCache::Insert(
+  std::string const& key, cmFindPackageResolution const& resolution)
+{
+  // A directory modified within the last second may be modified again
+  // without a change of its time stamp.
+  long const racy = static_cast<long>(std::time(nullptr)) - 1;
+
+  Entry entry;
+  std::unordered_set<std::size_t> seen;
+  for (std::string const& p : resolution.Paths) {
+    std::size_t const index = this->GetPathIndex(p);
+    if (!seen.insert(index).second) {
+      continue;
+    }
+    long const mtime = this->GetCurrentTime(index);
+    if (mtime >= racy) {
+      this->Entries.erase(key);
+      return;
+    }
+    entry.Times.emplace_back(index, mtime);
+  }
+  entry.Candidates = resolution.Candidates;
+  entry.Used = true;
+  this->Entries[key] = std::move(entry);
+  this->Modified = true;
+}
+
+void cmFindPackageResolutionCache::Load()
+{
+  std::string data;
+  if (!ReadFileContent(this->FilePath, data)) {
+    return;
+  }
+
+  // A cache written by a different version of CMake, or one that is
+  // truncated or otherwise malformed, is discarded as a whole.
+  Reader in(data);
+  std::string magic;
+  std::uint64_t version;
+  std::string cmakeVersion;
+  std::uint64_t nPaths;
+  if (!in.String(magic) || cm::string_view(magic) != Magic ||
+      !in.U64(version) || version != FormatVersion ||
+      !in.String(cmakeVersion) ||
+      cmakeVersion != cmVersion::GetCMakeVersion() || !in.U64(nPaths)) {
+    return;
+  }
+
+  std::vector<std::string> paths;
+  for (std::uint64_t p = 0; p < nPaths; ++p) {
+    std::string path;
+    if (!in.String(path)) {
+      return;
+    }
+    paths.emplace_back(std::move(path));
+  }
+
+  std::uint64_t nEntries;
+  if (!in.U64(nEntries)) {
+    return;
+  }
+  std::unordered_map<std::string, Entry> entries;
+  for (std::uint64_t e = 0; e < nEntries; ++e) {
+    std::string key;
+    std::uint64_t nTimes;
+    if (!in.String(key) || !in.U64(nTimes)) {
+      return;
+    }
+    Entry entry;
+    for (std::uint64_t t = 0; t < nTimes; ++t) {
+      std::uint64_t index;
+      std::int64_t mtime;
+      if (!in.U64(index) || index >= nPaths || !in.I64(mtime)) {
+        return;
+      }
+      entry.Times.emplace_back(static_cast<std::size_t>(index),
+                               static_cast<long>(mtime));
+    }
+    std::uint64_t nCandidates;
+    if (!in.U64(nCandidates)) {
+      return;
+    }
+    for (std::uint64_t c = 0; c < nCandidates; ++c) {
+      Candidate candidate;
+      std::uint64_t type;
+      std::uint64_t prefix;
+      if (!in.String(candidate.Directory) || !in.U64(type) ||
+          !in.U64(prefix)) {
+        return;
+      }
+      candidate.Type = static_cast<unsigned int>(type);
+      candidate.Prefix = prefix != 0;
+      entry.Candidates.emplace_back(std::move(candidate));
+    }
+    entries.emplace(std::move(key), std::move(entry));
+  }
+  if (!in.AtEnd()) {
+    return;
+  }
+
+  std::vector<std::size_t> indices;
+  for (std::string const& path : paths) {
+    indices.push_back(this->GetPathIndex(path));
+  }
+  for (auto& e : entries) {
+    for (auto& t : e.second.Times) {
+      t.first = indices[t.first];
+    }
+  }
+  this->Entries = std::move(entries);
+}
+
+bool cmFindPackageResolutionCache::Save()
+{
+  std::uint64_t nEntries = 0;
+  for (auto const& e : this->Entries) {
+    if (e.second.Used) {
+      ++nEntries;
+    }
+  }
+  if (!this->Modified && nEntries == this->Entries.size()) {
+    return true;
+  }
+
+  // Write only the directories of the entries that are kept.
+  std::vector<std::size_t> renumbered(this->Paths.size(), 0);
+  std::vector<std::string const*> paths;
+  for (auto const& e : this->Entries) {
+    if (!e.second.Used) {
+      continue;
+    }
+    for (auto const& t : e.second.Times) {
+      if (renumbered[t.first] == 0) {
+        paths.push_back(&this->Paths[t.first].Path);
+        renumbered[t.first] = paths.size();
+      }
+    }
+  }
+
+  Writer out;
+  out.String(Magic);
+  out.U64(FormatVersion);
+  out.String(cmVersion::GetCMakeVersion());
+  out.U64(paths.size());
+  for (std::string const* path : paths) {
+    out.String(*path);
+  }
+  out.U64(nEntries);
+  for (auto const& e : this->Entries) {
+    if (!e.second.Used) {
+      continue;
+    }
+    out.String(e.first);
+    out.U64(e.second.Times.size());
+    for (auto const& t : e.second.Times) {
+      out.U64(renumbered[t.first] - 1);
+      out.I64(t.second);
+    }
+    out.U64(e.second.Candidates.size());
+    for (Candidate const& c : e.second.Candidates) {
+      out.String(c.Directory);
+      out.U64(c.Type);
+      out.U64(c.Prefix ? 1 : 0);
+    }
+  }
+
+  cmSystemTools::MakeDirectory(cmSystemTools::GetFilenamePath(this->FilePath));
+  cmGeneratedFileStream fout;
+  fout.Open(this->FilePath, true, true);
+  fout.write(out.Data.data(), static_cast<std::streamsize>(out.Data.size()));
+  return fout.Close();
+}
+
+Json::Value cmFindPackageResolutionCache::GetStatistics() const
+{
+  Json::Value stats = Json::objectValue;
+  stats["hits"] = static_cast<Json::UInt64>(this->Hits);
+  stats["misses"] = static_cast<Json::UInt64>(this->Misses);
+  return stats;
+}
@@ -0,0 +1,118 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#pragma once
+
+#include "cmConfigure.h" // IWYU pragma: keep
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cm3p/json/value.h>
+
+/** The directories one find_package search looked at and the
+    directories with candidate package configuration files that it found,
+    in search order.  */
+struct cmFindPackageResolution
+{
+  struct Candidate
+  {
+    std::string Directory;
+    unsigned int Type = 0;
+    // The directory is a prefix whose content is not recorded and that
+    // is searched again instead.
+    bool Prefix = false;
+  };
+
+  std::vector<std::string> Paths;
+  std::vector<Candidate> Candidates;
+};
+
+/** \class cmFindPackageResolutionCache
+ * \brief Persist the config file searches of find_package across runs.
+ *
+ * A find_package search walks many directory patterns below every
+ * prefix and evaluates the version file of every candidate it finds.
+ * This cache stores, for a search that succeeded, the directories that
+ * contain candidate package configuration files in the order the search
+ * visited them, together with the modification times of all directories
+ * that the search looked at.  The cache file lives in the .cmake
+ * directory of the build tree, so it survives deleting CMakeCache.txt
+ * and the CMakeFiles directory.
+ *
+ * An entry is only used while none of the recorded directories has
+ * changed.  Then the search would visit the same candidates again, so
+ * checking them again in order gives the same result without the walk.
+ * The candidates are checked as usual, so version files are evaluated
+ * with the variables of the current run.
+ */
+class cmFindPackageResolutionCache
+{
+public:
+  using Candidate = cmFindPackageResolution::Candidate;
+
+  cmFindPackageResolutionCache(std::string const& binaryDir);
+
+  cmFindPackageResolutionCache(cmFindPackageResolutionCache const&) = delete;
+  cmFindPackageResolutionCache& operator=(
+    cmFindPackageResolutionCache const&) = delete;
+
+  /**
+   * @brief Look up the candidates of a search.
+   * @return nullptr if no entry exists or any of its recorded directories
+   *         changed since it was recorded.
+   */
+  std::vector<Candidate> const* Find(std::string const& key);
+
+  /**
+   * @brief Record the result of a search.
+   *
+   * The entry is not recorded if any of the directories was modified too
+   * recently for a later modification to be noticed.
+   */
+  void Insert(std::string const& key,
+              cmFindPackageResolution const& resolution);
+
+  /** Read the cache file from the build tree, if any.  */
+  void Load();
+
+  /**
+   * @brief Write the cache file to the build tree.
+   *
+   * Only entries that were used or inserted since the cache was loaded
+   * are written.
+   */
+  bool Save();
+
+  /** Hit and miss counts for the profiling output.  */
+  Json::Value GetStatistics() const;
+
+private:
+  // The modification time of a directory, or 0 if it does not exist.
+  long GetCurrentTime(std::size_t path);
+  std::size_t GetPathIndex(std::string const& path);
+
+  struct PathInfo
+  {
+    std::string Path;
+    long CurrentTime = 0;
+    std::size_t Generation = 0;
+  };
+
+  struct Entry
+  {
+    std::vector<std::pair<std::size_t, long>> Times;
+    std::vector<Candidate> Candidates;
+    bool Used = false;
+  };
+
+  std::string FilePath;
+  std::vector<PathInfo> Paths;
+  std::unordered_map<std::string, std::size_t> PathIndex;
+  std::unordered_map<std::string, Entry> Entries;
+  unsigned long Hits = 0;
+  unsigned long Misses = 0;
+  bool Modified = false;
+};
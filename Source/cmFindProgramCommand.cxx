@@ -8,6 +8,7 @@
 #include <cm/memory>
 #include <cmext/string_view>
 
+#include "cmFileSystemCache.h"
 #include "cmFindCommon.h"
 #include "cmMakefile.h"
 #include "cmPolicies.h"
@@ -92,7 +93,8 @@ struct cmFindProgramHelper
                          std::string testNameExt = cmStrCat(name, ext);
                          std::string testPath =
                            cmSystemTools::CollapseFullPath(testNameExt, path);
-                         if (this->FileIsExecutable(testPath)) {
+                         if (this->FindBase->MayExist(testPath) &&
+                             this->FileIsExecutable(testPath)) {
                            testPath =
                              cmSystemTools::ToNormalizedPathOnDisk(testPath);
                            if (this->FindBase->Validate(testPath)) {
@@ -131,13 +133,13 @@ struct cmFindProgramHelper
   {
     switch (this->PolicyCMP0109) {
       case cmPolicies::OLD:
-        return cmSystemTools::FileExists(file, true);
+        return cmFileSystemCache::FileExists(file, true);
       case cmPolicies::NEW:
         return cmSystemTools::FileIsExecutable(file);
       default:
         break;
     }
-    bool const isExeOld = cmSystemTools::FileExists(file, true);
+    bool const isExeOld = cmFileSystemCache::FileExists(file, true);
     bool const isExeNew = cmSystemTools::FileIsExecutable(file);
     if (isExeNew == isExeOld) {
       return isExeNew;
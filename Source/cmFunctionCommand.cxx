@@ -2,7 +2,9 @@
    file LICENSE.rst or https://cmake.org/licensing for details.  */
 #include "cmFunctionCommand.h"
 
+#include <cstddef>
 #include <functional>
+#include <memory>
 #include <utility>
 
 #include <cm/memory>
@@ -10,6 +12,7 @@
 #include <cmext/algorithm>
 #include <cmext/string_view>
 
+#include "cmDefinitions.h"
 #include "cmDiagnostics.h"
 #include "cmExecutionStatus.h"
 #include "cmFunctionBlocker.h"
@@ -19,11 +22,14 @@
 #include "cmPolicies.h"
 #include "cmRange.h"
 #include "cmState.h"
+#include "cmStateSnapshot.h"
 #include "cmStateTypes.h"
 #include "cmStringAlgorithms.h"
 #include "cmSystemTools.h"
+#include "cmVariableWatch.h"
 
 namespace {
+std::string const ARG = "ARG";
 std::string const ARGC = "ARGC";
 std::string const ARGNC = "ARGNC";
 std::string const ARGN = "ARGN";
@@ -36,6 +42,109 @@ std::string const CMAKE_CURRENT_FUNCTION_LIST_DIR =
 std::string const CMAKE_CURRENT_FUNCTION_LIST_LINE =
   "CMAKE_CURRENT_FUNCTION_LIST_LINE";
 
+// provide the ARG* variables of a function call from its arguments
+class cmFunctionArguments : public cmLazyDefinitions
+{
+public:
+  cmFunctionArguments(std::vector<std::string> args, std::size_t formalCount)
+    : Args(std::move(args))
+    , FormalCount(formalCount)
+  {
+  }
+
+  bool Has(std::string const& key) const override
+  {
+    std::size_t index;
+    return this->Classify(key, index) != Kind::None;
+  }
+
+  bool Compute(std::string const& key, std::string& value) const override
+  {
+    std::size_t index = 0;
+    switch (this->Classify(key, index)) {
+      case Kind::None:
+        return false;
+      case Kind::Argc:
+        value = std::to_string(this->Args.size());
+        break;
+      case Kind::Argv:
+        value = cmList::to_string(this->Args);
+        break;
+      case Kind::Argn:
+        value = cmList::to_string(
+          cmMakeRange(this->Args.begin() + this->FormalCount,
+                      this->Args.end()));
+        break;
+      case Kind::Argnc:
+        value = std::to_string(this->Args.size() - this->FormalCount);
+        break;
+      case Kind::ArgvN:
+        value = this->Args[index];
+        break;
+    }
+    return true;
+  }
+
+  void AppendKeys(std::vector<std::string>& keys) const override
+  {
+    keys.reserve(keys.size() + this->Args.size() + 4);
+    keys.push_back(ARGC);
+    for (auto t = 0u; t < this->Args.size(); ++t) {
+      keys.push_back(cmStrCat(ARGV, t));
+    }
+    keys.push_back(ARGV);
+    keys.push_back(ARGN);
+    keys.push_back(ARGNC);
+  }
+
+private:
+  enum class Kind
+  {
+    None,
+    Argc,
+    Argv,
+    Argn,
+    Argnc,
+    ArgvN,
+  };
+
+  Kind Classify(std::string const& key, std::size_t& index) const
+  {
+    if (!cmHasPrefix(key, ARG)) {
+      return Kind::None;
+    }
+    if (key == ARGC) {
+      return Kind::Argc;
+    }
+    if (key == ARGV) {
+      return Kind::Argv;
+    }
+    if (key == ARGN) {
+      return Kind::Argn;
+    }
+    if (key == ARGNC) {
+      return Kind::Argnc;
+    }
+    // Match the names ARGV0 ARGV1 ... exactly as they would be formatted.
+    cm::string_view const digits = cm::string_view(key).substr(4);
+    if (!cmHasPrefix(key, ARGV) || digits.empty() || digits.size() > 9 ||
+        (digits.size() > 1 && digits.front() == '0')) {
+      return Kind::None;
+    }
+    index = 0;
+    for (char c : digits) {
+      if (c < '0' || c > '9') {
+        return Kind::None;
+      }
+      index = index * 10 + static_cast<std::size_t>(c - '0');
+    }
+    return index < this->Args.size() ? Kind::ArgvN : Kind::None;
+  }
+
+  std::vector<std::string> Args;
+  std::size_t FormalCount;
+};
+
 // define the class for function commands
 class cmFunctionHelperCommand
 {
@@ -78,35 +187,60 @@ bool cmFunctionHelperCommand::operator()(
   cmMakefile::FunctionPushPop functionScope(&makefile, this->FilePath,
                                             this->Policies, this->Diagnostics);
 
-  // set the value of argc
-  makefile.AddDefinition(ARGC, std::to_string(expandedArgs.size()));
-  makefile.MarkVariableAsUsed(ARGC);
+  // Define the argument variables on demand unless they are watched.
+#ifndef CMAKE_BOOTSTRAP
+  cmVariableWatch* vv = makefile.GetVariableWatch();
+  bool const bindLazily = !vv || !vv->HasWatchWithPrefix(ARG);
+#else
+  bool const bindLazily = true;
+#endif
 
-  // set the values for ARGV0 ARGV1 ...
-  for (auto t = 0u; t < expandedArgs.size(); ++t) {
-    auto const value = cmStrCat(ARGV, t);
-    makefile.AddDefinition(value, expandedArgs[t]);
-    makefile.MarkVariableAsUsed(value);
-  }
+  if (bindLazily) {
+    // define the formal arguments, except those shadowed by ARGV, ARGN,
+    // and ARGNC below
+    for (auto j = 1u; j < this->Args.size(); ++j) {
+      if (this->Args[j] != ARGV && this->Args[j] != ARGN &&
+          this->Args[j] != ARGNC) {
+        makefile.AddDefinition(this->Args[j], expandedArgs[j - 1]);
+      }
+    }
 
-  // define the formal arguments
-  for (auto j = 1u; j < this->Args.size(); ++j) {
-    makefile.AddDefinition(this->Args[j], expandedArgs[j - 1]);
-  }
+    // ARGC, ARGV0 ARGV1 ..., ARGV, ARGN, and ARGNC are computed from the
+    // expanded arguments when the function body first reads them
+    makefile.GetStateSnapshot().SetLazyDefinitions(
+      std::make_shared<cmFunctionArguments>(std::move(expandedArgs),
+                                            this->Args.size() - 1));
+  } else {
+    // set the value of argc
+    makefile.AddDefinition(ARGC, std::to_string(expandedArgs.size()));
+    makefile.MarkVariableAsUsed(ARGC);
+
+    // set the values for ARGV0 ARGV1 ...
+    for (auto t = 0u; t < expandedArgs.size(); ++t) {
+      auto const value = cmStrCat(ARGV, t);
+      makefile.AddDefinition(value, expandedArgs[t]);
+      makefile.MarkVariableAsUsed(value);
+    }
+
+    // define the formal arguments
+    for (auto j = 1u; j < this->Args.size(); ++j) {
+      makefile.AddDefinition(this->Args[j], expandedArgs[j - 1]);
+    }
 
-  // define ARGV, ARGN, and ARGNC
-  auto const argvDef = cmList::to_string(expandedArgs);
-  auto const expIt = expandedArgs.begin() + (this->Args.size() - 1);
-  auto const argnDef =
-    cmList::to_string(cmMakeRange(expIt, expandedArgs.end()));
-  auto const functionArgncDef =
-    std::to_string(expandedArgs.size() - (this->Args.size() - 1));
-  makefile.AddDefinition(ARGV, argvDef);
-  makefile.MarkVariableAsUsed(ARGV);
-  makefile.AddDefinition(ARGN, argnDef);
-  makefile.MarkVariableAsUsed(ARGN);
-  makefile.AddDefinition(ARGNC, functionArgncDef);
-  makefile.MarkVariableAsUsed(ARGNC);
+    // define ARGV, ARGN, and ARGNC
+    auto const argvDef = cmList::to_string(expandedArgs);
+    auto const expIt = expandedArgs.begin() + (this->Args.size() - 1);
+    auto const argnDef =
+      cmList::to_string(cmMakeRange(expIt, expandedArgs.end()));
+    auto const functionArgncDef =
+      std::to_string(expandedArgs.size() - (this->Args.size() - 1));
+    makefile.AddDefinition(ARGV, argvDef);
+    makefile.MarkVariableAsUsed(ARGV);
+    makefile.AddDefinition(ARGN, argnDef);
+    makefile.MarkVariableAsUsed(ARGN);
+    makefile.AddDefinition(ARGNC, functionArgncDef);
+    makefile.MarkVariableAsUsed(ARGNC);
+  }
 
   makefile.AddDefinition(CMAKE_CURRENT_FUNCTION, this->Args.front());
   makefile.MarkVariableAsUsed(CMAKE_CURRENT_FUNCTION);
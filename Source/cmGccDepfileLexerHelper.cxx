@@ -3,37 +3,205 @@
 #include "cmGccDepfileLexerHelper.h"
 
 #include <algorithm>
-#include <cstdio>
+#include <cstddef>
+#include <iterator>
 #include <string>
 #include <vector>
 
-#include "cmGccDepfileReaderTypes.h"
-#include "cmSystemTools.h"
+#include <cmext/string_view>
+
+#include "cmsys/FStream.hxx"
 
-#include "LexerParser/cmGccDepfileLexer.h"
+#include "cmGccDepfileReaderTypes.h"
+#include "cmMappedFile.h"
+#include "cmStringAlgorithms.h"
 
 #ifdef _WIN32
 #  include "cmsys/String.h"
 #endif
 
+namespace {
+// Characters that always stand for themselves.
+class PlainChars
+{
+public:
+  PlainChars()
+  {
+    for (unsigned int c = 0; c < 256; ++c) {
+      this->Table[c] = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+        (c >= '0' && c <= '9') || c >= 0x80;
+    }
+    for (unsigned char c : "+,/_.~(){}%=@[]!-"_s) {
+      this->Table[c] = true;
+    }
+  }
+
+  bool operator()(char c) const
+  {
+    return this->Table[static_cast<unsigned char>(c)];
+  }
+
+private:
+  bool Table[256];
+};
+
+PlainChars const IsPlain;
+
+// The length of the newline starting at p, if any.
+std::size_t NewlineLength(char const* p, char const* end)
+{
+  if (p != end && *p == '\n') {
+    return 1;
+  }
+  if (p != end && *p == '\r' && p + 1 != end && p[1] == '\n') {
+    return 2;
+  }
+  return 0;
+}
+}
+
 bool cmGccDepfileLexerHelper::readFile(char const* filePath)
 {
-  FILE* file = cmsys::SystemTools::Fopen(filePath, "rb");
-  if (!file) {
-    return false;
+  cmMappedFile file(filePath);
+  char const* data = file.GetData();
+  std::size_t size = file.GetSize();
+  std::string content;
+  if (!data) {
+    // The file is empty or cannot be mapped.
+    cmsys::ifstream fin(filePath, std::ios::in | std::ios::binary);
+    if (!fin) {
+      return false;
+    }
+    content.assign(std::istreambuf_iterator<char>(fin),
+                   std::istreambuf_iterator<char>());
+    data = content.data();
+    size = content.size();
   }
   this->newEntry();
-  yyscan_t scanner;
-  cmGccDepfile_yylex_init(&scanner);
-  cmGccDepfile_yyset_extra(this, scanner);
-  cmGccDepfile_yyrestart(file, scanner);
-  cmGccDepfile_yylex(scanner);
-  cmGccDepfile_yylex_destroy(scanner);
+  this->scan(data, data + size);
   this->sanitizeContent();
-  fclose(file);
   return this->HelperState != State::Failed;
 }
 
+void cmGccDepfileLexerHelper::scan(char const* p, char const* const end)
+{
+  while (p != end) {
+    if (IsPlain(*p)) {
+      // Got a span of plain text.
+      char const* q = p + 1;
+      while (q != end && IsPlain(*q)) {
+        ++q;
+      }
+      this->addToCurrentPath(
+        cm::string_view(p, static_cast<std::size_t>(q - p)));
+      p = q;
+      continue;
+    }
+    switch (*p) {
+      case '$':
+        // Unescape the dollar sign.
+        this->addToCurrentPath("$"_s);
+        p += (p + 1 != end && p[1] == '$') ? 2 : 1;
+        continue;
+      case '\\': {
+        char const* q = p + 1;
+        while (q != end && *q == '\\') {
+          ++q;
+        }
+        std::size_t const n = static_cast<std::size_t>(q - p);
+        if (q != end && *q == ' ') {
+          if (n % 2 == 1) {
+            // 2N+1 backslashes plus space -> N backslashes plus space.
+            this->addToCurrentPath(cmStrCat(std::string(n / 2, '\\'), ' '));
+          } else {
+            // 2N backslashes plus space -> 2N backslashes, end of filename.
+            this->addToCurrentPath(cm::string_view(p, n));
+            this->newDependency();
+          }
+          p = q + 1;
+          continue;
+        }
+        // Only the last backslash may escape what follows.
+        this->addToCurrentPath(cm::string_view(p, n - 1));
+        std::size_t const nl = NewlineLength(q, end);
+        if (nl != 0) {
+          // A line continuation ends the current file name.
+          this->newRuleOrDependency();
+          p = q + nl;
+        } else if (q != end && (*q == '#' || *q == ':')) {
+          // Unescape the hash or colon.
+          this->addToCurrentPath(cm::string_view(q, 1));
+          p = q + 1;
+        } else {
+          this->addToCurrentPath("\\"_s);
+          p = q;
+        }
+        continue;
+      }
+      case ' ':
+      case '\t':
+        // Rules and dependencies are separated by blocks of whitespace.
+        // A line continuation after them ends the file name again, which
+        // has no further effect.
+        while (p != end && (*p == ' ' || *p == '\t')) {
+          ++p;
+        }
+        this->newRuleOrDependency();
+        continue;
+      case ':': {
+        char const* q = p + 1;
+        std::size_t nl = NewlineLength(q, end);
+        if (nl != 0) {
+          // A colon ends the rules.
+          this->newDependency();
+          // A newline after colon terminates current rule.
+          this->newEntry();
+          p = q + nl;
+          continue;
+        }
+        if (q != end && (*q == ' ' || *q == '\t')) {
+          // A colon followed by space ends the rules and starts a new
+          // dependency.
+          while (q != end && (*q == ' ' || *q == '\t')) {
+            ++q;
+          }
+          this->newDependency();
+          p = q;
+          continue;
+        }
+        if (q != end && *q == '\\') {
+          nl = NewlineLength(q + 1, end);
+          if (nl != 0) {
+            // A colon followed by a line continuation does the same.
+            this->newDependency();
+            p = q + 1 + nl;
+            continue;
+          }
+        }
+      } break;
+      case '\n':
+      case '\r': {
+        std::size_t const nl = NewlineLength(p, end);
+        if (nl != 0) {
+          // A newline ends the current file name and the current rule.
+          this->newEntry();
+          p += nl;
+          continue;
+        }
+      } break;
+      case '\0':
+        // Not part of a file name.
+        ++p;
+        continue;
+      default:
+        break;
+    }
+    // Got an otherwise unmatched character.
+    this->addToCurrentPath(cm::string_view(p, 1));
+    ++p;
+  }
+}
+
 void cmGccDepfileLexerHelper::newEntry()
 {
   if (this->HelperState == State::Rule && !this->Content.empty()) {
@@ -77,7 +245,7 @@ void cmGccDepfileLexerHelper::newRuleOrDependency()
   }
 }
 
-void cmGccDepfileLexerHelper::addToCurrentPath(char const* s)
+void cmGccDepfileLexerHelper::addToCurrentPath(cm::string_view s)
 {
   if (this->Content.empty()) {
     return;
@@ -100,7 +268,7 @@ void cmGccDepfileLexerHelper::addToCurrentPath(char const* s)
     case State::Failed:
       return;
   }
-  dst->append(s);
+  dst->append(s.data(), s.size());
 }
 
 void cmGccDepfileLexerHelper::sanitizeContent()
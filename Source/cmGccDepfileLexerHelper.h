@@ -4,6 +4,8 @@
 
 #include <utility>
 
+#include <cm/string_view>
+
 #include <cmGccDepfileReaderTypes.h>
 
 class cmGccDepfileLexerHelper
@@ -14,14 +16,17 @@ public:
   bool readFile(char const* filePath);
   cmGccDepfileContent extractContent() && { return std::move(this->Content); }
 
-  // Functions called by the lexer
+private:
+  // Scan the content of a depfile in place.
+  void scan(char const* p, char const* end);
+
+  // Functions called by the scanner
   void newEntry();
   void newRule();
   void newDependency();
   void newRuleOrDependency();
-  void addToCurrentPath(char const* s);
+  void addToCurrentPath(cm::string_view s);
 
-private:
   void sanitizeContent();
 
   cmGccDepfileContent Content;
@@ -34,5 +39,3 @@ private:
   };
   State HelperState = State::Rule;
 };
-
-#define YY_EXTRA_TYPE cmGccDepfileLexerHelper*
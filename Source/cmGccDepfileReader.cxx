@@ -2,15 +2,59 @@
    file LICENSE.rst or https://cmake.org/licensing for details.  */
 #include "cmGccDepfileReader.h"
 
+#include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include <cm/optional>
+#include <cm/string_view>
+#include <cmext/string_view>
 
 #include "cmGccDepfileLexerHelper.h"
 #include "cmStringAlgorithms.h"
 #include "cmSystemTools.h"
 
+namespace {
+// Collapse full paths, reusing the work for files in the same directory.
+// Depfiles typically name thousands of files in a few hundred directories.
+class PathCollapser
+{
+public:
+  void Collapse(std::string& path)
+  {
+    std::string::size_type const slash = path.rfind('/');
+    if (slash == std::string::npos || slash == 0 || path[slash - 1] == '/') {
+      path = cmSystemTools::CollapseFullPath(path);
+      return;
+    }
+    cm::string_view const name(path.data() + slash + 1,
+                               path.size() - slash - 1);
+    if (name.empty() || name == "."_s || name == ".."_s ||
+        name.find('\\') != cm::string_view::npos) {
+      path = cmSystemTools::CollapseFullPath(path);
+      return;
+    }
+    std::string dir = path.substr(0, slash);
+    auto i = this->Directories.find(dir);
+    if (i == this->Directories.end()) {
+      std::string collapsed = cmSystemTools::CollapseFullPath(dir);
+      i = this->Directories.emplace(std::move(dir), std::move(collapsed))
+            .first;
+    }
+    std::string const& collapsed = i->second;
+    if (!collapsed.empty() && collapsed.back() == '/') {
+      path = cmStrCat(collapsed, name);
+    } else {
+      path = cmStrCat(collapsed, '/', name);
+    }
+  }
+
+private:
+  std::unordered_map<std::string, std::string> Directories;
+};
+}
+
 cm::optional<cmGccDepfileContent> cmReadGccDepfile(
   char const* filePath, std::string const& prefix,
   GccDepfilePrependPaths prependPaths)
@@ -21,6 +65,7 @@ cm::optional<cmGccDepfileContent> cmReadGccDepfile(
   }
   auto deps = cm::make_optional(std::move(helper).extractContent());
 
+  PathCollapser collapser;
   for (auto& dep : *deps) {
     for (auto& rule : dep.rules) {
       if (prependPaths == GccDepfilePrependPaths::All && !prefix.empty() &&
@@ -28,7 +73,7 @@ cm::optional<cmGccDepfileContent> cmReadGccDepfile(
         rule = cmStrCat(prefix, '/', rule);
       }
       if (cmSystemTools::FileIsFullPath(rule)) {
-        rule = cmSystemTools::CollapseFullPath(rule);
+        collapser.Collapse(rule);
       }
       cmSystemTools::ConvertToLongPath(rule);
     }
@@ -37,7 +82,7 @@ cm::optional<cmGccDepfileContent> cmReadGccDepfile(
         path = cmStrCat(prefix, '/', path);
       }
       if (cmSystemTools::FileIsFullPath(path)) {
-        path = cmSystemTools::CollapseFullPath(path);
+        collapser.Collapse(path);
       }
       cmSystemTools::ConvertToLongPath(path);
     }
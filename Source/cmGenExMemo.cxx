@@ -0,0 +1,111 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#include "cmGenExMemo.h"
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "cmGeneratorExpressionLexer.h"
+#include "cmGeneratorExpressionParser.h"
+
+namespace cm {
+namespace GenEx {
+
+bool Memo::Key::operator==(Key const& r) const
+{
+  return this->LG == r.LG && this->HeadTarget == r.HeadTarget &&
+    this->CurrentTarget == r.CurrentTarget && this->CMP0189 == r.CMP0189 &&
+    this->EvaluateForBuildsystem == r.EvaluateForBuildsystem &&
+    this->Quiet == r.Quiet && this->Input == r.Input &&
+    this->Config == r.Config && this->Language == r.Language;
+}
+
+std::size_t Memo::KeyHash::operator()(Key const& key) const
+{
+  std::size_t h = std::hash<std::string>()(key.Input);
+  auto combine = [&h](std::size_t v) {
+    h ^= v + 0x9e3779b9 + (h << 6) + (h >> 2);
+  };
+  combine(std::hash<cmLocalGenerator const*>()(key.LG));
+  combine(std::hash<std::string>()(key.Config));
+  combine(std::hash<std::string>()(key.Language));
+  combine(std::hash<cmGeneratorTarget const*>()(key.HeadTarget));
+  combine(std::hash<cmGeneratorTarget const*>()(key.CurrentTarget));
+  combine(static_cast<std::size_t>(key.CMP0189) << 2 |
+          static_cast<std::size_t>(key.EvaluateForBuildsystem) << 1 |
+          static_cast<std::size_t>(key.Quiet));
+  return h;
+}
+
+std::shared_ptr<ParsedExpression const> Memo::Parse(std::string const& input)
+{
+  auto it = this->Parsed.find(input);
+  if (it != this->Parsed.end()) {
+    ++this->ParseHits;
+    return it->second;
+  }
+  ++this->ParseMisses;
+
+  auto parsed = std::make_shared<ParsedExpression>();
+  parsed->Input = input;
+  cmGeneratorExpressionLexer l;
+  std::vector<cmGeneratorExpressionToken> tokens = l.Tokenize(parsed->Input);
+  parsed->NeedsEvaluation = l.GetSawGeneratorExpression();
+  if (parsed->NeedsEvaluation) {
+    cmGeneratorExpressionParser p(tokens);
+    p.Parse(parsed->Evaluators);
+  }
+
+  std::shared_ptr<ParsedExpression const> result = std::move(parsed);
+  this->Parsed.emplace(input, result);
+  return result;
+}
+
+void Memo::SetEvaluationEnabled(bool enabled)
+{
+  this->EvaluationEnabled = enabled;
+  if (!enabled) {
+    this->Results.clear();
+  }
+}
+
+Memo::Result const* Memo::Find(Key const& key)
+{
+  auto it = this->Results.find(key);
+  if (it == this->Results.end()) {
+    ++this->EvaluationMisses;
+    return nullptr;
+  }
+  ++this->EvaluationHits;
+  return &it->second;
+}
+
+void Memo::Store(Key key, Result result)
+{
+  this->Results.emplace(std::move(key), std::move(result));
+}
+
+void Memo::Invalidate()
+{
+  if (!this->Results.empty()) {
+    this->Results.clear();
+    ++this->Invalidations;
+  }
+}
+
+#if !defined(CMAKE_BOOTSTRAP)
+Json::Value Memo::GetStatistics() const
+{
+  Json::Value stats = Json::objectValue;
+  stats["parse_hits"] = static_cast<Json::UInt64>(this->ParseHits);
+  stats["parse_misses"] = static_cast<Json::UInt64>(this->ParseMisses);
+  stats["eval_hits"] = static_cast<Json::UInt64>(this->EvaluationHits);
+  stats["eval_misses"] = static_cast<Json::UInt64>(this->EvaluationMisses);
+  stats["invalidations"] = static_cast<Json::UInt64>(this->Invalidations);
+  return stats;
+}
+#endif
+
+}
+}
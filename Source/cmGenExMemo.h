@@ -0,0 +1,131 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#pragma once
+
+#include "cmConfigure.h" // IWYU pragma: keep
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+#include "cmGeneratorExpressionEvaluator.h"
+#include "cmPolicies.h"
+
+#if !defined(CMAKE_BOOTSTRAP)
+#  include <cm3p/json/value.h>
+#endif
+
+class cmGeneratorTarget;
+class cmLocalGenerator;
+
+namespace cm {
+namespace GenEx {
+
+/** The parsed form of a generator expression.  */
+struct ParsedExpression
+{
+  // The evaluators point into this copy of the input.
+  std::string Input;
+  cmGeneratorExpressionEvaluatorVector Evaluators;
+  bool NeedsEvaluation = false;
+};
+
+/** \class Memo
+ * \brief Memoize parsing and evaluation of generator expressions.
+ *
+ * Parsing a generator expression depends only on its text, so parsed
+ * expressions are shared by all cmCompiledGeneratorExpression instances
+ * with the same input.  This avoids parsing the INTERFACE_* properties
+ * of a target again for every consumer.
+ *
+ * During the generate step, the results of top-level evaluations are
+ * memoized too.  Such an evaluation depends only on the expression, the
+ * local generator, the configuration, the language, and the head and
+ * current targets, as long as no property, variable or target that it
+ * may read is changed.  Any such change invalidates all results.
+ * Source file properties reach generator expressions only through the
+ * per-target source and object lists, which cmGeneratorTarget caches
+ * on its own and invalidates with ClearSourcesCache.
+ * Evaluations below a DAG checker also depend on the properties being
+ * evaluated further up and are never memoized.
+ */
+class Memo
+{
+public:
+  Memo() = default;
+  Memo(Memo const&) = delete;
+  Memo& operator=(Memo const&) = delete;
+
+  struct Key
+  {
+    std::string Input;
+    cmLocalGenerator const* LG = nullptr;
+    std::string Config;
+    std::string Language;
+    cmPolicies::PolicyStatus CMP0189 = cmPolicies::WARN;
+    cmGeneratorTarget const* HeadTarget = nullptr;
+    cmGeneratorTarget const* CurrentTarget = nullptr;
+    bool EvaluateForBuildsystem = false;
+    bool Quiet = false;
+
+    bool operator==(Key const& r) const;
+  };
+
+  struct Result
+  {
+    std::string Output;
+    std::set<cmGeneratorTarget*> DependTargets;
+    std::set<cmGeneratorTarget const*> AllTargets;
+    std::set<std::string> SeenTargetProperties;
+    std::set<cmGeneratorTarget const*> SourceSensitiveTargets;
+    std::map<cmGeneratorTarget const*, std::map<std::string, std::string>>
+      MaxLanguageStandard;
+    bool HadContextSensitiveCondition = false;
+    bool HadHeadSensitiveCondition = false;
+    bool HadLinkLanguageSensitiveCondition = false;
+  };
+
+  /** Get the parsed form of an expression.  */
+  std::shared_ptr<ParsedExpression const> Parse(std::string const& input);
+
+  /** Enable or disable memoizing evaluation results.  */
+  void SetEvaluationEnabled(bool enabled);
+  bool IsEvaluationEnabled() const { return this->EvaluationEnabled; }
+
+  /** Look up the result of an earlier evaluation.  */
+  Result const* Find(Key const& key);
+
+  /** Record the result of an evaluation.  */
+  void Store(Key key, Result result);
+
+  /** Drop all evaluation results after a change of their inputs.  */
+  void Invalidate();
+
+#if !defined(CMAKE_BOOTSTRAP)
+  /** Hit and miss counts for the profiling output.  */
+  Json::Value GetStatistics() const;
+#endif
+
+private:
+  struct KeyHash
+  {
+    std::size_t operator()(Key const& key) const;
+  };
+
+  std::unordered_map<std::string, std::shared_ptr<ParsedExpression const>>
+    Parsed;
+  std::unordered_map<Key, Result, KeyHash> Results;
+  bool EvaluationEnabled = false;
+
+  std::size_t ParseHits = 0;
+  std::size_t ParseMisses = 0;
+  std::size_t EvaluationHits = 0;
+  std::size_t EvaluationMisses = 0;
+  std::size_t Invalidations = 0;
+};
+
+}
+}
@@ -5,6 +5,7 @@
 #include <cstdio>
 #include <locale>
 
+#include "cmFileSystemCache.h"
 #include "cmStringAlgorithms.h"
 #include "cmSystemTools.h"
 
@@ -177,6 +178,7 @@ bool cmGeneratedFileStreamBase::Close()
     }
 
     replaced = true;
+    cmFileSystemCache::Invalidate();
   }
 
   // Else, the destination was not replaced.
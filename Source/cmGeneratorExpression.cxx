@@ -15,15 +15,15 @@
 
 #include "cmGenExContext.h"
 #include "cmGenExEvaluation.h"
+#include "cmGenExMemo.h"
 #include "cmGeneratorExpressionDAGChecker.h"
 #include "cmGeneratorExpressionEvaluator.h"
-#include "cmGeneratorExpressionLexer.h"
-#include "cmGeneratorExpressionParser.h"
 #include "cmGeneratorTarget.h"
 #include "cmList.h"
 #include "cmLocalGenerator.h"
 #include "cmMakefile.h"
 #include "cmMessageType.h"
+#include "cmMessenger.h"
 #include "cmStringAlgorithms.h"
 #include "cmSystemTools.h"
 #include "cmake.h"
@@ -85,13 +85,49 @@ std::string const& cmCompiledGeneratorExpression::Evaluate(
                              currentTarget ? currentTarget : headTarget,
                              this->EvaluateForBuildsystem, this->Backtrace);
 
-  if (!this->NeedsEvaluation) {
+  if (!this->Parsed->NeedsEvaluation) {
     return this->Input;
   }
 
+  // Evaluations below a DAG checker depend on the properties evaluated
+  // further up, and bound operands are not part of the memo key.
+  cmake* cm = context.LG->GetCMakeInstance();
+  cm::GenEx::Memo& memo = cm->GetGenExMemo();
+  bool const memoize = memo.IsEvaluationEnabled() && !dagChecker &&
+    context.BoundOperandCount() == 0;
+  cm::GenEx::Memo::Key key;
+  if (memoize) {
+    key.Input = this->Input;
+    key.LG = eval.Context.LG;
+    key.Config = eval.Context.Config;
+    key.Language = eval.Context.Language;
+    key.CMP0189 = eval.Context.GetCMP0189();
+    key.HeadTarget = eval.HeadTarget;
+    key.CurrentTarget = eval.CurrentTarget;
+    key.EvaluateForBuildsystem = eval.EvaluateForBuildsystem;
+    key.Quiet = eval.Quiet;
+    if (cm::GenEx::Memo::Result const* result = memo.Find(key)) {
+      this->Output = result->Output;
+      this->SeenTargetProperties.insert(result->SeenTargetProperties.cbegin(),
+                                        result->SeenTargetProperties.cend());
+      this->MaxLanguageStandard = result->MaxLanguageStandard;
+      this->HadContextSensitiveCondition =
+        result->HadContextSensitiveCondition;
+      this->HadHeadSensitiveCondition = result->HadHeadSensitiveCondition;
+      this->HadLinkLanguageSensitiveCondition =
+        result->HadLinkLanguageSensitiveCondition;
+      this->SourceSensitiveTargets = result->SourceSensitiveTargets;
+      this->DependTargets = result->DependTargets;
+      this->AllTargetsSeen = result->AllTargets;
+      return this->Output;
+    }
+  }
+  std::size_t const messages =
+    cm->GetMessenger()->GetDisplayedMessages().size();
+
   this->Output.clear();
 
-  for (auto const& it : this->Evaluators) {
+  for (auto const& it : this->Parsed->Evaluators) {
     this->Output += it->Evaluate(&eval, dagChecker);
 
     this->SeenTargetProperties.insert(eval.SeenTargetProperties.cbegin(),
@@ -114,6 +150,24 @@ std::string const& cmCompiledGeneratorExpression::Evaluate(
 
   this->DependTargets = eval.DependTargets;
   this->AllTargetsSeen = eval.AllTargets;
+
+  // Do not memoize evaluations that issued diagnostics, so that they
+  // are issued again by the next evaluation.
+  if (memoize && !eval.HadError &&
+      cm->GetMessenger()->GetDisplayedMessages().size() == messages) {
+    cm::GenEx::Memo::Result result;
+    result.Output = this->Output;
+    result.DependTargets = std::move(eval.DependTargets);
+    result.AllTargets = std::move(eval.AllTargets);
+    result.SeenTargetProperties = std::move(eval.SeenTargetProperties);
+    result.SourceSensitiveTargets = std::move(eval.SourceSensitiveTargets);
+    result.MaxLanguageStandard = std::move(eval.MaxLanguageStandard);
+    result.HadContextSensitiveCondition = eval.HadContextSensitiveCondition;
+    result.HadHeadSensitiveCondition = eval.HadHeadSensitiveCondition;
+    result.HadLinkLanguageSensitiveCondition =
+      eval.HadLinkLanguageSensitiveCondition;
+    memo.Store(std::move(key), std::move(result));
+  }
   return this->Output;
 }
 
@@ -127,14 +181,7 @@ cmCompiledGeneratorExpression::cmCompiledGeneratorExpression(
     cmakeInstance.CreateProfilingEntry("genex_compile", this->Input);
 #endif
 
-  cmGeneratorExpressionLexer l;
-  std::vector<cmGeneratorExpressionToken> tokens = l.Tokenize(this->Input);
-  this->NeedsEvaluation = l.GetSawGeneratorExpression();
-
-  if (this->NeedsEvaluation) {
-    cmGeneratorExpressionParser p(tokens);
-    p.Parse(this->Evaluators);
-  }
+  this->Parsed = cmakeInstance.GetGenExMemo().Parse(this->Input);
 }
 
 std::string cmGeneratorExpression::StripEmptyListElements(
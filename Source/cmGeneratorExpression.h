@@ -19,6 +19,7 @@
 namespace cm {
 namespace GenEx {
 struct Context;
+struct ParsedExpression;
 }
 }
 
@@ -181,9 +182,8 @@ private:
   friend class cmGeneratorExpression;
 
   cmListFileBacktrace Backtrace;
-  std::vector<std::unique_ptr<cmGeneratorExpressionEvaluator>> Evaluators;
+  std::shared_ptr<cm::GenEx::ParsedExpression const> Parsed;
   std::string const Input;
-  bool NeedsEvaluation;
   bool EvaluateForBuildsystem = false;
   bool Quiet = false;
 
@@ -31,6 +31,7 @@
 #include "cmFileSetMetadata.h"
 #include "cmFileTimes.h"
 #include "cmGenExContext.h"
+#include "cmGenExMemo.h"
 #include "cmGeneratedFileStream.h"
 #include "cmGeneratorExpression.h"
 #include "cmGeneratorExpressionDAGChecker.h"
@@ -534,6 +535,7 @@ cmValue cmGeneratorTarget::GetFileSuffixInternal(
 
 void cmGeneratorTarget::ClearSourcesCache()
 {
+  this->GetLocalGenerator()->GetCMakeInstance()->GetGenExMemo().Invalidate();
   this->AllConfigSources.clear();
   this->AllConfigCompileLanguages.clear();
   this->KindedSourcesMap.clear();
@@ -558,6 +560,7 @@ void cmGeneratorTarget::ClearSourcesCache()
 
 void cmGeneratorTarget::ClearLinkInterfaceCache()
 {
+  this->GetLocalGenerator()->GetCMakeInstance()->GetGenExMemo().Invalidate();
   this->LinkInterfaceMap.clear();
   this->LinkInterfaceUsageRequirementsOnlyMap.clear();
 }
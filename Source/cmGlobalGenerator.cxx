@@ -7,6 +7,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <ctime>
 #include <functional>
 #include <initializer_list>
 #include <iterator>
@@ -40,6 +41,8 @@
 #include "cmExperimental.h"
 #include "cmExportBuildFileGenerator.h"
 #include "cmExternalMakefileProjectGenerator.h"
+#include "cmFileSystemCache.h"
+#include "cmGenExMemo.h"
 #include "cmGeneratedFileStream.h"
 #include "cmGeneratorExpression.h"
 #include "cmGeneratorTarget.h"
@@ -73,10 +76,14 @@
 #include "cmake.h"
 
 #if !defined(CMAKE_BOOTSTRAP)
+#  include <thread>
+
 #  include <cm3p/json/value.h>
 #  include <cm3p/json/writer.h>
 
+#  include "cmLanguageSetupCache.h"
 #  include "cmQtAutoGenGlobalInitializer.h"
+#  include "cmWorkerPool.h"
 #endif
 
 std::string const kCMAKE_PLATFORM_INFO_INITIALIZED =
@@ -102,6 +109,61 @@ std::string GeneratedMakeCommand::QuotedPrintable() const
 }
 }
 
+#if !defined(CMAKE_BOOTSTRAP)
+namespace {
+// Build one deferred test project like cmGlobalGenerator::Build does.
+class DeferredTryCompileJob : public cmWorkerPool::JobT
+{
+public:
+  DeferredTryCompileJob(cmDeferredTryCompile& tc)
+    : TryCompile(tc)
+  {
+  }
+
+  void Process() override
+  {
+    cmDeferredTryCompile& tc = this->TryCompile;
+    tc.Output = cmStrCat("Change Dir: '", tc.BinaryDirectory,
+                         "'\n\nRun Build Command(s): ");
+    tc.Result = 0;
+    for (auto command = tc.Commands.begin();
+         command != tc.Commands.end() && tc.Result == 0; ++command) {
+      std::string commandStr = command->QuotedPrintable();
+      if ((command + 1) != tc.Commands.end()) {
+        commandStr += " && ";
+      }
+      tc.Output = cmStrCat(std::move(tc.Output), commandStr, '\n');
+
+      cmWorkerPool::ProcessResultT result;
+      if (!this->RunProcess(result, command->PrimaryCommand,
+                            tc.BinaryDirectory) &&
+          !result.ErrorMessage.empty()) {
+        tc.Output = cmStrCat(
+          std::move(tc.Output), result.StdOut,
+          "\nGenerator: build tool execution failed, command was: ",
+          commandStr, '\n');
+        tc.Result = 1;
+        return;
+      }
+      tc.Output += result.StdOut;
+      tc.Result =
+        result.TermSignal != 0 ? 1 : static_cast<int>(result.ExitStatus);
+    }
+    tc.Output += '\n';
+  }
+
+private:
+  cmDeferredTryCompile& TryCompile;
+};
+
+class DeferredTryCompileEndJob : public cmWorkerPool::JobFenceT
+{
+public:
+  void Process() override { this->Pool()->Abort(); }
+};
+}
+#endif
+
 bool cmTarget::StrictTargetComparison::operator()(cmTarget const* t1,
                                                   cmTarget const* t2) const
 {
@@ -832,6 +894,71 @@ void cmGlobalGenerator::EnableLanguage(
     return;
   }
 
+  bool loaded = false;
+#if !defined(CMAKE_BOOTSTRAP)
+  // Reuse the setup of an earlier test project that started from the
+  // same state.  Only a first setup of the languages is considered.
+  if (this->LanguageSetupCache &&
+      std::none_of(languages.begin(), languages.end(),
+                   [this](std::string const& lang) {
+                     return lang != "NONE" && this->GetLanguageEnabled(lang);
+                   })) {
+    cmLanguageSetupCache::Setup setup(*this->LanguageSetupCache, languages,
+                                      optional, mf);
+    if (setup.Replay()) {
+      for (std::string const& lang : languages) {
+        if (lang == "NONE") {
+          this->SetLanguageEnabled("NONE", mf);
+          continue;
+        }
+        this->SetLanguageEnabledFlag(lang, mf);
+        this->SetLanguageEnabledMaps(lang, mf);
+        this->LanguagesReadyForTryCompile.insert(lang);
+      }
+    } else {
+      if (!this->LoadLanguageInformation(languages, mf, rootBin, optional,
+                                         fatalError)) {
+        return;
+      }
+      setup.Record();
+    }
+    loaded = true;
+  }
+#endif
+  if (!loaded &&
+      !this->LoadLanguageInformation(languages, mf, rootBin, optional,
+                                     fatalError)) {
+    return;
+  }
+
+  // Now load files that can override any settings on the platform or for
+  // the project First load the project compatibility file if it is in
+  // cmake
+  std::string projectCompatibility =
+    cmStrCat(cmSystemTools::GetCMakeRoot(), "/Modules/",
+             mf->GetSafeDefinition("PROJECT_NAME"), "Compatibility.cmake");
+  if (cmSystemTools::FileExists(projectCompatibility)) {
+    mf->ReadListFile(projectCompatibility);
+  }
+  // Inform any extra generator of the new language.
+  if (this->ExtraGenerator) {
+    this->ExtraGenerator->EnableLanguage(languages, mf, false);
+  }
+
+  if (fatalError) {
+    cmSystemTools::SetFatalErrorOccurred();
+  }
+
+  for (std::string const& lang : cur_languages) {
+    this->LanguagesInProgress.erase(lang);
+  }
+}
+
+bool cmGlobalGenerator::LoadLanguageInformation(
+  std::vector<std::string> const& languages, cmMakefile* mf,
+  std::string const& rootBin, bool optional, bool& fatalError)
+{
+  std::string fpath;
   // **** Load the system specific initialization if not yet loaded
   if (!mf->GetDefinition("CMAKE_SYSTEM_SPECIFIC_INITIALIZE_LOADED")) {
     fpath = mf->GetModulesFile("CMakeSystemSpecificInitialize.cmake");
@@ -856,7 +983,7 @@ void cmGlobalGenerator::EnableLanguage(
       mf->IssueMessage(MessageType::FATAL_ERROR,
                        "Experimental Rust support is not enabled.");
       cmSystemTools::SetFatalErrorOccurred();
-      return;
+      return false;
     }
 
     if (lang == "NONE") {
@@ -904,7 +1031,7 @@ void cmGlobalGenerator::EnableLanguage(
           cmStrCat("Could not find cmake module file: ", determineCompiler));
       }
       if (cmSystemTools::GetFatalErrorOccurred()) {
-        return;
+        return false;
       }
       needTestLanguage[lang] = true;
       // Some generators like visual studio should not use the env variables
@@ -1087,28 +1214,7 @@ void cmGlobalGenerator::EnableLanguage(
     // Translate compiler ids for compatibility.
     this->CheckCompilerIdCompatibility(mf, lang);
   } // end for each language
-
-  // Now load files that can override any settings on the platform or for
-  // the project First load the project compatibility file if it is in
-  // cmake
-  std::string projectCompatibility =
-    cmStrCat(cmSystemTools::GetCMakeRoot(), "/Modules/",
-             mf->GetSafeDefinition("PROJECT_NAME"), "Compatibility.cmake");
-  if (cmSystemTools::FileExists(projectCompatibility)) {
-    mf->ReadListFile(projectCompatibility);
-  }
-  // Inform any extra generator of the new language.
-  if (this->ExtraGenerator) {
-    this->ExtraGenerator->EnableLanguage(languages, mf, false);
-  }
-
-  if (fatalError) {
-    cmSystemTools::SetFatalErrorOccurred();
-  }
-
-  for (std::string const& lang : cur_languages) {
-    this->LanguagesInProgress.erase(lang);
-  }
+  return true;
 }
 
 void cmGlobalGenerator::PrintCompilerAdvice(std::ostream& os,
@@ -1460,6 +1566,7 @@ void cmGlobalGenerator::Configure()
 
   // now do it
   dirMf->Configure();
+  this->WaitForDeferredTryCompiles();
   dirMf->EnforceDirectoryLevelRules();
 
   // Put a copy of each global target in every directory.
@@ -1641,6 +1748,11 @@ bool cmGlobalGenerator::Compute()
     }
   }
 
+  this->CommandHelper.clear();
+  if (this->Makefiles[0]->IsOn("CMAKE_COMMAND_HELPER")) {
+    this->CommandHelper = cmSystemTools::GetCMCmdHelperCommand();
+  }
+
   // Some generators track files replaced during the Generate.
   // Start with an empty vector:
   this->FilesReplacedDuringGenerate.clear();
@@ -2513,7 +2625,8 @@ void cmGlobalGenerator::CheckTargetProperties()
 int cmGlobalGenerator::TryCompile(int jobs, std::string const& bindir,
                                   std::string const& projectName,
                                   std::string const& target, bool fast,
-                                  std::string& output, cmMakefile* mf)
+                                  std::string& output, cmMakefile* mf,
+                                  cmDeferredTryCompile* deferred)
 {
   cmBuildArgs buildArgs;
   buildArgs.jobs = jobs;
@@ -2547,6 +2660,21 @@ int cmGlobalGenerator::TryCompile(int jobs, std::string const& bindir,
     mf->GetSafeDefinition("CMAKE_TRY_COMPILE_CONFIGURATION");
   cmBuildOptions defaultBuildOptions(false, fast, PackageResolveMode::Disable);
 
+#if !defined(CMAKE_BOOTSTRAP)
+  if (deferred) {
+    if (config.empty()) {
+      config = this->GetDefaultBuildConfig();
+    }
+    deferred->BinaryDirectory = bindir;
+    deferred->Commands = this->GenerateBuildCommand(
+      "", projectName, bindir, newTarget, config, jobs, buildArgs.verbose,
+      defaultBuildOptions, {}, BuildTryCompile::Yes);
+    return 0;
+  }
+#else
+  static_cast<void>(deferred);
+#endif
+
   std::stringstream ostr;
   auto ret = this->Build(buildArgs, newTarget, ostr, "", config,
                          defaultBuildOptions, this->TryCompileTimeout,
@@ -2555,6 +2683,63 @@ int cmGlobalGenerator::TryCompile(int jobs, std::string const& bindir,
   return ret;
 }
 
+void cmGlobalGenerator::DeferTryCompile(
+  std::unique_ptr<cmDeferredTryCompile> tc)
+{
+  this->DeferredTryCompiles.emplace_back(std::move(tc));
+}
+
+bool cmGlobalGenerator::IsTryCompileDeferred(std::string const& bindir) const
+{
+  return std::any_of(
+    this->DeferredTryCompiles.begin(), this->DeferredTryCompiles.end(),
+    [&bindir](std::unique_ptr<cmDeferredTryCompile> const& tc) {
+      return tc->BinaryDirectory == bindir;
+    });
+}
+
+void cmGlobalGenerator::WaitForDeferredTryCompiles()
+{
+  if (this->DeferredTryCompiles.empty()) {
+    return;
+  }
+  std::vector<std::unique_ptr<cmDeferredTryCompile>> deferred;
+  deferred.swap(this->DeferredTryCompiles);
+
+#if !defined(CMAKE_BOOTSTRAP)
+  {
+    // See cmMakefile::TryCompile.
+    cm::optional<cmSystemTools::ScopedEnv> maybeNinjaStatus;
+    if (this->IsNinja()) {
+      maybeNinjaStatus.emplace("NINJA_STATUS=");
+    }
+
+    unsigned int threads = std::thread::hardware_concurrency();
+    if (threads == 0 || threads > deferred.size()) {
+      threads = static_cast<unsigned int>(deferred.size());
+    }
+    cmWorkerPool pool;
+    pool.SetThreadCount(threads);
+    for (auto& tc : deferred) {
+      pool.EmplaceJob<DeferredTryCompileJob>(*tc);
+    }
+    pool.EmplaceJob<DeferredTryCompileEndJob>();
+    pool.Process();
+  }
+#endif
+
+  // The OpenWatcom tools do not return an error code when a link
+  // library is not found!
+  bool isWatcomWMake = this->CMakeInstance->GetState()->UseWatcomWMake();
+  for (auto& tc : deferred) {
+    if (isWatcomWMake && tc->Result == 0 &&
+        tc->Output.find("W1008: cannot open") != std::string::npos) {
+      tc->Result = 1;
+    }
+    tc->Finish(*tc);
+  }
+}
+
 std::vector<cmGlobalGenerator::GeneratedMakeCommand>
 cmGlobalGenerator::GenerateBuildCommand(
   std::string const& /*unused*/, std::string const& /*unused*/,
@@ -2804,6 +2989,14 @@ void cmGlobalGenerator::SetupTryCompile(cmGlobalGenerator* gen, cmMakefile* mf)
   this->GetCMakeInstance()->AddCacheEntry(
     "CMAKE_MAKE_PROGRAM", make, "make program", cmStateEnums::FILEPATH);
   this->LanguagesReadyForTryCompile = gen->LanguagesReadyForTryCompile;
+#if !defined(CMAKE_BOOTSTRAP)
+  if (mf->IsOn("CMAKE_TRY_COMPILE_REUSE_LANGUAGE_SETUP")) {
+    if (!gen->LanguageSetupCache) {
+      gen->LanguageSetupCache = std::make_shared<cmLanguageSetupCache>();
+    }
+    this->LanguageSetupCache = gen->LanguageSetupCache;
+  }
+#endif
 }
 
 void cmGlobalGenerator::SetConfiguredFilesPath(cmGlobalGenerator* gen)
@@ -2957,6 +3150,8 @@ void cmGlobalGenerator::IndexTarget(cmTarget* t)
 
 void cmGlobalGenerator::IndexGeneratorTarget(cmGeneratorTarget* gt)
 {
+  // Memoized results of $<TARGET_EXISTS> and similar are now stale.
+  this->CMakeInstance->GetGenExMemo().Invalidate();
   if (!gt->IsImported() || gt->IsImportedGloballyVisible()) {
     this->GeneratorTargetSearchIndex[gt->GetName()] = gt;
   }
@@ -3967,33 +4162,100 @@ void cmGlobalGenerator::AddToManifest(std::string const& f)
   DirectoryContent& dc = this->DirectoryContentMap[dir];
   dc.Generated.insert(file);
   dc.All.insert(file);
+  dc.Indexed = false;
 }
 
 std::set<std::string> const& cmGlobalGenerator::GetDirectoryContent(
   std::string const& dir, bool needDisk)
 {
-  DirectoryContent& dc = this->DirectoryContentMap[dir];
   if (needDisk) {
-    long mt = cmSystemTools::ModifiedTime(dir);
-    if (mt != dc.LastDiskTime) {
-      // Reset to non-loaded directory content.
-      dc.All = dc.Generated;
-
-      // Load the directory content from disk.
-      cmsys::Directory d;
-      if (d.Load(dir)) {
-        unsigned long n = d.GetNumberOfFiles();
-        for (unsigned long i = 0; i < n; ++i) {
-          std::string const& f = d.GetFileName(i);
-          if (f != "." && f != "..") {
-            dc.All.insert(f);
-          }
+    return this->LoadDirectoryContent(dir).All;
+  }
+  return this->DirectoryContentMap[dir].All;
+}
+
+cmGlobalGenerator::DirectoryContent& cmGlobalGenerator::LoadDirectoryContent(
+  std::string const& dir)
+{
+  DirectoryContent& dc = this->DirectoryContentMap[dir];
+
+  // The directory cannot have changed unless CMake modified the file
+  // system since the last check.
+  std::size_t const generation = cmFileSystemCache::GetGeneration();
+  if (dc.Generation == generation) {
+    return dc;
+  }
+  dc.Generation = generation;
+
+  long mt = cmSystemTools::ModifiedTime(dir);
+  if (mt != dc.LastDiskTime || dc.Racy) {
+    // Reset to non-loaded directory content.
+    dc.All = dc.Generated;
+    dc.Indexed = false;
+
+    // Load the directory content from disk.
+    cmsys::Directory d;
+    if (d.Load(dir)) {
+      unsigned long n = d.GetNumberOfFiles();
+      for (unsigned long i = 0; i < n; ++i) {
+        std::string const& f = d.GetFileName(i);
+        if (f != "." && f != "..") {
+          dc.All.insert(f);
         }
       }
-      dc.LastDiskTime = mt;
+      dc.Complete = true;
+    } else {
+      // A directory that does not exist has no content.
+      dc.Complete = !cmFileSystemCache::FileIsDirectory(dir);
+    }
+    dc.LastDiskTime = mt;
+    dc.Racy = mt >= static_cast<long>(time(nullptr)) - 1;
+  }
+  return dc;
+}
+
+std::string const* cmGlobalGenerator::FindDirectoryEntry(
+  std::string const& dir, std::string const& name)
+{
+  DirectoryContent& dc = this->LoadDirectoryContent(dir);
+  if (!dc.Indexed) {
+    dc.Case = cmSystemTools::GetDirCase(dir).value_or(
+      cmSystemTools::DirCase::Sensitive);
+    dc.Index.clear();
+    dc.Index.reserve(dc.All.size());
+    for (std::string const& f : dc.All) {
+      dc.Index.emplace(dc.Case == cmSystemTools::DirCase::Insensitive
+                         ? cmSystemTools::LowerCase(f)
+                         : f,
+                       &f);
     }
+    dc.Indexed = true;
+  }
+  auto i = dc.Index.find(dc.Case == cmSystemTools::DirCase::Insensitive
+                           ? cmSystemTools::LowerCase(name)
+                           : name);
+  return i != dc.Index.end() ? i->second : nullptr;
+}
+
+bool cmGlobalGenerator::MayExistInDirectoryContent(std::string const& path)
+{
+  std::string const dir = cmSystemTools::GetFilenamePath(path);
+  std::string const name = cmSystemTools::GetFilenameName(path);
+  if (dir.empty() || name.empty() || name == "." || name == "..") {
+    return true;
+  }
+#ifdef _WIN32
+  // Windows also finds files by their short names and ignores trailing
+  // dots and spaces.
+  if (name.find('~') != std::string::npos || name.back() == '.' ||
+      name.back() == ' ') {
+    return true;
+  }
+#endif
+  if (!this->LoadDirectoryContent(dir).Complete) {
+    return true;
   }
-  return dc.All;
+  return this->FindDirectoryEntry(dir, name) != nullptr;
 }
 
 void cmGlobalGenerator::AddRuleHash(std::vector<std::string> const& outputs,
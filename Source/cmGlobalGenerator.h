@@ -51,6 +51,7 @@ enum class cmDepfileFormat;
 enum class codecvt_Encoding;
 
 class cmBuildArgs;
+struct cmDeferredTryCompile;
 class cmDirectoryId;
 class cmExportBuildFileGenerator;
 class cmExternalMakefileProjectGenerator;
@@ -58,6 +59,7 @@ class cmBuildSbomGenerator;
 class cmInstallSbomGenerator;
 class cmGeneratorTarget;
 class cmInstallRuntimeDependencySet;
+class cmLanguageSetupCache;
 class cmLinkLineComputer;
 class cmMakefile;
 class cmOutputConverter;
@@ -101,6 +103,7 @@ struct GeneratedMakeCommand
   std::vector<std::string> PrimaryCommand;
 };
 }
+
 namespace Json {
 class StreamWriter;
 }
@@ -250,13 +253,37 @@ public:
                                bool optional) const;
 
   void SetupTryCompile(cmGlobalGenerator* gen, cmMakefile* mf);
+#ifndef CMAKE_BOOTSTRAP
+  /** The cache shared by test projects that reuse their language setup,
+      or nullptr if none of them does.  */
+  cmLanguageSetupCache const* GetLanguageSetupCache() const
+  {
+    return this->LanguageSetupCache.get();
+  }
+#endif
   /**
    * Try running cmake and building a file. This is used for dynamically
    * loaded commands, not as part of the usual build process.
    */
   int TryCompile(int jobs, std::string const& bindir,
                  std::string const& projectName, std::string const& targetName,
-                 bool fast, std::string& output, cmMakefile* mf);
+                 bool fast, std::string& output, cmMakefile* mf,
+                 cmDeferredTryCompile* deferred = nullptr);
+
+  /**
+   * Queue a test project to be built by WaitForDeferredTryCompiles().
+   * Its build commands must have been filled in by TryCompile().
+   */
+  void DeferTryCompile(std::unique_ptr<cmDeferredTryCompile> tc);
+
+  /** Return whether a queued test project uses the given directory.  */
+  bool IsTryCompileDeferred(std::string const& bindir) const;
+
+  /**
+   * Build all queued test projects in parallel, then finish them in the
+   * order they were queued.
+   */
+  void WaitForDeferredTryCompiles();
 
   /**
    * Build a file given the following information. This is a more direct call
@@ -511,6 +538,20 @@ public:
   std::set<std::string> const& GetDirectoryContent(std::string const& dir,
                                                    bool needDisk = true);
 
+  /** Look up a name in the content of a directory as returned by
+      GetDirectoryContent, comparing names as the file system of the
+      directory does.  The lookup uses a hash index of the content that
+      is built once per directory listing.  Returns the name as listed,
+      or nullptr if the directory has no such entry.  */
+  std::string const* FindDirectoryEntry(std::string const& dir,
+                                        std::string const& name);
+
+  /** Check whether a file may exist according to the content of its
+      directory.  This is false only if the directory does not exist or
+      could be listed and has no entry of that name, so the file system
+      need not be queried for the file.  */
+  bool MayExistInDirectoryContent(std::string const& path);
+
   void IndexTarget(cmTarget* t);
   void IndexGeneratorTarget(cmGeneratorTarget* gt);
 
@@ -576,6 +617,10 @@ public:
       i.e. "Can I build Debug and Release in the same tree?" */
   virtual bool IsMultiConfig() const { return false; }
 
+  /** Get the cmcmdhelper client to run the "cmake -E" commands of build
+      edges with, or an empty string to run them directly.  */
+  std::string const& GetCommandHelper() const { return this->CommandHelper; }
+
   virtual bool IsXcode() const { return false; }
 
   virtual bool IsVisualStudio() const { return false; }
@@ -868,6 +913,8 @@ protected:
 
 #ifndef CMAKE_BOOTSTRAP
   std::unique_ptr<cmQtAutoGenGlobalInitializer> QtAutoGen;
+  std::shared_ptr<cmLanguageSetupCache> LanguageSetupCache;
+  std::vector<std::unique_ptr<cmDeferredTryCompile>> DeferredTryCompiles;
 #endif
 
   cmMakefile* CurrentConfigureMakefile;
@@ -978,6 +1025,12 @@ private:
   void CheckCompilerIdCompatibility(cmMakefile* mf,
                                     std::string const& lang) const;
 
+  // Load the platform and compiler information of the languages.
+  // Returns false if enabling the languages must stop.
+  bool LoadLanguageInformation(std::vector<std::string> const& languages,
+                               cmMakefile* mf, std::string const& rootBin,
+                               bool optional, bool& fatalError);
+
   void ComputeBuildFileGenerators();
 
   std::unique_ptr<cmExternalMakefileProjectGenerator> ExtraGenerator;
@@ -1021,10 +1074,25 @@ private:
   struct DirectoryContent
   {
     long LastDiskTime = -1;
+    // The directory was modified in the second it was last loaded, so
+    // later changes in that second would not change its time stamp.
+    bool Racy = false;
+    // Whether All lists everything on disk.  False if the directory
+    // exists but could not be read.
+    bool Complete = false;
+    // The cmFileSystemCache generation at the last check for changes.
+    std::size_t Generation = 0;
     std::set<std::string> All;
     std::set<std::string> Generated;
+
+    // Index of All for name lookups, built on demand.  The keys are in
+    // lower case for case-insensitive directories.
+    bool Indexed = false;
+    cmSystemTools::DirCase Case = cmSystemTools::DirCase::Sensitive;
+    std::unordered_map<std::string, std::string const*> Index;
   };
   std::map<std::string, DirectoryContent> DirectoryContentMap;
+  DirectoryContent& LoadDirectoryContent(std::string const& dir);
 
   // Cache parsed PList files
   std::map<std::string, cmXcFrameworkPlist> XcFrameworkPListContentMap;
@@ -1074,6 +1142,7 @@ private:
   IntermediateDirStrategy IntDirStrategy = IntermediateDirStrategy::Full;
   IntermediateDirStrategy QtAutogenIntDirStrategy =
     IntermediateDirStrategy::Full;
+  std::string CommandHelper;
 
 protected:
   float FirstTimeProgress;
@@ -1084,3 +1153,16 @@ protected:
   bool InstallTargetEnabled;
   bool AllowGlobalTargetCodegen;
 };
+
+/** A try_compile test project whose build system has been generated and
+    that waits to be built together with other deferred test projects.  */
+struct cmDeferredTryCompile
+{
+  std::string BinaryDirectory;
+  std::vector<cmGlobalGenerator::GeneratedMakeCommand> Commands;
+
+  int Result = 1;
+  std::string Output;
+  // Called with the Result and Output once the test project was built.
+  std::function<void(cmDeferredTryCompile const&)> Finish;
+};
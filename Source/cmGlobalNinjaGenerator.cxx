@@ -28,6 +28,7 @@
 #include "cmCustomCommand.h"
 #include "cmCxxModuleMapper.h"
 #include "cmDiagnostics.h"
+#include "cmDyndepCache.h"
 #include "cmDyndepCollation.h"
 #include "cmFortranParser.h"
 #include "cmGeneratedFileStream.h"
@@ -42,6 +43,10 @@
 #include "cmMakefile.h"
 #include "cmMessageType.h"
 #include "cmNinjaLinkLineComputer.h"
+#ifndef CMAKE_BOOTSTRAP
+#  include "cmMakefileProfilingData.h"
+#  include "cmNinjaOutputQueue.h"
+#endif
 #include "cmOutputConverter.h"
 #include "cmRange.h"
 #include "cmScanDepFormat.h"
@@ -234,6 +239,26 @@ void cmGlobalNinjaGenerator::WriteBuild(std::ostream& os,
     return;
   }
 
+#ifndef CMAKE_BOOTSTRAP
+  // The caller needs to know about the response file right away.
+  if (this->OutputQueue && !usedResponseFile &&
+      std::none_of(build.Variables.begin(), build.Variables.end(),
+                   [](cmNinjaVars::value_type const& variable) {
+                     return variable.first.empty();
+                   }) &&
+      this->OutputQueue->Defer(os, build, cmdLineLimit)) {
+    return;
+  }
+#endif
+
+  this->FormatBuild(os, build, cmdLineLimit, usedResponseFile);
+}
+
+void cmGlobalNinjaGenerator::FormatBuild(std::ostream& os,
+                                         cmNinjaBuild const& build,
+                                         int cmdLineLimit,
+                                         bool* usedResponseFile)
+{
   cmGlobalNinjaGenerator::WriteComment(os, build.Comment);
 
   // Write output files.
@@ -580,6 +605,8 @@ cmGlobalNinjaGenerator::cmGlobalNinjaGenerator(cmake* cm)
   this->FindMakeProgramFile = "CMakeNinjaFindMake.cmake";
 }
 
+cmGlobalNinjaGenerator::~cmGlobalNinjaGenerator() = default;
+
 // Virtual public methods.
 
 std::unique_ptr<cmLocalGenerator> cmGlobalNinjaGenerator::CreateLocalGenerator(
@@ -625,6 +652,7 @@ void cmGlobalNinjaGenerator::Generate()
     return;
   }
   this->InitOutputPathPrefix();
+  this->InitGenerateJobs();
   if (!this->OpenBuildFileStreams()) {
     return;
   }
@@ -643,6 +671,7 @@ void cmGlobalNinjaGenerator::Generate()
   this->ClangTidyExportFixesFiles.clear();
 
   this->cmGlobalGenerator::Generate();
+  this->FinishOutputQueue();
 
   this->WriteAssumedSourceDependencies();
   this->WriteTestPrepTargets();
@@ -2344,6 +2373,90 @@ void cmGlobalNinjaGenerator::InitOutputPathPrefix()
   EnsureTrailingSlash(this->OutputPathPrefix);
 }
 
+void cmGlobalNinjaGenerator::InitGenerateJobs()
+{
+  cmMakefile* mf = this->LocalGenerators[0]->GetMakefile();
+  this->TargetFragments = mf->IsOn("CMAKE_NINJA_TARGET_FRAGMENTS");
+  this->GenerateJobs = 1;
+  cmValue jobs = mf->GetDefinition("CMAKE_NINJA_GENERATE_JOBS");
+  if (jobs.IsEmpty()) {
+    return;
+  }
+  unsigned long value = 0;
+  if (!cmStrToULong(*jobs, &value) || value == 0 || value > 1024) {
+    this->GetCMakeInstance()->IssueMessage(
+      MessageType::FATAL_ERROR,
+      cmStrCat("CMAKE_NINJA_GENERATE_JOBS is set to\n  \"", *jobs,
+               "\"\nwhich is not a positive integer up to 1024."));
+    return;
+  }
+  this->GenerateJobs = static_cast<unsigned int>(value);
+}
+
+void cmGlobalNinjaGenerator::StartOutputQueue()
+{
+#ifndef CMAKE_BOOTSTRAP
+  if (this->OutputQueue) {
+    // Keep the output of each directory out of its first target.
+    this->OutputQueue->Cut();
+    return;
+  }
+  if (this->GenerateJobs < 2 && !this->TargetFragments) {
+    return;
+  }
+  this->OutputQueue = cm::make_unique<cmNinjaOutputQueue>(
+    [this](std::ostream& os, cmNinjaBuild const& build, int cmdLineLimit) {
+      this->FormatBuild(os, build, cmdLineLimit, nullptr);
+    },
+    this->GenerateJobs - 1);
+  if (this->TargetFragments) {
+    this->OutputQueue->SetFragmentOptions(
+      [this](std::string const& path) -> std::string {
+        return this->EncodePath(this->ConvertToNinjaPath(path));
+      },
+      this->GetMakefileEncoding());
+  }
+  this->CaptureBuildFileStreams(*this->OutputQueue);
+#endif
+}
+
+#ifndef CMAKE_BOOTSTRAP
+void cmGlobalNinjaGenerator::CaptureBuildFileStreams(cmNinjaOutputQueue& queue)
+{
+  queue.Capture(*this->BuildFileStream, NINJA_BUILD_FILE);
+  queue.Capture(*this->RulesFileStream);
+}
+#endif
+
+void cmGlobalNinjaGenerator::CutOutputQueue(cmGeneratorTarget const* target)
+{
+#ifndef CMAKE_BOOTSTRAP
+  if (this->OutputQueue) {
+    this->OutputQueue->Cut(this->TargetFragments
+                             ? target->GetSupportDirectory()
+                             : std::string());
+  }
+#else
+  static_cast<void>(target);
+#endif
+}
+
+void cmGlobalNinjaGenerator::FinishOutputQueue()
+{
+#ifndef CMAKE_BOOTSTRAP
+  if (!this->OutputQueue) {
+    return;
+  }
+  this->OutputQueue->Finish();
+  cmake* cm = this->GetCMakeInstance();
+  if (cm->IsProfilingEnabled()) {
+    cm->GetProfilingOutput().CounterEntry(
+      "generate", "ninja-output-queue", this->OutputQueue->GetStatistics());
+  }
+  this->OutputQueue.reset();
+#endif
+}
+
 std::string cmGlobalNinjaGenerator::NinjaOutputPath(
   std::string const& path) const
 {
@@ -2695,10 +2808,12 @@ bool cmGlobalNinjaGenerator::WriteDyndepFile(
     this->LocalGenerators.push_back(std::move(lgd));
   }
 
+  cmDyndepCache cache(dir_top_bld);
+
   std::vector<cmScanDepInfo> objects;
   for (std::string const& arg_ddi : arg_ddis) {
     cmScanDepInfo info;
-    if (!cmScanDepFormat_P1689_Parse(arg_ddi, &info)) {
+    if (!cache.ParseScanDepInfo(arg_ddi, info)) {
       cmSystemTools::Error(
         cmStrCat("-E cmake_ninja_dyndep failed to parse ddi file ", arg_ddi));
       return false;
@@ -2728,92 +2843,43 @@ bool cmGlobalNinjaGenerator::WriteDyndepFile(
   for (std::string const& linked_target_dir : linked_target_dirs) {
     std::string const ltmn =
       cmStrCat(linked_target_dir, '/', arg_lang, "Modules.json");
-    Json::Value ltm;
-    cmsys::ifstream ltmf(ltmn.c_str(), std::ios::in | std::ios::binary);
-    if (!ltmf) {
-      cmSystemTools::Error(cmStrCat("-E cmake_ninja_dyndep failed to open ",
-                                    ltmn, " for module information"));
+    cmDyndepCache::TargetModules ltm;
+    std::string errors;
+    if (!cache.LoadTargetModules(ltmn, ltm, errors)) {
+      if (errors.empty()) {
+        cmSystemTools::Error(cmStrCat("-E cmake_ninja_dyndep failed to open ",
+                                      ltmn, " for module information"));
+      } else {
+        cmSystemTools::Error(cmStrCat("-E cmake_ninja_dyndep failed to parse ",
+                                      linked_target_dir, errors));
+      }
       return false;
     }
-    Json::Reader reader;
-    if (!reader.parse(ltmf, ltm, false)) {
-      cmSystemTools::Error(cmStrCat("-E cmake_ninja_dyndep failed to parse ",
-                                    linked_target_dir,
-                                    reader.getFormattedErrorMessages()));
-      return false;
+    for (auto& module : ltm.Modules) {
+      mod_files[module.Name] = AvailableModuleInfo{
+        std::move(module.BmiPath),
+        module.IsPrivate,
+      };
     }
-    if (ltm.isObject()) {
-      Json::Value const& target_modules = ltm["modules"];
-      if (target_modules.isObject()) {
-        for (auto i = target_modules.begin(); i != target_modules.end(); ++i) {
-          Json::Value const& visible_module = *i;
-          if (visible_module.isObject()) {
-            Json::Value const& bmi_path = visible_module["bmi"];
-            Json::Value const& is_private = visible_module["is-private"];
-            mod_files[i.key().asString()] = AvailableModuleInfo{
-              bmi_path.asString(),
-              is_private.asBool(),
-            };
-          }
-        }
-      }
-      Json::Value const& target_modules_references = ltm["references"];
-      if (target_modules_references.isObject()) {
-        for (auto i = target_modules_references.begin();
-             i != target_modules_references.end(); ++i) {
-          if (i->isObject()) {
-            Json::Value const& reference_path = (*i)["path"];
-            CxxModuleReference module_reference;
-            if (reference_path.isString()) {
-              module_reference.Path = reference_path.asString();
-            }
-            Json::Value const& reference_method = (*i)["lookup-method"];
-            if (reference_method.isString()) {
-              std::string reference = reference_method.asString();
-              if (reference == "by-name") {
-                module_reference.Method = LookupMethod::ByName;
-              } else if (reference == "include-angle") {
-                module_reference.Method = LookupMethod::IncludeAngle;
-              } else if (reference == "include-quote") {
-                module_reference.Method = LookupMethod::IncludeQuote;
-              }
-            }
-            usages.Reference[i.key().asString()] = module_reference;
-          }
-        }
-      }
-      Json::Value const& target_modules_usage = ltm["usages"];
-      if (target_modules_usage.isObject()) {
-        for (auto i = target_modules_usage.begin();
-             i != target_modules_usage.end(); ++i) {
-          if (i->isArray()) {
-            for (auto j = i->begin(); j != i->end(); ++j) {
-              usages.Usage[i.key().asString()].insert(j->asString());
-            }
-          }
-        }
-      }
-      Json::Value const& import_error = ltm["import-error"];
-      if (import_error.isObject()) {
-        ImportErrorInfo info;
-        info.Message = import_error["message"].asString();
-        Json::Value const& errModules = import_error["modules"];
-        if (errModules.isArray()) {
-          for (auto const& m : errModules) {
-            info.Modules.insert(m.asString());
-          }
-        }
-        if (!info.Modules.empty()) {
-          importErrors.push_back(std::move(info));
-        }
-      }
-      Json::Value const& linked_interface_objects = ltm["interface-objects"];
-      if (linked_interface_objects.isObject()) {
-        for (auto i = linked_interface_objects.begin();
-             i != linked_interface_objects.end(); ++i) {
-          if (!transitiveInterfaceObjects.isMember(i.key().asString())) {
-            transitiveInterfaceObjects[i.key().asString()] = *i;
-          }
+    for (auto& reference : ltm.References) {
+      usages.Reference[reference.first] = std::move(reference.second);
+    }
+    for (auto const& usage : ltm.Usages) {
+      usages.Usage[usage.first].insert(usage.second.begin(),
+                                       usage.second.end());
+    }
+    if (!ltm.ImportErrorModules.empty()) {
+      ImportErrorInfo info;
+      info.Message = std::move(ltm.ImportErrorMessage);
+      info.Modules.insert(ltm.ImportErrorModules.begin(),
+                          ltm.ImportErrorModules.end());
+      importErrors.push_back(std::move(info));
+    }
+    if (ltm.InterfaceObjects.isObject()) {
+      for (auto i = ltm.InterfaceObjects.begin();
+           i != ltm.InterfaceObjects.end(); ++i) {
+        if (!transitiveInterfaceObjects.isMember(i.key().asString())) {
+          transitiveInterfaceObjects[i.key().asString()] = *i;
         }
       }
     }
@@ -3126,9 +3192,13 @@ bool cmGlobalNinjaGenerator::WriteDyndepFile(
 
   target_module_info["interface-objects"] = transitiveInterfaceObjects;
 
+  // Dependents load this file again, so share what they extract from it.
+  std::string const target_mods_content =
+    Json::writeString(Json::StreamWriterBuilder(), target_module_info);
   cmGeneratedFileStream tmf(target_mods_file);
   tmf.SetCopyIfDifferent(true);
-  tmf << target_module_info;
+  tmf << target_mods_content;
+  cache.StoreTargetModules(target_mods_content, target_module_info);
 
   cmDyndepMetadataCallbacks cb;
   cb.ModuleFile =
@@ -3419,6 +3489,25 @@ bool cmGlobalNinjaMultiGenerator::OpenBuildFileStreams()
     });
 }
 
+#ifndef CMAKE_BOOTSTRAP
+void cmGlobalNinjaMultiGenerator::CaptureBuildFileStreams(
+  cmNinjaOutputQueue& queue)
+{
+  auto fileName = [](std::string const& path) {
+    return cmSystemTools::GetFilenameName(path);
+  };
+  queue.Capture(*this->CommonFileStream, fileName(NINJA_COMMON_FILE));
+  queue.Capture(*this->DefaultFileStream, NINJA_BUILD_FILE);
+  for (auto const& config : this->GetConfigNames()) {
+    queue.Capture(*this->ImplFileStreams.at(config),
+                  fileName(GetNinjaImplFilename(config)));
+    queue.Capture(*this->ConfigFileStreams.at(config),
+                  fileName(GetNinjaConfigFilename(config)));
+  }
+  queue.Capture(*this->GetRulesFileStream());
+}
+#endif
+
 void cmGlobalNinjaMultiGenerator::CloseBuildFileStreams()
 {
   if (this->CommonFileStream) {
@@ -29,6 +29,7 @@
 class cmCustomCommand;
 class cmGeneratorTarget;
 class cmMakefile;
+class cmNinjaOutputQueue;
 class cmake;
 struct cmCxxModuleExportInfo;
 
@@ -110,6 +111,17 @@ public:
   void WriteBuild(std::ostream& os, cmNinjaBuild const& build,
                   int cmdLineLimit = 0, bool* usedResponseFile = nullptr);
 
+  /**
+   * Buffer the output of the target generators from now on, if
+   * CMAKE_NINJA_GENERATE_JOBS asks for more than one thread or
+   * CMAKE_NINJA_TARGET_FRAGMENTS is enabled.  Called before the
+   * targets of each directory are generated.
+   */
+  void StartOutputQueue();
+
+  /// Mark the end of the buffered output of a target.
+  void CutOutputQueue(cmGeneratorTarget const* target);
+
   class CCOutputs
   {
     cmGlobalNinjaGenerator* GG;
@@ -170,6 +182,7 @@ public:
   void MarkAsGCCOnWindows() { this->UsingGCCOnWindows = true; }
 
   cmGlobalNinjaGenerator(cmake* cm);
+  ~cmGlobalNinjaGenerator() override;
 
   static std::unique_ptr<cmGlobalGeneratorFactory> NewFactory()
   {
@@ -497,6 +510,9 @@ protected:
 
   virtual bool OpenBuildFileStreams();
   virtual void CloseBuildFileStreams();
+#ifndef CMAKE_BOOTSTRAP
+  virtual void CaptureBuildFileStreams(cmNinjaOutputQueue& queue);
+#endif
 
   bool OpenFileStream(std::unique_ptr<cmGeneratedFileStream>& stream,
                       std::string const& name);
@@ -524,6 +540,10 @@ private:
   void CloseRulesFileStream();
   void CleanMetaData();
 
+  void FinishOutputQueue();
+  void FormatBuild(std::ostream& os, cmNinjaBuild const& build,
+                   int cmdLineLimit, bool* usedResponseFile);
+
   /// Write the common disclaimer text at the top of each build file.
   void WriteDisclaimer(std::ostream& os) const;
 
@@ -558,6 +578,11 @@ private:
   std::unique_ptr<cmGeneratedFileStream> RulesFileStream;
   std::unique_ptr<cmGeneratedFileStream> CompileCommandsStream;
 
+#ifndef CMAKE_BOOTSTRAP
+  /// Formats build statements on worker threads while it exists.
+  std::unique_ptr<cmNinjaOutputQueue> OutputQueue;
+#endif
+
   /// The set of rules added to the generated build system.
   std::unordered_set<std::string> Rules;
 
@@ -612,8 +637,11 @@ private:
   bool DiagnosedCxxModuleNinjaSupport = false;
 
   void InitOutputPathPrefix();
+  void InitGenerateJobs();
 
   std::string OutputPathPrefix;
+  unsigned int GenerateJobs = 1;
+  bool TargetFragments = false;
   std::string TargetAll;
   std::string CMakeCacheFile;
 
@@ -749,6 +777,9 @@ public:
 protected:
   bool OpenBuildFileStreams() override;
   void CloseBuildFileStreams() override;
+#ifndef CMAKE_BOOTSTRAP
+  void CaptureBuildFileStreams(cmNinjaOutputQueue& queue) override;
+#endif
 
 private:
   std::map<std::string, std::unique_ptr<cmGeneratedFileStream>>
@@ -0,0 +1,321 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#include "cmLanguageSetupCache.h"
+
+#include <algorithm>
+
+#include <cm/string_view>
+#include <cmext/string_view>
+
+#include "cmListFileCache.h"
+#include "cmMakefile.h"
+#include "cmStateDirectory.h"
+#include "cmStateSnapshot.h"
+#include "cmStringAlgorithms.h"
+#include "cmSystemTools.h"
+#include "cmValue.h"
+#include "cmake.h"
+
+namespace {
+// The variables documented as try_compile inputs.  Test projects only
+// read them after their languages are set up.
+char const* const InputVariables[] = {
+  "COMPILE_DEFINITIONS", "INCLUDE_DIRECTORIES", "LINK_DIRECTORIES",
+  "LINK_LIBRARIES",      "LINK_OPTIONS",
+};
+
+// Directory properties that are not stored in the property map.
+char const* const UsageProperties[] = {
+  "COMPILE_DEFINITIONS", "COMPILE_OPTIONS", "INCLUDE_DIRECTORIES",
+  "LINK_DIRECTORIES",    "LINK_OPTIONS",
+};
+
+void AddToKey(std::string& key, cm::string_view part)
+{
+  key += cmStrCat(part.size(), ':', part);
+}
+
+template <typename Map, typename Changes>
+void Diff(Map const& before, Map const& after, Changes& changes)
+{
+  for (auto const& a : after) {
+    auto b = before.find(a.first);
+    if (b == before.end() || b->second != a.second) {
+      changes.emplace_back(a.first, a.second);
+    }
+  }
+  for (auto const& b : before) {
+    if (after.find(b.first) == after.end()) {
+      changes.emplace_back(b.first, cm::nullopt);
+    }
+  }
+}
+}
+
+bool cmLanguageSetupCache::CacheEntry::operator==(CacheEntry const& r) const
+{
+  return this->Value == r.Value && this->Initialized == r.Initialized &&
+    this->Type == r.Type && this->Properties == r.Properties;
+}
+
+Json::Value cmLanguageSetupCache::GetStatistics() const
+{
+  Json::Value stats = Json::objectValue;
+  stats["hits"] = static_cast<Json::UInt64>(this->Hits);
+  stats["misses"] = static_cast<Json::UInt64>(this->Misses);
+  return stats;
+}
+
+cmLanguageSetupCache::Setup::Setup(cmLanguageSetupCache& cache,
+                                   std::vector<std::string> const& languages,
+                                   bool optional, cmMakefile* mf)
+  : Cache(cache)
+  , Makefile(mf)
+  , Start(this->Capture())
+{
+  std::string& key = this->Key;
+  AddToKey(key, std::to_string(languages.size()));
+  for (std::string const& lang : languages) {
+    AddToKey(key, lang);
+  }
+  AddToKey(key, optional ? "1"_s : "0"_s);
+  for (cmPolicies::PolicyStatus status : this->Start.Policies) {
+    key += static_cast<char>('0' + status);
+  }
+
+  // Values that name the test project directory differ between test
+  // projects.  Leave them out of the key together with the try_compile
+  // inputs, and watch whether the setup reads them.  The modules see
+  // their own location in the list file variables.
+  for (char const* name : InputVariables) {
+    this->Excluded.emplace(name, cm::nullopt);
+  }
+  std::string const& binaryDir = mf->GetHomeOutputDirectory();
+  auto isExcluded = [this, &binaryDir](std::string const& name,
+                                       std::string const& value) -> bool {
+    return value.find(binaryDir) != std::string::npos ||
+      this->Excluded.find(name) != this->Excluded.end();
+  };
+
+  std::vector<std::pair<std::string const*, std::string const*>> defs;
+  for (auto const& d : this->Start.Definitions) {
+    if (d.first != "CMAKE_CURRENT_LIST_FILE" &&
+        d.first != "CMAKE_CURRENT_LIST_DIR") {
+      defs.emplace_back(&d.first, &d.second);
+    }
+  }
+  std::sort(defs.begin(), defs.end(),
+            [](std::pair<std::string const*, std::string const*> const& l,
+               std::pair<std::string const*, std::string const*> const& r) {
+              return *l.first < *r.first;
+            });
+  for (auto const& d : defs) {
+    if (isExcluded(*d.first, *d.second)) {
+      this->Excluded[*d.first] = *d.second;
+    } else {
+      AddToKey(key, *d.first);
+      AddToKey(key, *d.second);
+    }
+  }
+  for (auto const& c : this->Start.Cache) {
+    if (isExcluded(c.first, c.second.Value)) {
+      // A normal variable of the same name hides the cache entry.
+      if (c.second.Initialized &&
+          this->Start.Definitions.find(c.first) ==
+            this->Start.Definitions.end()) {
+        this->Excluded[c.first] = c.second.Value;
+      }
+      continue;
+    }
+    AddToKey(key, c.first);
+    AddToKey(key, std::to_string(c.second.Type));
+    AddToKey(key, c.second.Value);
+  }
+  for (auto const& p : this->Start.GlobalProperties) {
+    AddToKey(key, p.first);
+    AddToKey(key, p.second);
+  }
+  for (auto const& p : this->Start.DirectoryProperties) {
+    AddToKey(key, p.first);
+    AddToKey(key, p.second);
+  }
+
+  if (cmVariableWatch* vv = mf->GetVariableWatch()) {
+    for (auto const& e : this->Excluded) {
+      vv->AddWatch(e.first, &Setup::WatchExcluded, this);
+    }
+  }
+  mf->GetState()->SetScriptedCommandListener(
+    [this](std::string const& name, cmStateEnums::CommandType type,
+           cmState::Command const& function) {
+      this->Commands.push_back(Command{ name, type, function });
+    });
+}
+
+cmLanguageSetupCache::Setup::~Setup()
+{
+  this->Stop();
+}
+
+void cmLanguageSetupCache::Setup::Stop()
+{
+  if (this->Stopped) {
+    return;
+  }
+  this->Stopped = true;
+  if (cmVariableWatch* vv = this->Makefile->GetVariableWatch()) {
+    for (auto const& e : this->Excluded) {
+      vv->RemoveWatch(e.first, &Setup::WatchExcluded, this);
+    }
+  }
+  this->Makefile->GetState()->SetScriptedCommandListener(nullptr);
+}
+
+void cmLanguageSetupCache::Setup::WatchExcluded(
+  std::string const& variable, cmVariableWatch::AccessType accessType,
+  void* clientData, char const* newValue, cmMakefile const* /*mf*/)
+{
+  if (accessType != cmVariableWatch::VARIABLE_READ_ACCESS &&
+      accessType != cmVariableWatch::UNKNOWN_VARIABLE_READ_ACCESS) {
+    return;
+  }
+  // Reading a value that the setup assigned itself does not matter.
+  auto* setup = static_cast<Setup*>(clientData);
+  auto e = setup->Excluded.find(variable);
+  if (e != setup->Excluded.end() &&
+      e->second == (newValue ? cm::optional<std::string>(newValue)
+                             : cm::optional<std::string>())) {
+    setup->ReadExcluded = true;
+  }
+}
+
+cmLanguageSetupCache::State cmLanguageSetupCache::Setup::Capture() const
+{
+  State state;
+  cmMakefile* mf = this->Makefile;
+  cmStateSnapshot snapshot = mf->GetStateSnapshot();
+  for (std::string const& name : snapshot.ClosureKeys()) {
+    if (cmValue value = snapshot.GetDefinition(name)) {
+      state.Definitions.emplace(name, *value);
+    }
+  }
+
+  cmState* cmstate = mf->GetState();
+  for (std::string const& key : cmstate->GetCacheEntryKeys()) {
+    CacheEntry entry;
+    entry.Value = cmstate->GetSafeCacheEntryValue(key);
+    entry.Initialized =
+      static_cast<bool>(cmstate->GetInitializedCacheValue(key));
+    entry.Type = cmstate->GetCacheEntryType(key);
+    for (std::string const& prop : cmstate->GetCacheEntryPropertyList(key)) {
+      entry.Properties.emplace_back(
+        prop, *cmstate->GetCacheEntryProperty(key, prop));
+    }
+    state.Cache.emplace(key, std::move(entry));
+  }
+
+  for (auto& p : cmstate->GetGlobalPropertyList()) {
+    state.GlobalProperties.emplace(std::move(p));
+  }
+  cmStateDirectory dir = snapshot.GetDirectory();
+  for (std::string const& prop : dir.GetPropertyKeys()) {
+    state.DirectoryProperties.emplace(prop, *dir.GetProperty(prop));
+  }
+  for (char const* prop : UsageProperties) {
+    cmValue value = dir.GetProperty(prop);
+    if (cmNonempty(value)) {
+      state.DirectoryProperties.emplace(prop, *value);
+    }
+  }
+
+  state.Policies.reserve(cmPolicies::CMPCOUNT);
+  for (int id = 0; id < cmPolicies::CMPCOUNT; ++id) {
+    state.Policies.push_back(
+      mf->GetPolicyStatus(static_cast<cmPolicies::PolicyID>(id)));
+  }
+  return state;
+}
+
+bool cmLanguageSetupCache::Setup::Replay()
+{
+  auto it = this->Cache.Entries.find(this->Key);
+  if (it == this->Cache.Entries.end()) {
+    return false;
+  }
+  this->Stop();
+  ++this->Cache.Hits;
+
+  Effects const& effects = *it->second;
+  cmMakefile* mf = this->Makefile;
+  cmState* cmstate = mf->GetState();
+  for (auto const& c : effects.Cache) {
+    cmstate->RemoveCacheEntry(c.first);
+    if (!c.second) {
+      continue;
+    }
+    CacheEntry const& entry = *c.second;
+    mf->GetCMakeInstance()->AddCacheEntry(
+      c.first, entry.Initialized ? cmValue(entry.Value) : cmValue(nullptr),
+      cmValue(nullptr), entry.Type);
+    for (auto const& prop : entry.Properties) {
+      cmstate->SetCacheEntryProperty(c.first, prop.first, prop.second);
+    }
+  }
+  for (auto const& d : effects.Definitions) {
+    if (d.second) {
+      mf->AddDefinition(d.first, *d.second);
+    } else {
+      mf->RemoveDefinition(d.first);
+    }
+  }
+  for (auto const& p : effects.GlobalProperties) {
+    cmstate->SetGlobalProperty(
+      p.first, p.second ? cmValue(*p.second) : cmValue(nullptr));
+  }
+  for (auto const& p : effects.DirectoryProperties) {
+    mf->SetProperty(p.first,
+                    p.second ? cmValue(*p.second) : cmValue(nullptr));
+  }
+  for (Command const& c : effects.Commands) {
+    cmstate->AddScriptedCommand(c.Name, c.Type,
+                                BT<cmState::Command>(c.Function), *mf);
+  }
+  return true;
+}
+
+void cmLanguageSetupCache::Setup::Record()
+{
+  this->Stop();
+  ++this->Cache.Misses;
+
+  // A setup whose effects depend on more than the key, or that did not
+  // complete, is not recorded.
+  if (this->ReadExcluded || cmSystemTools::GetErrorOccurredFlag() ||
+      cmSystemTools::GetFatalErrorOccurred()) {
+    return;
+  }
+  State end = this->Capture();
+  if (end.Policies != this->Start.Policies) {
+    return;
+  }
+
+  auto effects = std::make_shared<Effects>();
+  Diff(this->Start.Definitions, end.Definitions, effects->Definitions);
+  for (auto& c : end.Cache) {
+    auto s = this->Start.Cache.find(c.first);
+    if (s == this->Start.Cache.end() || s->second != c.second) {
+      effects->Cache.emplace_back(c.first, std::move(c.second));
+    }
+  }
+  for (auto const& s : this->Start.Cache) {
+    if (end.Cache.find(s.first) == end.Cache.end()) {
+      effects->Cache.emplace_back(s.first, cm::nullopt);
+    }
+  }
+  Diff(this->Start.GlobalProperties, end.GlobalProperties,
+       effects->GlobalProperties);
+  Diff(this->Start.DirectoryProperties, end.DirectoryProperties,
+       effects->DirectoryProperties);
+  effects->Commands = std::move(this->Commands);
+  this->Cache.Entries[this->Key] = std::move(effects);
+}
@@ -0,0 +1,140 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#pragma once
+
+#include "cmConfigure.h" // IWYU pragma: keep
+
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cm/optional>
+
+#include <cm3p/json/value.h>
+
+#include "cmPolicies.h"
+#include "cmState.h"
+#include "cmStateTypes.h"
+#include "cmVariableWatch.h"
+
+class cmMakefile;
+
+/** \class cmLanguageSetupCache
+ * \brief Reuse the language setup of try_compile test projects.
+ *
+ * Every try_compile test project is configured by a new cmake instance
+ * that enables its languages by reading the platform and compiler
+ * information modules again.  This takes most of the time of its
+ * configure step.  The test projects of one outer project start this
+ * setup from the same state, except for the location of the test
+ * project and the try_compile inputs that it only reads afterwards.
+ *
+ * This cache records the effects of the setup on the variables, cache
+ * entries, properties and commands of a test project.  Later test
+ * projects that start from the same state get these effects applied
+ * instead of reading the modules again.  A setup that reads any of the
+ * variables that are left out of the starting state is not recorded.
+ */
+class cmLanguageSetupCache
+{
+public:
+  class Setup;
+
+  cmLanguageSetupCache() = default;
+
+  cmLanguageSetupCache(cmLanguageSetupCache const&) = delete;
+  cmLanguageSetupCache& operator=(cmLanguageSetupCache const&) = delete;
+
+  /** Hit and miss counts for the profiling output.  */
+  Json::Value GetStatistics() const;
+
+private:
+  struct CacheEntry
+  {
+    std::string Value;
+    bool Initialized = false;
+    cmStateEnums::CacheEntryType Type = cmStateEnums::UNINITIALIZED;
+    std::vector<std::pair<std::string, std::string>> Properties;
+
+    bool operator==(CacheEntry const& r) const;
+    bool operator!=(CacheEntry const& r) const { return !(*this == r); }
+  };
+
+  struct Command
+  {
+    std::string Name;
+    cmStateEnums::CommandType Type;
+    cmState::Command Function;
+  };
+
+  // The variables, cache entries and properties of a test project.
+  struct State
+  {
+    std::unordered_map<std::string, std::string> Definitions;
+    std::map<std::string, CacheEntry> Cache;
+    std::map<std::string, std::string> GlobalProperties;
+    std::map<std::string, std::string> DirectoryProperties;
+    std::vector<cmPolicies::PolicyStatus> Policies;
+  };
+
+  // The changes made by a setup.  A value of nullopt removes an entry.
+  struct Effects
+  {
+    using Change = std::pair<std::string, cm::optional<std::string>>;
+    std::vector<Change> Definitions;
+    std::vector<std::pair<std::string, cm::optional<CacheEntry>>> Cache;
+    std::vector<Change> GlobalProperties;
+    std::vector<Change> DirectoryProperties;
+    std::vector<Command> Commands;
+  };
+
+  std::unordered_map<std::string, std::shared_ptr<Effects const>> Entries;
+  unsigned long Hits = 0;
+  unsigned long Misses = 0;
+};
+
+/** \class cmLanguageSetupCache::Setup
+ * \brief The setup of the languages of one test project.
+ *
+ * Construct this before the languages are set up to capture the state
+ * that the setup starts from.  Then either Replay() the effects of an
+ * earlier setup, or run the setup and Record() its effects.
+ */
+class cmLanguageSetupCache::Setup
+{
+public:
+  Setup(cmLanguageSetupCache& cache, std::vector<std::string> const& languages,
+        bool optional, cmMakefile* mf);
+  ~Setup();
+
+  Setup(Setup const&) = delete;
+  Setup& operator=(Setup const&) = delete;
+
+  /** Apply the effects of an earlier setup from the same state, if any.  */
+  bool Replay();
+
+  /** Record the effects of the setup that ran since construction.  */
+  void Record();
+
+private:
+  State Capture() const;
+  void Stop();
+
+  static void WatchExcluded(std::string const& variable,
+                            cmVariableWatch::AccessType accessType,
+                            void* clientData, char const* newValue,
+                            cmMakefile const* mf);
+
+  cmLanguageSetupCache& Cache;
+  cmMakefile* Makefile;
+  State Start;
+  std::string Key;
+  // The variables left out of the key, with their values at the start.
+  std::unordered_map<std::string, cm::optional<std::string>> Excluded;
+  std::vector<Command> Commands;
+  bool ReadExcluded = false;
+  bool Stopped = false;
+};
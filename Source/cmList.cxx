@@ -24,6 +24,7 @@
 #include "cmListFileCache.h"
 #include "cmMakefile.h"
 #include "cmRange.h"
+#include "cmRegularExpressionCache.h"
 #include "cmState.h"
 #include "cmStateTypes.h"
 #include "cmStringAlgorithms.h"
@@ -236,17 +237,19 @@ private:
 };
 }
 
-cmList& cmList::filter(cm::string_view pattern, FilterMode mode)
+cmList& cmList::filter(cm::string_view pattern, FilterMode mode,
+                       cmRegularExpressionCache* cache)
 {
-  cmsys::RegularExpression regex(std::string{ pattern });
-  if (!regex.is_valid()) {
+  cmRegularExpressionCache::Lease regex =
+    cmRegularExpressionCache::Acquire(cache, std::string{ pattern });
+  if (!regex->is_valid()) {
     throw std::invalid_argument(
       cmStrCat("sub-command FILTER, mode REGEX failed to compile regex \"",
                pattern, "\"."));
   }
 
   auto it = std::remove_if(this->Values.begin(), this->Values.end(),
-                           MatchesRegex{ regex, mode });
+                           MatchesRegex{ *regex, mode });
   this->Values.erase(it, this->Values.end());
 
   return *this;
@@ -675,6 +678,9 @@ public:
 
   virtual std::string operator()(std::string const& s) = 0;
 
+  // Drop the state set up by Initialize.
+  virtual void Reset() {}
+
 protected:
   TransformSelector* Selector;
 };
@@ -832,6 +838,8 @@ public:
     return s;
   }
 
+  void Reset() override { this->ReplaceHelper.reset(); }
+
 private:
   std::unique_ptr<cmStringReplaceHelper> ReplaceHelper;
 };
@@ -948,6 +956,26 @@ ActionDescriptorSet Descriptors([](cmList::TransformAction x,
   return x < y;
 });
 
+// The actions in Descriptors are shared by all transformations.  Reset
+// the action once a transformation is done so that no state, like a
+// compiled regular expression lent by the cache of a cmState, outlives
+// its use.
+class TransformActionReset
+{
+public:
+  TransformActionReset(TransformAction& action)
+    : Action(action)
+  {
+  }
+  ~TransformActionReset() { this->Action.Reset(); }
+
+  TransformActionReset(TransformActionReset const&) = delete;
+  TransformActionReset& operator=(TransformActionReset const&) = delete;
+
+private:
+  TransformAction& Action;
+};
+
 ActionDescriptorSet::iterator TransformConfigure(
   cmList::TransformAction action,
   std::unique_ptr<cmList::TransformSelector>& selector, std::size_t arity)
@@ -1103,6 +1131,7 @@ cmList& cmList::transform(TransformAction action,
 {
   auto descriptor = TransformConfigure(action, selector, 0);
 
+  TransformActionReset reset(*descriptor->Transform);
   descriptor->Transform->Initialize(
     static_cast<::TransformSelector*>(selector.get()));
 
@@ -1119,6 +1148,7 @@ cmList& cmList::transform(TransformAction action, std::string const& arg,
 {
   auto descriptor = TransformConfigure(action, selector, 1);
 
+  TransformActionReset reset(*descriptor->Transform);
   descriptor->Transform->Initialize(
     static_cast<::TransformSelector*>(selector.get()), arg);
 
@@ -1136,6 +1166,7 @@ cmList& cmList::transform(TransformAction action, std::string const& arg1,
 {
   auto descriptor = TransformConfigure(action, selector, 2);
 
+  TransformActionReset reset(*descriptor->Transform);
   descriptor->Transform->Initialize(
     static_cast<::TransformSelector*>(selector.get()), arg1, arg2);
 
@@ -1153,6 +1184,7 @@ cmList& cmList::transform(TransformAction action,
 {
   auto descriptor = TransformConfigure(action, selector, args.size());
 
+  TransformActionReset reset(*descriptor->Transform);
   descriptor->Transform->Initialize(
     static_cast<::TransformSelector*>(selector.get()), args);
 
@@ -25,6 +25,7 @@
 template <typename T>
 class BT;
 class cmMakefile;
+class cmRegularExpressionCache;
 
 /**
  * CMake lists management
@@ -824,7 +825,9 @@ public:
   // Includes or removes items from the list
   // Throw std::invalid_argument if regular expression is invalid or predicate
   // function is unknown / does not set its output variable
-  cmList& filter(cm::string_view regex, FilterMode mode);
+  // The compiled regular expression is taken from the cache, if given.
+  cmList& filter(cm::string_view regex, FilterMode mode,
+                 cmRegularExpressionCache* cache = nullptr);
   cmList& filter(std::string const& functionName, FilterMode mode,
                  cmMakefile& makefile);
 
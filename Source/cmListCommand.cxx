@@ -21,6 +21,8 @@
 #include "cmMakefile.h"
 #include "cmPolicies.h"
 #include "cmRange.h"
+#include "cmRegularExpressionCache.h"
+#include "cmState.h"
 #include "cmStringAlgorithms.h"
 #include "cmSubcommandTable.h"
 #include "cmValue.h"
@@ -1012,10 +1014,12 @@ bool HandleFilterCommand(std::vector<std::string> const& args,
       return false;
     }
     std::string const& pattern = args[4];
+    cmRegularExpressionCache& cache =
+      status.GetMakefile().GetState()->GetRegularExpressionCache();
 
     try {
       status.GetMakefile().AddDefinition(
-        listName, list->filter(pattern, filterMode).to_string());
+        listName, list->filter(pattern, filterMode, &cache).to_string());
       return true;
     } catch (std::invalid_argument& e) {
       status.SetError(e.what());
@@ -16,6 +16,10 @@
 #include "cmDiagnostics.h"
 #include "cmList.h"
 #include "cmListFileLexer.h"
+#if !defined(CMAKE_BOOTSTRAP)
+#  include "cmListFileParseCache.h"
+#  include "cmListFilePrefetcher.h"
+#endif
 #include "cmMakefile.h"
 #include "cmMessageType.h"
 #include "cmStringAlgorithms.h"
@@ -54,9 +58,14 @@ public:
   cmListFileParser(cmListFileParser const&) = delete;
   cmListFileParser& operator=(cmListFileParser const&) = delete;
 
+  /** Do not record errors in global state.  */
+  void SetQuiet() { this->Quiet = true; }
+
   bool ParseFile();
   bool ParseString(cm::string_view str);
 
+  bool HasWarnings() const { return this->IssuedWarnings; }
+
 private:
   bool Parse();
   bool ParseFunction(cm::string_view name, long line);
@@ -83,6 +92,8 @@ private:
   long FunctionLine;
   long FunctionLineEnd;
   std::vector<cmListFileArgument> FunctionArguments;
+  bool IssuedWarnings = false;
+  bool Quiet = false;
 };
 
 cmListFileParser::cmListFileParser(cmListFile* lf, cmListFileBacktrace lfbt,
@@ -115,7 +126,9 @@ void cmListFileParser::IssueError(std::string const& text) const
     this->Makefile->GetCMakeInstance()->IssueMessage(MessageType::FATAL_ERROR,
                                                      text, lfbt);
   }
-  cmSystemTools::SetFatalErrorOccurred();
+  if (!this->Quiet) {
+    cmSystemTools::SetFatalErrorOccurred();
+  }
 }
 
 bool cmListFileParser::ParseFile()
@@ -207,7 +220,9 @@ bool cmListFileParser::Parse()
         "Flow control statements are not properly nested.",
         this->Backtrace.Push(*badNesting));
     }
-    cmSystemTools::SetFatalErrorOccurred();
+    if (!this->Quiet) {
+      cmSystemTools::SetFatalErrorOccurred();
+    }
     return false;
   }
 
@@ -340,6 +355,7 @@ bool cmListFileParser::AddArgument(cmListFileLexer_Token* token,
   if (this->Makefile) {
     this->Makefile->IssueDiagnostic(cmDiagnostics::CMD_AUTHOR, msg, lfbt);
   }
+  this->IssuedWarnings = true;
   return true;
 }
 
@@ -446,8 +462,63 @@ bool cmListFile::ParseFile(std::string const& filename, cmMakefile const* mf,
     return false;
   }
 
+#if !defined(CMAKE_BOOTSTRAP)
+  // Reuse the result of a previous parse of the same content, if any.
+  cmListFileParseCache* cache =
+    mf ? mf->GetCMakeInstance()->GetListFileParseCache() : nullptr;
+  cmListFilePrefetcher* prefetcher =
+    mf ? mf->GetCMakeInstance()->GetListFilePrefetcher() : nullptr;
+  cmListFilePrefetcher::Result prefetched;
+  cmListFileParseCache::Fingerprint fingerprint;
+  if (prefetcher && prefetcher->Take(filename, prefetched)) {
+    fingerprint = prefetched.Print;
+  } else {
+    prefetcher = nullptr;
+    if (cache &&
+        !cmListFileParseCache::ComputeFingerprint(filename, fingerprint)) {
+      cache = nullptr;
+    }
+  }
+  if (cache) {
+    if (auto const* functions = cache->Find(filename, fingerprint)) {
+      this->Functions = *functions;
+      return true;
+    }
+  }
+  // Use the result of parsing the file on a worker thread, if any.
+  if (prefetcher) {
+    this->Functions = std::move(prefetched.Functions);
+    if (cache) {
+      cache->Insert(filename, fingerprint, this->Functions);
+    }
+    return true;
+  }
+#endif
+
   cmListFileParser parser(this, lfbt, mf, filename);
-  return parser.ParseFile();
+  if (!parser.ParseFile()) {
+    return false;
+  }
+
+#if !defined(CMAKE_BOOTSTRAP)
+  // Files that produced diagnostics are not cached so that the
+  // diagnostics are issued again on every run.
+  if (cache && !parser.HasWarnings()) {
+    cache->Insert(filename, fingerprint, this->Functions);
+  }
+#endif
+  return true;
+}
+
+bool cmListFile::ParseFileQuietly(std::string const& path)
+{
+  if (!cmSystemTools::FileExists(path) ||
+      cmSystemTools::FileIsDirectory(path)) {
+    return false;
+  }
+  cmListFileParser parser(this, cmListFileBacktrace(), nullptr, path);
+  parser.SetQuiet();
+  return parser.ParseFile() && !parser.HasWarnings();
 }
 
 bool cmListFile::ParseString(cm::string_view str,
@@ -25,6 +25,7 @@
  * cmake list files.
  */
 
+class cmCompiledArgument;
 class cmMakefile;
 
 struct cmListFileArgument
@@ -50,6 +51,8 @@ struct cmListFileArgument
   std::string Value;
   Delimiter Delim = Unquoted;
   long Line = 0;
+  // Pre-tokenized form of Value, computed on first expansion.
+  mutable std::shared_ptr<cmCompiledArgument const> Compiled;
 };
 
 class cmListFileFunction
@@ -276,5 +279,10 @@ struct cmListFile
   bool ParseString(cm::string_view str, std::string const& virtual_filename,
                    cmMakefile const* mf, cmListFileBacktrace const& lfbt);
 
+  /** Parse a file without reporting diagnostics or touching any global
+      state, e.g. on a worker thread.  Returns false if the file could
+      not be parsed or parsing it would have produced a diagnostic.  */
+  bool ParseFileQuietly(std::string const& path);
+
   std::vector<cmListFileFunction> Functions;
 };
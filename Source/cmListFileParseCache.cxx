@@ -0,0 +1,277 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#include "cmListFileParseCache.h"
+
+#include <ios>
+#include <iterator>
+#include <utility>
+
+#include <cm/string_view>
+#include <cmext/string_view>
+
+#include <cm3p/rapidhash.h>
+
+#include "cmsys/FStream.hxx"
+
+#include "cmFileTime.h"
+#include "cmGeneratedFileStream.h"
+#include "cmStringAlgorithms.h"
+#include "cmVersion.h"
+
+namespace {
+
+// Increment this whenever the layout of the cache file changes.
+std::uint32_t const FormatVersion = 1;
+cm::string_view const Magic = "CMLFPC\n"_s;
+
+bool ReadFileContent(std::string const& path, std::string& content)
+{
+  cmsys::ifstream fin(path.c_str(), std::ios::in | std::ios::binary);
+  if (!fin) {
+    return false;
+  }
+  content.assign(std::istreambuf_iterator<char>(fin),
+                 std::istreambuf_iterator<char>());
+  return !fin.bad();
+}
+
+class Writer
+{
+public:
+  void U64(std::uint64_t v)
+  {
+    for (int i = 0; i < 8; ++i) {
+      this->Data += static_cast<char>((v >> (8 * i)) & 0xff);
+    }
+  }
+  void I64(std::int64_t v) { this->U64(static_cast<std::uint64_t>(v)); }
+  void String(cm::string_view s)
+  {
+    this->U64(s.size());
+    this->Data.append(s.data(), s.size());
+  }
+
+  std::string Data;
+};
+
+class Reader
+{
+public:
+  Reader(std::string const& data)
+    : Data(data)
+  {
+  }
+
+  bool U64(std::uint64_t& v)
+  {
+    if (this->Data.size() - this->Pos < 8) {
+      return false;
+    }
+    v = 0;
+    for (int i = 0; i < 8; ++i) {
+      v |= static_cast<std::uint64_t>(
+             static_cast<unsigned char>(this->Data[this->Pos++]))
+        << (8 * i);
+    }
+    return true;
+  }
+  bool I64(std::int64_t& v)
+  {
+    std::uint64_t u;
+    if (!this->U64(u)) {
+      return false;
+    }
+    v = static_cast<std::int64_t>(u);
+    return true;
+  }
+  bool String(std::string& s)
+  {
+    std::uint64_t n;
+    if (!this->U64(n) || this->Data.size() - this->Pos < n) {
+      return false;
+    }
+    s.assign(this->Data, this->Pos, static_cast<std::size_t>(n));
+    this->Pos += static_cast<std::size_t>(n);
+    return true;
+  }
+  bool AtEnd() const { return this->Pos == this->Data.size(); }
+
+private:
+  std::string const& Data;
+  std::size_t Pos = 0;
+};
+
+bool ReadFunctions(Reader& in, std::vector<cmListFileFunction>& functions)
+{
+  std::uint64_t nFunctions;
+  if (!in.U64(nFunctions)) {
+    return false;
+  }
+  for (std::uint64_t f = 0; f < nFunctions; ++f) {
+    std::string name;
+    std::int64_t line;
+    std::int64_t lineEnd;
+    std::uint64_t nArgs;
+    if (!in.String(name) || !in.I64(line) || !in.I64(lineEnd) ||
+        !in.U64(nArgs)) {
+      return false;
+    }
+    std::vector<cmListFileArgument> args;
+    for (std::uint64_t a = 0; a < nArgs; ++a) {
+      std::string value;
+      std::uint64_t delim;
+      std::int64_t argLine;
+      if (!in.String(value) || !in.U64(delim) || !in.I64(argLine) ||
+          delim > cmListFileArgument::Bracket) {
+        return false;
+      }
+      args.emplace_back(value,
+                        static_cast<cmListFileArgument::Delimiter>(delim),
+                        static_cast<long>(argLine));
+    }
+    functions.emplace_back(std::move(name), static_cast<long>(line),
+                           static_cast<long>(lineEnd), std::move(args));
+  }
+  return true;
+}
+
+void WriteFunctions(Writer& out,
+                    std::vector<cmListFileFunction> const& functions)
+{
+  out.U64(functions.size());
+  for (cmListFileFunction const& func : functions) {
+    out.String(func.OriginalName());
+    out.I64(func.Line());
+    out.I64(func.LineEnd());
+    out.U64(func.Arguments().size());
+    for (cmListFileArgument const& arg : func.Arguments()) {
+      out.String(arg.Value);
+      out.U64(static_cast<std::uint64_t>(arg.Delim));
+      out.I64(arg.Line);
+    }
+  }
+}
+}
+
+cmListFileParseCache::cmListFileParseCache(std::string const& binaryDir)
+  : FilePath(cmStrCat(binaryDir, "/CMakeFiles/ListFileParseCache.bin"))
+{
+}
+
+bool cmListFileParseCache::ComputeFingerprint(std::string const& path,
+                                              Fingerprint& fp)
+{
+  cmFileTime mtime;
+  std::string content;
+  if (!mtime.Load(path) || !ReadFileContent(path, content)) {
+    return false;
+  }
+  fp.Size = content.size();
+  fp.MTime = mtime.GetTime();
+  fp.Hash = rapidhash(content.data(), content.size());
+  return true;
+}
+
+std::vector<cmListFileFunction> const* cmListFileParseCache::Find(
+  std::string const& path, Fingerprint const& fp)
+{
+  auto it = this->Entries.find(path);
+  if (it == this->Entries.end() || it->second.Print != fp) {
+    ++this->Misses;
+    return nullptr;
+  }
+  ++this->Hits;
+  it->second.Used = true;
+  return &it->second.Functions;
+}
+
+void cmListFileParseCache::Insert(
+  std::string const& path, Fingerprint const& fp,
+  std::vector<cmListFileFunction> const& functions)
+{
+  Entry& entry = this->Entries[path];
+  entry.Print = fp;
+  entry.Functions = functions;
+  entry.Used = true;
+  this->Modified = true;
+}
+
+void cmListFileParseCache::Load()
+{
+  std::string data;
+  if (!ReadFileContent(this->FilePath, data)) {
+    return;
+  }
+
+  // A cache written by a different version of CMake, or one that is
+  // truncated or otherwise malformed, is discarded as a whole.
+  Reader in(data);
+  std::string magic;
+  std::uint64_t version;
+  std::string cmakeVersion;
+  std::uint64_t nEntries;
+  if (!in.String(magic) || cm::string_view(magic) != Magic ||
+      !in.U64(version) || version != FormatVersion ||
+      !in.String(cmakeVersion) ||
+      cmakeVersion != cmVersion::GetCMakeVersion() || !in.U64(nEntries)) {
+    return;
+  }
+
+  std::unordered_map<std::string, Entry> entries;
+  for (std::uint64_t e = 0; e < nEntries; ++e) {
+    std::string path;
+    Entry entry;
+    if (!in.String(path) || !in.U64(entry.Print.Size) ||
+        !in.I64(entry.Print.MTime) || !in.U64(entry.Print.Hash) ||
+        !ReadFunctions(in, entry.Functions)) {
+      return;
+    }
+    entries.emplace(std::move(path), std::move(entry));
+  }
+  if (!in.AtEnd()) {
+    return;
+  }
+  this->Entries = std::move(entries);
+}
+
+bool cmListFileParseCache::Save()
+{
+  Writer out;
+  std::uint64_t nEntries = 0;
+  for (auto const& e : this->Entries) {
+    if (e.second.Used) {
+      ++nEntries;
+    }
+  }
+  if (!this->Modified && nEntries == this->Entries.size()) {
+    return true;
+  }
+
+  out.String(Magic);
+  out.U64(FormatVersion);
+  out.String(cmVersion::GetCMakeVersion());
+  out.U64(nEntries);
+  for (auto const& e : this->Entries) {
+    if (!e.second.Used) {
+      continue;
+    }
+    out.String(e.first);
+    out.U64(e.second.Print.Size);
+    out.I64(e.second.Print.MTime);
+    out.U64(e.second.Print.Hash);
+    WriteFunctions(out, e.second.Functions);
+  }
+
+  cmGeneratedFileStream fout;
+  fout.Open(this->FilePath, true, true);
+  fout.write(out.Data.data(), static_cast<std::streamsize>(out.Data.size()));
+  return fout.Close();
+}
+
+Json::Value cmListFileParseCache::GetStatistics() const
+{
+  Json::Value stats = Json::objectValue;
+  stats["hits"] = static_cast<Json::UInt64>(this->Hits);
+  stats["misses"] = static_cast<Json::UInt64>(this->Misses);
+  return stats;
+}
@@ -0,0 +1,92 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#pragma once
+
+#include "cmConfigure.h" // IWYU pragma: keep
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <cm3p/json/value.h>
+
+#include "cmListFileCache.h"
+
+/** \class cmListFileParseCache
+ * \brief Persist parsed list files across configure runs.
+ *
+ * cmListFileParseCache stores the cmListFileFunction vectors produced by
+ * the list file parser in a binary file under the CMakeFiles directory of
+ * the build tree.  Entries are keyed by the path of the list file and are
+ * only used while the size, modification time, and content hash of the
+ * file on disk still match the recorded values.
+ */
+class cmListFileParseCache
+{
+public:
+  struct Fingerprint
+  {
+    std::uint64_t Size = 0;
+    std::int64_t MTime = 0;
+    std::uint64_t Hash = 0;
+
+    bool operator==(Fingerprint const& r) const
+    {
+      return this->Size == r.Size && this->MTime == r.MTime &&
+        this->Hash == r.Hash;
+    }
+    bool operator!=(Fingerprint const& r) const { return !(*this == r); }
+  };
+
+  cmListFileParseCache(std::string const& binaryDir);
+
+  cmListFileParseCache(cmListFileParseCache const&) = delete;
+  cmListFileParseCache& operator=(cmListFileParseCache const&) = delete;
+
+  /**
+   * @brief Compute the fingerprint of a list file on disk.
+   * @return false if the file cannot be read.
+   */
+  static bool ComputeFingerprint(std::string const& path, Fingerprint& fp);
+
+  /**
+   * @brief Look up the parsed functions of a list file.
+   * @return nullptr if no entry with a matching fingerprint exists.
+   */
+  std::vector<cmListFileFunction> const* Find(std::string const& path,
+                                              Fingerprint const& fp);
+
+  /** Record the parsed functions of a list file.  */
+  void Insert(std::string const& path, Fingerprint const& fp,
+              std::vector<cmListFileFunction> const& functions);
+
+  /** Read the cache file from the build tree, if any.  */
+  void Load();
+
+  /**
+   * @brief Write the cache file to the build tree.
+   *
+   * Only entries that were used or inserted since the cache was loaded
+   * are written, so entries for list files that are no longer part of
+   * the project are dropped.
+   */
+  bool Save();
+
+  /** Hit and miss counts for the profiling output.  */
+  Json::Value GetStatistics() const;
+
+private:
+  struct Entry
+  {
+    Fingerprint Print;
+    std::vector<cmListFileFunction> Functions;
+    bool Used = false;
+  };
+
+  std::string FilePath;
+  std::unordered_map<std::string, Entry> Entries;
+  unsigned long Hits = 0;
+  unsigned long Misses = 0;
+  bool Modified = false;
+};
@@ -0,0 +1,127 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#include "cmListFilePrefetcher.h"
+
+#include <utility>
+
+cmListFilePrefetcher::cmListFilePrefetcher(unsigned int threads)
+{
+  this->Threads.reserve(threads);
+  for (unsigned int i = 0; i < threads; ++i) {
+    this->Threads.emplace_back([this]() { this->Work(); });
+  }
+}
+
+cmListFilePrefetcher::~cmListFilePrefetcher()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    this->Stopping = true;
+  }
+  this->WorkAvailable.notify_all();
+  for (std::thread& thread : this->Threads) {
+    thread.join();
+  }
+}
+
+void cmListFilePrefetcher::Prefetch(std::string const& path)
+{
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    if (!this->Entries.emplace(path, Entry()).second) {
+      return;
+    }
+    this->Queue.push_back(path);
+  }
+  this->WorkAvailable.notify_one();
+}
+
+bool cmListFilePrefetcher::Take(std::string const& path, Result& result)
+{
+  {
+    std::unique_lock<std::mutex> lock(this->Mutex);
+    auto it = this->Entries.find(path);
+    if (it == this->Entries.end()) {
+      return false;
+    }
+    Entry& entry = it->second;
+    if (entry.Status == State::Queued) {
+      // Parsing it here is no slower than waiting for a worker.
+      entry.Status = State::Taken;
+      return false;
+    }
+    if (entry.Status == State::Parsing) {
+      ++this->Waited;
+      this->WorkDone.wait(
+        lock, [&entry]() { return entry.Status != State::Parsing; });
+    }
+    if (entry.Status != State::Parsed) {
+      entry.Status = State::Taken;
+      return false;
+    }
+    entry.Status = State::Taken;
+    result = std::move(entry.Parsed);
+  }
+
+  // The configure step may have written the file since it was read.
+  cmListFileParseCache::Fingerprint current;
+  if (!cmListFileParseCache::ComputeFingerprint(path, current) ||
+      current != result.Print) {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    ++this->Discarded;
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(this->Mutex);
+  ++this->Used;
+  return true;
+}
+
+void cmListFilePrefetcher::Work()
+{
+  std::unique_lock<std::mutex> lock(this->Mutex);
+  for (;;) {
+    this->WorkAvailable.wait(
+      lock, [this]() { return this->Stopping || !this->Queue.empty(); });
+    if (this->Stopping) {
+      return;
+    }
+    std::string path = std::move(this->Queue.front());
+    this->Queue.pop_front();
+    Entry& entry = this->Entries[path];
+    if (entry.Status != State::Queued) {
+      continue;
+    }
+    entry.Status = State::Parsing;
+    lock.unlock();
+
+    // Record the fingerprint before and after parsing so that a file
+    // modified while it is parsed is not used.
+    Result parsed;
+    cmListFile listFile;
+    cmListFileParseCache::Fingerprint after;
+    bool const ok =
+      cmListFileParseCache::ComputeFingerprint(path, parsed.Print) &&
+      listFile.ParseFileQuietly(path) &&
+      cmListFileParseCache::ComputeFingerprint(path, after) &&
+      after == parsed.Print;
+    parsed.Functions = std::move(listFile.Functions);
+
+    lock.lock();
+    entry.Status = ok ? State::Parsed : State::Failed;
+    if (ok) {
+      entry.Parsed = std::move(parsed);
+    }
+    this->WorkDone.notify_all();
+  }
+}
+
+Json::Value cmListFilePrefetcher::GetStatistics() const
+{
+  std::lock_guard<std::mutex> lock(this->Mutex);
+  Json::Value stats = Json::objectValue;
+  stats["queued"] = static_cast<Json::UInt64>(this->Entries.size());
+  stats["used"] = static_cast<Json::UInt64>(this->Used);
+  stats["waited"] = static_cast<Json::UInt64>(this->Waited);
+  stats["discarded"] = static_cast<Json::UInt64>(this->Discarded);
+  return stats;
+}
@@ -0,0 +1,91 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#pragma once
+
+#include "cmConfigure.h" // IWYU pragma: keep
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <cm3p/json/value.h>
+
+#include "cmListFileCache.h"
+#include "cmListFileParseCache.h"
+
+/** \class cmListFilePrefetcher
+ * \brief Read and parse list files ahead of time on worker threads.
+ *
+ * While a directory is configured, the list files of the subdirectories
+ * it adds can already be read and parsed.  Parsing does not depend on
+ * the state of the configure step, so it runs on a pool of worker
+ * threads.  The configure step itself still runs on the main thread and
+ * processes directories in order, so its results do not depend on the
+ * number of threads.
+ *
+ * A prefetched result is used only if the file did not change since it
+ * was read, and only if parsing it produced no diagnostics.  Otherwise
+ * the file is parsed again when it is needed so that diagnostics are
+ * reported in order.
+ */
+class cmListFilePrefetcher
+{
+public:
+  cmListFilePrefetcher(unsigned int threads);
+  ~cmListFilePrefetcher();
+
+  cmListFilePrefetcher(cmListFilePrefetcher const&) = delete;
+  cmListFilePrefetcher& operator=(cmListFilePrefetcher const&) = delete;
+
+  struct Result
+  {
+    cmListFileParseCache::Fingerprint Print;
+    std::vector<cmListFileFunction> Functions;
+  };
+
+  /** Queue a list file to be parsed, unless it was queued before.  */
+  void Prefetch(std::string const& path);
+
+  /** Take the result of parsing a queued list file.  Waits for a parse
+      that is in progress.  Returns false if the file was not queued, was
+      not parsed yet, could not be parsed cleanly, or changed since.  */
+  bool Take(std::string const& path, Result& result);
+
+  /** Get counters for the profiling output.  */
+  Json::Value GetStatistics() const;
+
+private:
+  enum class State
+  {
+    Queued,
+    Parsing,
+    Parsed,
+    Failed,
+    Taken,
+  };
+
+  struct Entry
+  {
+    State Status = State::Queued;
+    Result Parsed;
+  };
+
+  void Work();
+
+  mutable std::mutex Mutex;
+  std::condition_variable WorkAvailable;
+  std::condition_variable WorkDone;
+  std::deque<std::string> Queue;
+  std::unordered_map<std::string, Entry> Entries;
+  std::vector<std::thread> Threads;
+  bool Stopping = false;
+
+  std::size_t Used = 0;
+  std::size_t Waited = 0;
+  std::size_t Discarded = 0;
+};
@@ -102,6 +102,10 @@ void cmLocalNinjaGenerator::Generate()
     }
   }
 
+  // Streams are captured from here on, so any output that is written
+  // with an alternative encoding must be written before.
+  this->GetGlobalNinjaGenerator()->StartOutputQueue();
+
   for (auto const& target : this->GetGeneratorTargets()) {
     if (!target->IsInBuildSystem()) {
       continue;
@@ -155,6 +159,7 @@ void cmLocalNinjaGenerator::Generate()
       } else {
         tg->Generate("");
       }
+      this->GetGlobalNinjaGenerator()->CutOutputQueue(target.get());
     }
   }
 
@@ -727,13 +732,19 @@ void cmLocalNinjaGenerator::WriteCustomCommandBuildStatement(
         }
       }
 
+      bool restat = !symbolic || !byproducts.empty();
+      if (cc->GetPreserveUnchangedOutputs() && !symbolic) {
+        this->AppendPreserveUnchangedOutputsLines(outputs, customStep,
+                                                  cmdLines);
+        restat = true;
+      }
+
       std::string comment = cmStrCat("Custom command for ", mainOutput);
       gg->WriteCustomCommandBuild(
         this->BuildCommandLine(cmdLines, ccg.GetOutputConfig(), fileConfig,
                                customStep),
         this->ConstructComment(ccg), comment, depfile, cc->GetJobPool(),
-        cc->GetUsesTerminal(),
-        /*restat*/ !symbolic || !byproducts.empty(), fileConfig,
+        cc->GetUsesTerminal(), restat, fileConfig,
         std::move(ccOutputs), std::move(ninjaDeps),
         std::move(sortedOrderOnlyDeps));
     }
@@ -887,6 +898,43 @@ void cmLocalNinjaGenerator::WriteCustomCommandBuildStatements(
   }
 }
 
+void cmLocalNinjaGenerator::AppendPreserveUnchangedOutputsLines(
+  std::vector<std::string> const& outputs, std::string const& customStep,
+  std::vector<std::string>& cmdLines) const
+{
+  // Move the previous outputs aside before the command runs and move back
+  // those it rewrites with identical content afterwards.  Together with
+  // restat this stops Ninja from rebuilding what depends on them.
+  cmOutputConverter::OutputFormat const format =
+    this->GetGlobalNinjaGenerator()->IsMultiConfig()
+    ? cmOutputConverter::NINJAMULTI
+    : cmOutputConverter::SHELL;
+  std::string cmakeCmd = this->ConvertToOutputFormat(
+    cmSystemTools::GetCMakeCommand(), cmOutputConverter::SHELL);
+  std::string const& helper = this->GlobalGenerator->GetCommandHelper();
+  if (!helper.empty()) {
+    cmakeCmd = cmStrCat(
+      this->ConvertToOutputFormat(helper, cmOutputConverter::SHELL), ' ',
+      cmakeCmd);
+  }
+
+  std::string const stagingDir = cmStrCat(
+    this->GetCurrentBinaryDirectory(), "/CMakeFiles/", customStep, ".prev");
+  std::string args = this->ConvertToOutputFormat(stagingDir, format);
+  for (std::string const& output : outputs) {
+    args += cmStrCat(' ', this->ConvertToOutputFormat(output, format));
+  }
+
+  // The working directory of the commands is not yet changed before them,
+  // but may be after them, so all paths are absolute.
+  cmdLines.insert(cmdLines.begin(),
+                  cmStrCat(cmakeCmd,
+                           " -E cmake_preserve_unchanged_outputs stage ",
+                           args));
+  cmdLines.push_back(cmStrCat(
+    cmakeCmd, " -E cmake_preserve_unchanged_outputs restore ", args));
+}
+
 std::string cmLocalNinjaGenerator::MakeCustomLauncher(
   cmCustomCommandGenerator const& ccg)
 {
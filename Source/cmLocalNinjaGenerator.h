@@ -127,6 +127,10 @@ private:
 
   std::string MakeCustomLauncher(cmCustomCommandGenerator const& ccg);
 
+  void AppendPreserveUnchangedOutputsLines(
+    std::vector<std::string> const& outputs, std::string const& customStep,
+    std::vector<std::string>& cmdLines) const;
+
   std::string WriteCommandScript(std::vector<std::string> const& cmdLines,
                                  std::string const& outputConfig,
                                  std::string const& commandConfig,
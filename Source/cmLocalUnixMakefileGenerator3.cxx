@@ -1331,8 +1331,16 @@ void cmLocalUnixMakefileGenerator3::AppendEcho(
           cmd = cmStrCat("@echo ", this->EscapeForShell(line, false, true));
         } else {
           // Use cmake to echo the text in color.
+          std::string const& helper =
+            this->GetGlobalGenerator()->GetCommandHelper();
           cmd = cmStrCat(
-            "@$(CMAKE_COMMAND) -E cmake_echo_color \"--switch=$(COLOR)\" ",
+            '@',
+            helper.empty()
+              ? std::string()
+              : cmStrCat(this->ConvertToOutputFormat(
+                           helper, cmOutputConverter::SHELL),
+                         ' '),
+            "$(CMAKE_COMMAND) -E cmake_echo_color \"--switch=$(COLOR)\" ",
             color_name);
           if (progress) {
             cmd = cmStrCat(cmd, "--progress-dir=",
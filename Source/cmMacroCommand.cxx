@@ -2,10 +2,13 @@
    file LICENSE.rst or https://cmake.org/licensing for details.  */
 #include "cmMacroCommand.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <utility>
 
 #include <cm/memory>
+#include <cm/optional>
 #include <cm/string_view>
 #include <cmext/algorithm>
 #include <cmext/string_view>
@@ -25,6 +28,56 @@
 
 namespace {
 
+std::string const ARGC = "ARGC";
+std::string const ARGN = "ARGN";
+std::string const ARGV = "ARGV";
+
+// A piece of a macro body argument.  References to the macro arguments
+// are replaced by their values on every invocation.
+struct cmMacroArgumentPiece
+{
+  enum class Kind
+  {
+    Literal,
+    Formal,
+    Argc,
+    Argn,
+    Argv,
+    ArgvN,
+  };
+
+  Kind Type = Kind::Literal;
+  // The literal text, or the original text of a reference.
+  std::string Text;
+  // The index of a formal argument or of an ARGV<n> reference.
+  std::size_t Index = 0;
+};
+
+// A macro body argument split at the references to macro arguments.
+struct cmMacroArgumentTemplate
+{
+  enum class Kind
+  {
+    // The argument contains no references and is used unchanged.
+    Unchanged,
+    // The argument is formed by concatenating its pieces.
+    Pieces,
+    // The references cannot be replaced independently of each other,
+    // so each invocation replaces them one after another.
+    Sequential,
+  };
+
+  Kind Type = Kind::Unchanged;
+  std::vector<cmMacroArgumentPiece> Pieces;
+};
+
+// A command in a macro body with the templates of its arguments.
+struct cmMacroFunctionTemplate
+{
+  bool Unchanged = true;
+  std::vector<cmMacroArgumentTemplate> Arguments;
+};
+
 // define the class for macro commands
 class cmMacroHelperCommand
 {
@@ -36,13 +89,173 @@ public:
   bool operator()(std::vector<cmListFileArgument> const& args,
                   cmExecutionStatus& inStatus) const;
 
+  /**
+   * Split the arguments of the body commands at references to the macro
+   * arguments, once per macro definition.
+   */
+  void PrepareBody();
+
   std::vector<std::string> Args;
   std::vector<cmListFileFunction> Functions;
+  std::vector<cmMacroFunctionTemplate> Templates;
   cmPolicies::PolicyMap Policies;
   cmDiagnostics::DiagnosticMap Diagnostics;
   std::string FilePath;
+
+private:
+  bool UnusualNames = false;
+
+  cmMacroArgumentTemplate PrepareArgument(cmListFileArgument const& arg) const;
+  bool MatchReference(cm::string_view name, cmMacroArgumentPiece& piece) const;
 };
 
+// Whether substituting a value may form a reference that was not present
+// in the original text, or may not be done by plain concatenation.
+bool IsUnsafeMacroValue(std::string const& value)
+{
+  return value.find_first_of("${\0", 0, 3) != std::string::npos;
+}
+
+void cmMacroHelperCommand::PrepareBody()
+{
+  // A formal argument name that contains parts of the reference syntax
+  // may overlap with other references.
+  this->UnusualNames = std::any_of(
+    this->Args.begin() + 1, this->Args.end(), [](std::string const& name) {
+      return name.find_first_of("${}\0", 0, 4) != std::string::npos;
+    });
+
+  this->Templates.clear();
+  this->Templates.reserve(this->Functions.size());
+  for (cmListFileFunction const& func : this->Functions) {
+    cmMacroFunctionTemplate ft;
+    ft.Arguments.reserve(func.Arguments().size());
+    for (cmListFileArgument const& arg : func.Arguments()) {
+      cmMacroArgumentTemplate at = this->PrepareArgument(arg);
+      if (at.Type != cmMacroArgumentTemplate::Kind::Unchanged) {
+        ft.Unchanged = false;
+      }
+      ft.Arguments.push_back(std::move(at));
+    }
+    this->Templates.push_back(std::move(ft));
+  }
+}
+
+bool cmMacroHelperCommand::MatchReference(cm::string_view name,
+                                          cmMacroArgumentPiece& piece) const
+{
+  // Formal arguments are replaced first, so they take precedence.
+  for (std::size_t j = 1; j < this->Args.size(); ++j) {
+    if (name == this->Args[j]) {
+      piece.Type = cmMacroArgumentPiece::Kind::Formal;
+      piece.Index = j - 1;
+      return true;
+    }
+  }
+  if (name == ARGC) {
+    piece.Type = cmMacroArgumentPiece::Kind::Argc;
+    return true;
+  }
+  if (name == ARGN) {
+    piece.Type = cmMacroArgumentPiece::Kind::Argn;
+    return true;
+  }
+  if (name == ARGV) {
+    piece.Type = cmMacroArgumentPiece::Kind::Argv;
+    return true;
+  }
+  // Match the names ARGV0 ARGV1 ... exactly as they would be formatted.
+  if (!cmHasPrefix(name, ARGV)) {
+    return false;
+  }
+  cm::string_view const digits = name.substr(ARGV.size());
+  if (digits.empty() || digits.size() > 9 ||
+      (digits.size() > 1 && digits.front() == '0')) {
+    return false;
+  }
+  std::size_t index = 0;
+  for (char c : digits) {
+    if (c < '0' || c > '9') {
+      return false;
+    }
+    index = index * 10 + static_cast<std::size_t>(c - '0');
+  }
+  piece.Type = cmMacroArgumentPiece::Kind::ArgvN;
+  piece.Index = index;
+  return true;
+}
+
+cmMacroArgumentTemplate cmMacroHelperCommand::PrepareArgument(
+  cmListFileArgument const& arg) const
+{
+  cmMacroArgumentTemplate t;
+  if (arg.Delim == cmListFileArgument::Bracket) {
+    return t;
+  }
+
+  std::string const& text = arg.Value;
+  if (this->UnusualNames) {
+    if (text.find("${") != std::string::npos) {
+      t.Type = cmMacroArgumentTemplate::Kind::Sequential;
+    }
+    return t;
+  }
+
+  std::vector<cmMacroArgumentPiece> pieces;
+  // The positions of "${" that do not start a reference to a macro
+  // argument, each with the position of the next "}".
+  std::vector<std::pair<std::size_t, std::size_t>> unmatched;
+  std::vector<std::size_t> matched;
+  std::size_t pos = 0;
+  for (std::size_t p = text.find("${"); p != std::string::npos;
+       p = text.find("${", p + 2)) {
+    std::size_t const q = text.find('}', p + 2);
+    cmMacroArgumentPiece piece;
+    if (q == std::string::npos ||
+        !this->MatchReference(cm::string_view(text).substr(p + 2, q - p - 2),
+                              piece)) {
+      unmatched.emplace_back(p, q);
+      continue;
+    }
+    if (pos < p) {
+      cmMacroArgumentPiece literal;
+      literal.Text = text.substr(pos, p - pos);
+      pieces.push_back(std::move(literal));
+    }
+    piece.Text = text.substr(p, q + 1 - p);
+    pieces.push_back(std::move(piece));
+    matched.push_back(p);
+    pos = q + 1;
+    p = q - 1;
+  }
+  if (matched.empty()) {
+    return t;
+  }
+  if (pos < text.size()) {
+    cmMacroArgumentPiece literal;
+    literal.Text = text.substr(pos);
+    pieces.push_back(std::move(literal));
+  }
+
+  // Replacing a reference nested in another "${...}" may form a new
+  // reference, as in "${${name}}".  Embedded null characters end the
+  // text seen by replacement.  Keep the original replacement order then.
+  bool sequential = text.find('\0') != std::string::npos;
+  for (auto const& u : unmatched) {
+    auto it = std::upper_bound(matched.begin(), matched.end(), u.first);
+    if (it != matched.end() && *it < u.second) {
+      sequential = true;
+    }
+  }
+  if (sequential) {
+    t.Type = cmMacroArgumentTemplate::Kind::Sequential;
+    return t;
+  }
+  t.Type = cmMacroArgumentTemplate::Kind::Pieces;
+  t.Pieces = std::move(pieces);
+  return t;
+}
+
 bool cmMacroHelperCommand::operator()(
   std::vector<cmListFileArgument> const& args,
   cmExecutionStatus& inStatus) const
@@ -85,59 +298,109 @@ bool cmMacroHelperCommand::operator()(
       makefile.IssueCMP0219Warning(this->Args[0], expandedArgs);
     }
   }
+
+  // Values that could form new references when substituted are replaced
+  // one reference after another, as the text substitution always did.
+  bool const sequential =
+    std::any_of(expandedArgs.begin(), expandedArgs.end(), IsUnsafeMacroValue);
   std::vector<std::string> variables;
-  variables.reserve(this->Args.size() - 1);
-  for (unsigned int j = 1; j < this->Args.size(); ++j) {
-    variables.emplace_back(cmStrCat("${", this->Args[j], '}'));
-  }
   std::vector<std::string> argVs;
-  argVs.reserve(expandedArgs.size());
-  for (unsigned int j = 0; j < expandedArgs.size(); ++j) {
-    argVs.emplace_back(cmStrCat("${ARGV", j, '}'));
-  }
+  auto substitute = [&](std::string& value) {
+    if (variables.empty() && argVs.empty()) {
+      variables.reserve(this->Args.size() - 1);
+      for (unsigned int j = 1; j < this->Args.size(); ++j) {
+        variables.emplace_back(cmStrCat("${", this->Args[j], '}'));
+      }
+      argVs.reserve(expandedArgs.size());
+      for (unsigned int j = 0; j < expandedArgs.size(); ++j) {
+        argVs.emplace_back(cmStrCat("${ARGV", j, '}'));
+      }
+    }
+
+    // replace formal arguments
+    for (unsigned int j = 0; j < variables.size(); ++j) {
+      cmSystemTools::ReplaceString(value, variables[j], expandedArgs[j]);
+    }
+    // replace argc
+    cmSystemTools::ReplaceString(value, "${ARGC}", argcDef);
+
+    cmSystemTools::ReplaceString(value, "${ARGN}", expandedArgn);
+    cmSystemTools::ReplaceString(value, "${ARGV}", expandedArgv);
+
+    // if the current argument of the current function has ${ARGV in it
+    // then try replacing ARGV values
+    if (value.find("${ARGV") != std::string::npos) {
+      for (unsigned int t = 0; t < expandedArgs.size(); ++t) {
+        cmSystemTools::ReplaceString(value, argVs[t], expandedArgs[t]);
+      }
+    }
+  };
 
   cmMakefile::MacroPushPop macroScope(&makefile, this->FilePath,
                                       this->Policies, this->Diagnostics);
 
   // Invoke all the functions that were collected in the block.
   // for each function
-  for (cmListFileFunction const& func : this->Functions) {
-    // Replace the formal arguments and then invoke the command.
-    std::vector<cmListFileArgument> newLFFArgs;
-    newLFFArgs.reserve(func.Arguments().size());
-
-    // for each argument of the current function
-    for (cmListFileArgument const& k : func.Arguments()) {
-      cmListFileArgument arg;
-      arg.Value = k.Value;
-      if (k.Delim != cmListFileArgument::Bracket) {
-        // replace formal arguments
-        for (unsigned int j = 0; j < variables.size(); ++j) {
-          cmSystemTools::ReplaceString(arg.Value, variables[j],
-                                       expandedArgs[j]);
-        }
-        // replace argc
-        cmSystemTools::ReplaceString(arg.Value, "${ARGC}", argcDef);
+  for (std::size_t f = 0; f < this->Functions.size(); ++f) {
+    cmListFileFunction const& func = this->Functions[f];
+    cmMacroFunctionTemplate const& ft = this->Templates[f];
 
-        cmSystemTools::ReplaceString(arg.Value, "${ARGN}", expandedArgn);
-        cmSystemTools::ReplaceString(arg.Value, "${ARGV}", expandedArgv);
+    // Replace the formal arguments and then invoke the command.
+    // Commands without references to them are invoked as they are.
+    cm::optional<cmListFileFunction> newLFF;
+    if (!ft.Unchanged) {
+      std::vector<cmListFileArgument> newLFFArgs;
+      newLFFArgs.reserve(func.Arguments().size());
 
-        // if the current argument of the current function has ${ARGV in it
-        // then try replacing ARGV values
-        if (arg.Value.find("${ARGV") != std::string::npos) {
-          for (unsigned int t = 0; t < expandedArgs.size(); ++t) {
-            cmSystemTools::ReplaceString(arg.Value, argVs[t], expandedArgs[t]);
+      // for each argument of the current function
+      for (std::size_t a = 0; a < func.Arguments().size(); ++a) {
+        cmListFileArgument const& k = func.Arguments()[a];
+        cmMacroArgumentTemplate const& at = ft.Arguments[a];
+        if (at.Type == cmMacroArgumentTemplate::Kind::Unchanged) {
+          newLFFArgs.push_back(k);
+          continue;
+        }
+        cmListFileArgument arg;
+        if (sequential ||
+            at.Type == cmMacroArgumentTemplate::Kind::Sequential) {
+          arg.Value = k.Value;
+          substitute(arg.Value);
+        } else {
+          for (cmMacroArgumentPiece const& piece : at.Pieces) {
+            switch (piece.Type) {
+              case cmMacroArgumentPiece::Kind::Literal:
+                arg.Value += piece.Text;
+                break;
+              case cmMacroArgumentPiece::Kind::Formal:
+                arg.Value += expandedArgs[piece.Index];
+                break;
+              case cmMacroArgumentPiece::Kind::Argc:
+                arg.Value += argcDef;
+                break;
+              case cmMacroArgumentPiece::Kind::Argn:
+                arg.Value += expandedArgn;
+                break;
+              case cmMacroArgumentPiece::Kind::Argv:
+                arg.Value += expandedArgv;
+                break;
+              case cmMacroArgumentPiece::Kind::ArgvN:
+                arg.Value += piece.Index < expandedArgs.size()
+                  ? expandedArgs[piece.Index]
+                  : piece.Text;
+                break;
+            }
           }
         }
+        arg.Delim = k.Delim;
+        arg.Line = k.Line;
+        newLFFArgs.push_back(std::move(arg));
       }
-      arg.Delim = k.Delim;
-      arg.Line = k.Line;
-      newLFFArgs.push_back(std::move(arg));
+      newLFF.emplace(func.OriginalName(), func.Line(), func.LineEnd(),
+                     std::move(newLFFArgs));
     }
-    cmListFileFunction newLFF{ func.OriginalName(), func.Line(),
-                               func.LineEnd(), std::move(newLFFArgs) };
     cmExecutionStatus status(makefile);
-    if (!makefile.ExecuteCommand(newLFF, status) || status.GetNestedError()) {
+    if (!makefile.ExecuteCommand(newLFF ? *newLFF : func, status) ||
+        status.GetNestedError()) {
       // The error message should have already included the call stack
       // so we do not need to report an error here.
       macroScope.Quiet();
@@ -201,6 +464,7 @@ bool cmMacroFunctionBlocker::Replay(std::vector<cmListFileFunction> functions,
   f.Args = this->Args;
   f.Functions = std::move(functions);
   f.FilePath = this->GetStartingContext().FilePath;
+  f.PrepareBody();
   mf.RecordPolicies(f.Policies);
   mf.RecordDiagnostics(f.Diagnostics);
   return mf.GetState()->AddScriptedCommand(
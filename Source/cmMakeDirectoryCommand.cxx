@@ -4,6 +4,7 @@
 
 #include "cmDiagnostics.h"
 #include "cmExecutionStatus.h"
+#include "cmFileSystemCache.h"
 #include "cmMakefile.h"
 #include "cmSystemTools.h"
 
@@ -29,5 +30,6 @@ bool cmMakeDirectoryCommand(std::vector<std::string> const& args,
     return false;
   }
   cmSystemTools::MakeDirectory(args[0]);
+  cmFileSystemCache::Invalidate();
   return true;
 }
@@ -33,6 +33,7 @@
 #ifndef CMAKE_BOOTSTRAP
 #  include "cmBuildSbomGenerator.h"
 #endif
+#include "cmCompiledArgument.h"
 #include "cmCustomCommand.h"
 #include "cmCustomCommandLines.h"
 #include "cmCustomCommandTypes.h"
@@ -40,7 +41,9 @@
 #include "cmExpandedCommandArgument.h" // IWYU pragma: keep
 #include "cmExportBuildFileGenerator.h"
 #include "cmFileLockPool.h"
+#include "cmFileSystemCache.h"
 #include "cmFunctionBlocker.h"
+#include "cmGenExMemo.h"
 #include "cmGeneratedFileStream.h"
 #include "cmGeneratorExpression.h"
 #include "cmGeneratorExpressionEvaluationFile.h"
@@ -69,6 +72,7 @@
 #include "cmake.h"
 
 #ifndef CMAKE_BOOTSTRAP
+#  include "cmListFilePrefetcher.h"
 #  include "cmMakefileProfilingData.h"
 #  include "cmVariableWatch.h"
 #endif
@@ -155,6 +159,32 @@ public:
     this->Makefile->MarkVariableAsUsed(kCMAKE_CURRENT_LIST_DIR);
   }
 };
+
+#if !defined(CMAKE_BOOTSTRAP)
+// Start parsing the list files of subdirectories that a directory adds
+// with a literal path, so they are ready when they are configured.
+void PrefetchSubdirectoryListFiles(
+  cmMakefile const& mf, std::vector<cmListFileFunction> const& functions)
+{
+  cmake* cm = mf.GetCMakeInstance();
+  cmListFilePrefetcher* prefetcher = cm->GetListFilePrefetcher();
+  if (!prefetcher) {
+    return;
+  }
+  for (cmListFileFunction const& func : functions) {
+    if (func.LowerCaseName() != "add_subdirectory"_s ||
+        func.Arguments().empty()) {
+      continue;
+    }
+    std::string const& dir = func.Arguments().front().Value;
+    if (dir.empty() || dir.find_first_of("$\\;") != std::string::npos) {
+      continue;
+    }
+    prefetcher->Prefetch(cm->GetCMakeListFile(cmSystemTools::CollapseFullPath(
+      dir, mf.GetCurrentSourceDirectory())));
+  }
+}
+#endif
 }
 
 class cmMessenger;
@@ -757,6 +787,10 @@ bool cmMakefile::ReadDependentFile(std::string const& filename,
   }
 #endif
 
+#if !defined(CMAKE_BOOTSTRAP)
+  PrefetchSubdirectoryListFiles(*this, listFile.Functions);
+#endif
+
   this->RunListFile(listFile, filenametoread);
   if (cmSystemTools::GetFatalErrorOccurred()) {
     incScope.Quiet();
@@ -1670,6 +1704,10 @@ void cmMakefile::Configure()
   }
 #endif
 
+#if !defined(CMAKE_BOOTSTRAP)
+  PrefetchSubdirectoryListFiles(*this, listFile.Functions);
+#endif
+
   if (this->IsRootMakefile()) {
     bool hasVersion = false;
     // search for the right policy command
@@ -1908,6 +1946,7 @@ void cmMakefile::AddSystemIncludeDirectories(std::set<std::string> const& incs)
 void cmMakefile::AddDefinition(std::string const& name, cm::string_view value)
 {
   this->StateSnapshot.SetDefinition(name, value);
+  this->GetCMakeInstance()->GetGenExMemo().Invalidate();
 
 #ifndef CMAKE_BOOTSTRAP
   cmVariableWatch* vv = this->GetVariableWatch();
@@ -2007,6 +2046,7 @@ void cmMakefile::MaybeWarnUninitialized(std::string const& variable,
 void cmMakefile::RemoveDefinition(std::string const& name)
 {
   this->StateSnapshot.RemoveDefinition(name);
+  this->GetCMakeInstance()->GetGenExMemo().Invalidate();
 #ifndef CMAKE_BOOTSTRAP
   cmVariableWatch* vv = this->GetVariableWatch();
   if (vv) {
@@ -3092,6 +3132,18 @@ bool cmMakefile::IsLoopBlock() const
   return !this->LoopBlockCounter.empty() && this->LoopBlockCounter.top() > 0;
 }
 
+cmCompiledArgument const& cmMakefile::CompileArgument(
+  cmListFileArgument const& arg) const
+{
+  // The compiled form is stored with the argument, which is shared by all
+  // copies of the cmListFileFunction that holds it.  Repeated invocations
+  // of a function or loop body reuse it.
+  if (!arg.Compiled) {
+    arg.Compiled = cmCompiledArgument::Compile(arg.Value);
+  }
+  return *arg.Compiled;
+}
+
 bool cmMakefile::ExpandArguments(std::vector<cmListFileArgument> const& inArgs,
                                  std::vector<std::string>& outArgs) const
 {
@@ -3104,10 +3156,25 @@ bool cmMakefile::ExpandArguments(std::vector<cmListFileArgument> const& inArgs,
       outArgs.push_back(i.Value);
       continue;
     }
+    cmCompiledArgument const& compiled = this->CompileArgument(i);
+    if (compiled.IsLiteral()) {
+      if (i.Delim == cmListFileArgument::Quoted) {
+        outArgs.push_back(compiled.GetLiteral());
+      } else {
+        outArgs.insert(outArgs.end(), compiled.GetLiteralList().begin(),
+                       compiled.GetLiteralList().end());
+      }
+      continue;
+    }
     // Expand the variables in the argument.
-    value = i.Value;
-    this->ExpandVariablesInString(value, false, false, false, filename.c_str(),
-                                  i.Line, false, false);
+    if (compiled.IsSupported()) {
+      value.clear();
+      compiled.Expand(*this, filename.c_str(), i.Line, value);
+    } else {
+      value = i.Value;
+      this->ExpandVariablesInString(value, false, false, false,
+                                    filename.c_str(), i.Line, false, false);
+    }
 
     // If the argument is quoted, it should be one argument.
     // Otherwise, it may be a list of arguments.
@@ -3133,10 +3200,26 @@ bool cmMakefile::ExpandArguments(
       outArgs.emplace_back(i.Value, true);
       continue;
     }
+    cmCompiledArgument const& compiled = this->CompileArgument(i);
+    if (compiled.IsLiteral()) {
+      if (i.Delim == cmListFileArgument::Quoted) {
+        outArgs.emplace_back(compiled.GetLiteral(), true);
+      } else {
+        for (std::string const& stringArg : compiled.GetLiteralList()) {
+          outArgs.emplace_back(stringArg, false);
+        }
+      }
+      continue;
+    }
     // Expand the variables in the argument.
-    value = i.Value;
-    this->ExpandVariablesInString(value, false, false, false, filename.c_str(),
-                                  i.Line, false, false);
+    if (compiled.IsSupported()) {
+      value.clear();
+      compiled.Expand(*this, filename.c_str(), i.Line, value);
+    } else {
+      value = i.Value;
+      this->ExpandVariablesInString(value, false, false, false,
+                                    filename.c_str(), i.Line, false, false);
+    }
 
     // If the argument is quoted, it should be one argument.
     // Otherwise, it may be a list of arguments.
@@ -3353,7 +3436,8 @@ int cmMakefile::TryCompile(std::string const& srcdir,
                            std::string const& projectName,
                            std::string const& targetName, bool fast, int jobs,
                            std::vector<std::string> const* cmakeArgs,
-                           std::string& output)
+                           std::string& output,
+                           cmDeferredTryCompile* deferred)
 {
   this->IsSourceFileTryCompile = fast;
   // does the binary directory exist ? If not create it...
@@ -3479,7 +3563,7 @@ int cmMakefile::TryCompile(std::string const& srcdir,
 
   // finally call the generator to actually build the resulting project
   int ret = this->GetGlobalGenerator()->TryCompile(
-    jobs, bindir, projectName, targetName, fast, output, this);
+    jobs, bindir, projectName, targetName, fast, output, this, deferred);
 
   this->IsSourceFileTryCompile = false;
   return ret;
@@ -3731,6 +3815,7 @@ int cmMakefile::ConfigureFile(std::string const& infile,
   if (copyonly) {
     auto const copy_status =
       cmSystemTools::CopyFileIfDifferent(sinfile, soutfile);
+    cmFileSystemCache::Invalidate();
     if (!copy_status) {
       this->IssueMessage(
         MessageType::FATAL_ERROR,
@@ -3798,6 +3883,7 @@ int cmMakefile::ConfigureFile(std::string const& infile,
   fout.close();
 
   auto status = cmSystemTools::MoveFileIfDifferent(tempOutputFile, soutfile);
+  cmFileSystemCache::Invalidate();
   if (!status) {
     this->IssueMessage(MessageType::FATAL_ERROR, status.GetString());
     res = 0;
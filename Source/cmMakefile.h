@@ -50,8 +50,10 @@
 enum class cmCustomCommandType;
 enum class cmObjectLibraryCommands;
 
+class cmCompiledArgument;
 class cmCompiledGeneratorExpression;
 class cmCustomCommandLines;
+struct cmDeferredTryCompile;
 class cmExecutionStatus;
 class cmExpandedCommandArgument;
 class cmBuildSbomGenerator;
@@ -148,12 +150,16 @@ public:
   /**
    * Try running cmake and building a file. This is used for dynamically
    * loaded commands, not as part of the usual build process.
+   *
+   * If \p deferred is given, the test project is not built.  Instead its
+   * build commands are filled in for cmGlobalGenerator::DeferTryCompile.
    */
   int TryCompile(std::string const& srcdir, std::string const& bindir,
                  std::string const& projectName, std::string const& targetName,
                  bool fast, int jobs,
                  std::vector<std::string> const* cmakeArgs,
-                 std::string& output);
+                 std::string& output,
+                 cmDeferredTryCompile* deferred = nullptr);
 
   bool GetIsSourceFileTryCompile() const;
 
@@ -1348,6 +1354,9 @@ private:
                                           bool atOnly, char const* filename,
                                           long line, bool replaceAt) const;
 
+  cmCompiledArgument const& CompileArgument(
+    cmListFileArgument const& arg) const;
+
   bool ValidateCustomCommand(cmCustomCommandLines const& commandLines) const;
 
   void CreateGeneratedOutputs(std::vector<std::string> const& outputs);
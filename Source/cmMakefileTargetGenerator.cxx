@@ -1122,7 +1122,9 @@ void cmMakefileTargetGenerator::WriteObjectRuleFiles(
 
     if (!skipCodeCheck) {
       std::string const codeCheck = this->GenerateCodeCheckRules(
-        source, compilerLauncher, "$(CMAKE_COMMAND)", config, nullptr);
+        source, compilerLauncher,
+        this->GetCommandHelperCMakeCommand("$(CMAKE_COMMAND)"), config,
+        nullptr);
       if (!codeCheck.empty()) {
         compileCommands.front().insert(0, codeCheck);
       }
@@ -0,0 +1,72 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#include "cmMappedFile.h"
+
+#ifdef _WIN32
+#  include <windows.h>
+
+#  include "cmsys/Encoding.hxx"
+#else
+#  include <fcntl.h>
+#  include <unistd.h>
+
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#endif
+
+cmMappedFile::cmMappedFile(std::string const& path)
+{
+#ifdef _WIN32
+  HANDLE file =
+    CreateFileW(cmsys::Encoding::ToWindowsExtendedPath(path).c_str(),
+                GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return;
+  }
+  LARGE_INTEGER size;
+  if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+    this->Mapping =
+      CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (this->Mapping) {
+      this->Data = static_cast<char const*>(
+        MapViewOfFile(this->Mapping, FILE_MAP_READ, 0, 0, 0));
+      if (this->Data) {
+        this->Size = static_cast<std::size_t>(size.QuadPart);
+      }
+    }
+  }
+  CloseHandle(file);
+#else
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return;
+  }
+  struct stat st;
+  if (fstat(fd, &st) == 0 && st.st_size > 0) {
+    void* data = mmap(nullptr, static_cast<std::size_t>(st.st_size),
+                      PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data != MAP_FAILED) {
+      this->Data = static_cast<char const*>(data);
+      this->Size = static_cast<std::size_t>(st.st_size);
+    }
+  }
+  close(fd);
+#endif
+}
+
+cmMappedFile::~cmMappedFile()
+{
+#ifdef _WIN32
+  if (this->Data) {
+    UnmapViewOfFile(this->Data);
+  }
+  if (this->Mapping) {
+    CloseHandle(this->Mapping);
+  }
+#else
+  if (this->Data) {
+    munmap(const_cast<char*>(this->Data), this->Size);
+  }
+#endif
+}
@@ -0,0 +1,33 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#pragma once
+
+#include "cmConfigure.h" // IWYU pragma: keep
+
+#include <cstddef>
+#include <string>
+
+/** \class cmMappedFile
+ * \brief Map a file into memory read-only for the lifetime of the object.
+ *
+ * An empty file or a file that cannot be mapped has no data.
+ */
+class cmMappedFile
+{
+public:
+  explicit cmMappedFile(std::string const& path);
+  ~cmMappedFile();
+
+  cmMappedFile(cmMappedFile const&) = delete;
+  cmMappedFile& operator=(cmMappedFile const&) = delete;
+
+  char const* GetData() const { return this->Data; }
+  std::size_t GetSize() const { return this->Size; }
+
+private:
+#ifdef _WIN32
+  void* Mapping = nullptr;
+#endif
+  char const* Data = nullptr;
+  std::size_t Size = 0;
+};
@@ -0,0 +1,284 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#include "cmNinjaOutputQueue.h"
+
+#include <algorithm>
+#include <ostream>
+#include <utility>
+
+#include <cm/memory>
+
+#include "cmsys/FStream.hxx"
+
+#include "cmCryptoHash.h"
+#include "cmGeneratedFileStream.h"
+#include "cmStringAlgorithms.h"
+#include "cmSystemTools.h"
+
+cmNinjaOutputQueue::cmNinjaOutputQueue(Formatter formatter,
+                                       unsigned int threads)
+  : FormatBuild(std::move(formatter))
+  , Current(cm::make_unique<Chunk>())
+{
+  this->Threads.reserve(threads);
+  for (unsigned int i = 0; i < threads; ++i) {
+    this->Threads.emplace_back([this]() { this->Work(); });
+  }
+}
+
+cmNinjaOutputQueue::~cmNinjaOutputQueue()
+{
+  this->Finish();
+}
+
+void cmNinjaOutputQueue::Capture(std::ostream& os, std::string fragmentName)
+{
+  if (this->Finished ||
+      std::any_of(this->Captures.begin(), this->Captures.end(),
+                  [&os](std::unique_ptr<CapturedStream> const& capture) {
+                    return capture->Stream == &os;
+                  })) {
+    return;
+  }
+  auto capture = cm::make_unique<CapturedStream>();
+  capture->Stream = &os;
+  capture->File = os.rdbuf();
+  capture->State = os.rdstate();
+  capture->FragmentName = std::move(fragmentName);
+  os.rdbuf(&capture->Buffer);
+  this->Captures.emplace_back(std::move(capture));
+}
+
+void cmNinjaOutputQueue::SetFragmentOptions(IncludePath includePath,
+                                            codecvt_Encoding encoding)
+{
+  this->FragmentIncludePath = std::move(includePath);
+  this->FragmentEncoding = encoding;
+}
+
+bool cmNinjaOutputQueue::Defer(std::ostream& os, cmNinjaBuild const& build,
+                               int cmdLineLimit)
+{
+  if (this->Finished) {
+    return false;
+  }
+  for (std::size_t i = 0; i < this->Captures.size(); ++i) {
+    if (this->Captures[i]->Stream != &os) {
+      continue;
+    }
+    // Keep the text written before the statement in front of it.
+    this->TakeBuffer(i);
+    this->Current->Segments.emplace_back();
+    Segment& segment = this->Current->Segments.back();
+    segment.Stream = i;
+    segment.Build = cm::make_unique<cmNinjaBuild>(build);
+    segment.CmdLineLimit = cmdLineLimit;
+    ++this->Statements;
+    return true;
+  }
+  return false;
+}
+
+void cmNinjaOutputQueue::Cut(std::string const& fragmentDirectory)
+{
+  if (this->Finished) {
+    return;
+  }
+  for (std::size_t i = 0; i < this->Captures.size(); ++i) {
+    this->TakeBuffer(i);
+  }
+  if (this->Current->Segments.empty()) {
+    return;
+  }
+
+  bool const needsFormat =
+    std::any_of(this->Current->Segments.begin(), this->Current->Segments.end(),
+                [](Segment const& segment) { return !!segment.Build; });
+  this->Current->Claimed = !needsFormat;
+  this->Current->Formatted = !needsFormat;
+  if (this->FragmentIncludePath) {
+    this->Current->FragmentDirectory = fragmentDirectory;
+  }
+
+  std::unique_lock<std::mutex> lock(this->Mutex);
+  ++this->Chunks;
+  this->Pending.emplace_back(std::move(this->Current));
+  this->Current = cm::make_unique<Chunk>();
+  if (needsFormat) {
+    this->WorkAvailable.notify_one();
+  }
+  this->Write(lock, false);
+}
+
+void cmNinjaOutputQueue::Finish()
+{
+  if (this->Finished) {
+    return;
+  }
+  this->Cut();
+  {
+    std::unique_lock<std::mutex> lock(this->Mutex);
+    this->Write(lock, true);
+    this->Stopping = true;
+  }
+  this->WorkAvailable.notify_all();
+  for (std::thread& thread : this->Threads) {
+    thread.join();
+  }
+  this->Threads.clear();
+
+  for (std::unique_ptr<CapturedStream> const& capture : this->Captures) {
+    capture->Stream->rdbuf(capture->File);
+    capture->Stream->clear(capture->State);
+  }
+  this->Finished = true;
+}
+
+Json::Value cmNinjaOutputQueue::GetStatistics() const
+{
+  std::lock_guard<std::mutex> lock(this->Mutex);
+  Json::Value stats = Json::objectValue;
+  stats["chunks"] = static_cast<Json::UInt64>(this->Chunks);
+  stats["statements"] = static_cast<Json::UInt64>(this->Statements);
+  stats["stalls"] = static_cast<Json::UInt64>(this->Stalls);
+  stats["fragments_written"] =
+    static_cast<Json::UInt64>(this->FragmentsWritten);
+  stats["fragments_unchanged"] =
+    static_cast<Json::UInt64>(this->FragmentsUnchanged);
+  return stats;
+}
+
+void cmNinjaOutputQueue::TakeBuffer(std::size_t stream)
+{
+  std::stringbuf& buffer = this->Captures[stream]->Buffer;
+  std::string text = buffer.str();
+  if (text.empty()) {
+    return;
+  }
+  buffer.str(std::string());
+  this->Current->Segments.emplace_back();
+  Segment& segment = this->Current->Segments.back();
+  segment.Stream = stream;
+  segment.Text = std::move(text);
+}
+
+void cmNinjaOutputQueue::Format(Chunk& chunk) const
+{
+  for (Segment& segment : chunk.Segments) {
+    if (segment.Build) {
+      std::ostringstream os;
+      this->FormatBuild(os, *segment.Build, segment.CmdLineLimit);
+      segment.Text = os.str();
+      segment.Build.reset();
+    }
+  }
+}
+
+void cmNinjaOutputQueue::Write(std::unique_lock<std::mutex>& lock, bool all)
+{
+  // Let the main thread run ahead of the workers only this far.
+  std::size_t const limit = 4 * (this->Threads.size() + 1);
+
+  while (!this->Pending.empty()) {
+    Chunk& head = *this->Pending.front();
+    if (!head.Formatted) {
+      if (!all && this->Pending.size() <= limit) {
+        return;
+      }
+      if (!head.Claimed) {
+        head.Claimed = true;
+        lock.unlock();
+        this->Format(head);
+        lock.lock();
+        head.Formatted = true;
+      } else {
+        ++this->Stalls;
+        this->WorkDone.wait(lock, [&head]() { return head.Formatted; });
+      }
+    }
+
+    std::unique_ptr<Chunk> chunk = std::move(this->Pending.front());
+    this->Pending.pop_front();
+    lock.unlock();
+    if (chunk->FragmentDirectory.empty()) {
+      for (Segment const& segment : chunk->Segments) {
+        std::string const& text = segment.Text;
+        this->Captures[segment.Stream]->File->sputn(
+          text.data(), static_cast<std::streamsize>(text.size()));
+      }
+    } else {
+      this->WriteFragments(*chunk);
+    }
+    lock.lock();
+  }
+}
+
+void cmNinjaOutputQueue::WriteFragments(Chunk const& chunk)
+{
+  std::vector<std::string> fragments(this->Captures.size());
+  for (Segment const& segment : chunk.Segments) {
+    CapturedStream& capture = *this->Captures[segment.Stream];
+    if (capture.FragmentName.empty()) {
+      capture.File->sputn(segment.Text.data(),
+                          static_cast<std::streamsize>(segment.Text.size()));
+    } else {
+      fragments[segment.Stream] += segment.Text;
+    }
+  }
+
+  for (std::size_t i = 0; i < fragments.size(); ++i) {
+    std::string const& content = fragments[i];
+    if (content.empty()) {
+      continue;
+    }
+    std::string const path =
+      cmStrCat(chunk.FragmentDirectory, '/', this->Captures[i]->FragmentName);
+    std::string const header =
+      cmStrCat("# Fragment content hash: ",
+               cmCryptoHash(cmCryptoHash::AlgoSHA256).HashString(content));
+
+    std::string firstLine;
+    cmsys::ifstream fin(path.c_str(), std::ios::in | std::ios::binary);
+    if (fin && cmSystemTools::GetLineFromStream(fin, firstLine) &&
+        firstLine == header) {
+      ++this->FragmentsUnchanged;
+    } else {
+      fin.close();
+      cmGeneratedFileStream fout(path, false, this->FragmentEncoding);
+      fout << header << '\n';
+      fout.write(content.data(), static_cast<std::streamsize>(content.size()));
+      ++this->FragmentsWritten;
+    }
+
+    std::string const include = cmStrCat(
+      header, "\ninclude ", this->FragmentIncludePath(path), "\n\n");
+    this->Captures[i]->File->sputn(
+      include.data(), static_cast<std::streamsize>(include.size()));
+  }
+}
+
+void cmNinjaOutputQueue::Work()
+{
+  std::unique_lock<std::mutex> lock(this->Mutex);
+  for (;;) {
+    Chunk* chunk = nullptr;
+    this->WorkAvailable.wait(lock, [this, &chunk]() {
+      for (std::unique_ptr<Chunk> const& pending : this->Pending) {
+        if (!pending->Claimed) {
+          chunk = pending.get();
+          return true;
+        }
+      }
+      return this->Stopping;
+    });
+    if (!chunk) {
+      return;
+    }
+    chunk->Claimed = true;
+    lock.unlock();
+    this->Format(*chunk);
+    lock.lock();
+    chunk->Formatted = true;
+    this->WorkDone.notify_all();
+  }
+}
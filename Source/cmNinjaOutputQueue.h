@@ -0,0 +1,133 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#pragma once
+
+#include "cmConfigure.h" // IWYU pragma: keep
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cm3p/json/value.h>
+
+#include "cm_codecvt_Encoding.hxx"
+
+#include "cmNinjaTypes.h"
+
+/** \class cmNinjaOutputQueue
+ * \brief Buffer the output of the Ninja generators to write it in chunks.
+ *
+ * The target generators compute the build statements of one target after
+ * another on the main thread.  While a queue exists, everything written
+ * to the captured Ninja file streams goes to a buffer instead, and build
+ * statements are recorded to be formatted later.  The buffered output is
+ * cut into chunks, one per target.  Worker threads format the chunks,
+ * and the main thread appends them to the files in the order in which
+ * they were cut, so the files do not depend on the number of threads.
+ *
+ * The formatter runs on the worker threads, so it may read only state
+ * that does not change during the generate step.
+ *
+ * A chunk may also be written to fragment files in a directory of its
+ * own, one per captured stream, which the captured streams include.
+ * The first line of a fragment holds a hash of its content, and the
+ * include statement repeats it.  A fragment whose hash did not change
+ * is not written again, so its timestamp is preserved, while the file
+ * including it still changes whenever the fragment does.
+ */
+class cmNinjaOutputQueue
+{
+public:
+  using Formatter =
+    std::function<void(std::ostream&, cmNinjaBuild const&, int)>;
+  using IncludePath = std::function<std::string(std::string const&)>;
+
+  cmNinjaOutputQueue(Formatter formatter, unsigned int threads);
+  ~cmNinjaOutputQueue();
+
+  cmNinjaOutputQueue(cmNinjaOutputQueue const&) = delete;
+  cmNinjaOutputQueue& operator=(cmNinjaOutputQueue const&) = delete;
+
+  /** Capture a stream until Finish is called.  Fragments of the stream
+      are written to files of the given name, or inline if it is empty.  */
+  void Capture(std::ostream& os, std::string fragmentName = std::string());
+
+  /** Write fragment files with the given encoding.  The callback gives
+      the path of a fragment file as written in an include statement.  */
+  void SetFragmentOptions(IncludePath includePath,
+                          codecvt_Encoding encoding);
+
+  /** Record a build statement to be formatted later.  Returns false if
+      the stream is not captured.  */
+  bool Defer(std::ostream& os, cmNinjaBuild const& build, int cmdLineLimit);
+
+  /** End the current chunk, typically after a target.  If a directory
+      is given, write the chunk to fragment files in it.  */
+  void Cut(std::string const& fragmentDirectory = std::string());
+
+  /** Write all output to the files and stop capturing the streams.  */
+  void Finish();
+
+  /** Get counters for the profiling output.  */
+  Json::Value GetStatistics() const;
+
+private:
+  struct CapturedStream
+  {
+    std::ostream* Stream;
+    std::streambuf* File;
+    std::ios::iostate State;
+    std::stringbuf Buffer;
+    std::string FragmentName;
+  };
+
+  struct Segment
+  {
+    std::size_t Stream;
+    std::string Text;
+    std::unique_ptr<cmNinjaBuild> Build;
+    int CmdLineLimit = 0;
+  };
+
+  struct Chunk
+  {
+    std::vector<Segment> Segments;
+    std::string FragmentDirectory;
+    bool Claimed = false;
+    bool Formatted = false;
+  };
+
+  void TakeBuffer(std::size_t stream);
+  void Format(Chunk& chunk) const;
+  void Write(std::unique_lock<std::mutex>& lock, bool all);
+  void WriteFragments(Chunk const& chunk);
+  void Work();
+
+  Formatter FormatBuild;
+  IncludePath FragmentIncludePath;
+  codecvt_Encoding FragmentEncoding = codecvt_Encoding::None;
+  std::vector<std::unique_ptr<CapturedStream>> Captures;
+  std::unique_ptr<Chunk> Current;
+  bool Finished = false;
+
+  mutable std::mutex Mutex;
+  std::condition_variable WorkAvailable;
+  std::condition_variable WorkDone;
+  std::deque<std::unique_ptr<Chunk>> Pending;
+  std::vector<std::thread> Threads;
+  bool Stopping = false;
+
+  std::size_t Chunks = 0;
+  std::size_t Statements = 0;
+  std::size_t Stalls = 0;
+  std::size_t FragmentsWritten = 0;
+  std::size_t FragmentsUnchanged = 0;
+};
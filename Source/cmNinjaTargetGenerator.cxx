@@ -936,7 +936,8 @@ void cmNinjaTargetGenerator::WriteCompileRule(std::string const& lang,
       std::vector<std::string> ddCmds;
       {
         std::string ccmd = cmStrCat(
-          cmakeCmd, " -E cmake_ninja_dyndep --tdi=", tdi, " --lang=", lang,
+          this->GetCommandHelperCMakeCommand(cmakeCmd),
+          " -E cmake_ninja_dyndep --tdi=", tdi, " --lang=", lang,
           ddModmapArg, " --dd=$out @", rule.RspFile);
         ddCmds.emplace_back(std::move(ccmd));
       }
@@ -1629,8 +1630,8 @@ void cmNinjaTargetGenerator::WriteObjectBuildStatement(
          : this->GetGeneratorTarget()->GetPropertyAsBool("SKIP_LINTING"));
 
   if (!skipCodeCheck) {
-    auto const cmakeCmd =
-      this->ConvertToOutputFormatForShell(cmSystemTools::GetCMakeCommand());
+    auto const cmakeCmd = this->GetCommandHelperCMakeCommand(
+      this->ConvertToOutputFormatForShell(cmSystemTools::GetCMakeCommand()));
     vars["CODE_CHECK"] =
       this->GenerateCodeCheckRules(*source, compilerLauncher, cmakeCmd, config,
                                    [this](std::string const& path) {
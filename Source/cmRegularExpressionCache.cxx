@@ -0,0 +1,118 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#include "cmRegularExpressionCache.h"
+
+#include <utility>
+
+#include <cm/memory>
+
+cmRegularExpressionCache::Lease::Lease(std::string const& pattern)
+  : Regex(cm::make_unique<cmsys::RegularExpression>(pattern))
+{
+}
+
+cmRegularExpressionCache::Lease::Lease(
+  cmRegularExpressionCache* cache, std::string pattern,
+  std::unique_ptr<cmsys::RegularExpression> regex)
+  : Cache(cache)
+  , Pattern(std::move(pattern))
+  , Regex(std::move(regex))
+{
+}
+
+cmRegularExpressionCache::Lease::~Lease()
+{
+  this->Release();
+}
+
+cmRegularExpressionCache::Lease::Lease(Lease&& other) noexcept
+  : Cache(other.Cache)
+  , Pattern(std::move(other.Pattern))
+  , Regex(std::move(other.Regex))
+{
+  other.Cache = nullptr;
+}
+
+cmRegularExpressionCache::Lease& cmRegularExpressionCache::Lease::operator=(
+  Lease&& other) noexcept
+{
+  if (this != &other) {
+    this->Release();
+    this->Cache = other.Cache;
+    this->Pattern = std::move(other.Pattern);
+    this->Regex = std::move(other.Regex);
+    other.Cache = nullptr;
+  }
+  return *this;
+}
+
+void cmRegularExpressionCache::Lease::Release()
+{
+  if (this->Cache && this->Regex) {
+    this->Cache->Release(std::move(this->Pattern), std::move(this->Regex));
+  }
+  this->Cache = nullptr;
+}
+
+cmRegularExpressionCache::cmRegularExpressionCache(std::size_t capacity)
+  : Capacity(capacity)
+{
+}
+
+cmRegularExpressionCache::Lease cmRegularExpressionCache::Acquire(
+  std::string const& pattern)
+{
+  auto it = this->Index.find(pattern);
+  if (it == this->Index.end()) {
+    ++this->Misses;
+    auto regex = cm::make_unique<cmsys::RegularExpression>(pattern);
+    if (!regex->is_valid()) {
+      return Lease(nullptr, pattern, std::move(regex));
+    }
+    return Lease(this, pattern, std::move(regex));
+  }
+
+  ++this->Hits;
+  EntryList::iterator entry = it->second;
+  Lease lease(this, std::move(entry->Pattern), std::move(entry->Regex));
+  this->Index.erase(it);
+  this->Entries.erase(entry);
+  return lease;
+}
+
+cmRegularExpressionCache::Lease cmRegularExpressionCache::Acquire(
+  cmRegularExpressionCache* cache, std::string const& pattern)
+{
+  if (cache) {
+    return cache->Acquire(pattern);
+  }
+  return Lease(pattern);
+}
+
+void cmRegularExpressionCache::Release(
+  std::string pattern, std::unique_ptr<cmsys::RegularExpression> regex)
+{
+  if (this->Capacity == 0 || this->Index.count(pattern)) {
+    // A nested use of the same pattern was returned first.
+    return;
+  }
+  while (this->Entries.size() >= this->Capacity) {
+    this->Index.erase(this->Entries.back().Pattern);
+    this->Entries.pop_back();
+    ++this->Evictions;
+  }
+  this->Entries.push_front(Entry{ std::move(pattern), std::move(regex) });
+  this->Index.emplace(this->Entries.front().Pattern, this->Entries.begin());
+}
+
+#if !defined(CMAKE_BOOTSTRAP)
+Json::Value cmRegularExpressionCache::GetStatistics() const
+{
+  Json::Value stats = Json::objectValue;
+  stats["hits"] = static_cast<Json::UInt64>(this->Hits);
+  stats["misses"] = static_cast<Json::UInt64>(this->Misses);
+  stats["evictions"] = static_cast<Json::UInt64>(this->Evictions);
+  stats["size"] = static_cast<Json::UInt64>(this->Entries.size());
+  return stats;
+}
+#endif
@@ -0,0 +1,110 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#pragma once
+
+#include "cmConfigure.h" // IWYU pragma: keep
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "cmsys/RegularExpression.hxx"
+
+#if !defined(CMAKE_BOOTSTRAP)
+#  include <cm3p/json/value.h>
+#endif
+
+/** \class cmRegularExpressionCache
+ * \brief Bounded cache of compiled regular expressions.
+ *
+ * Commands like string(REGEX), list(FILTER) and if(MATCHES) get their
+ * pattern as a string and used to compile it on every invocation.
+ * cmRegularExpressionCache keeps the most recently used compiled
+ * patterns, keyed by the pattern string, and evicts the least recently
+ * used one once the capacity is reached.
+ *
+ * A cmsys::RegularExpression also holds the state of its last match.
+ * A compiled pattern is therefore lent out exclusively: while a Lease
+ * is alive, the pattern is not in the cache, and a nested request for
+ * the same pattern compiles a separate copy.  Destroying the Lease
+ * returns the compiled pattern to the cache.
+ */
+class cmRegularExpressionCache
+{
+public:
+  static std::size_t const DefaultCapacity = 256;
+
+  cmRegularExpressionCache(std::size_t capacity = DefaultCapacity);
+
+  cmRegularExpressionCache(cmRegularExpressionCache const&) = delete;
+  cmRegularExpressionCache& operator=(cmRegularExpressionCache const&) =
+    delete;
+
+  class Lease
+  {
+  public:
+    /** Compile a pattern without a cache.  */
+    Lease(std::string const& pattern);
+    ~Lease();
+
+    Lease(Lease&& other) noexcept;
+    Lease& operator=(Lease&& other) noexcept;
+    Lease(Lease const&) = delete;
+    Lease& operator=(Lease const&) = delete;
+
+    cmsys::RegularExpression& operator*() const { return *this->Regex; }
+    cmsys::RegularExpression* operator->() const { return this->Regex.get(); }
+
+  private:
+    friend class cmRegularExpressionCache;
+    Lease(cmRegularExpressionCache* cache, std::string pattern,
+          std::unique_ptr<cmsys::RegularExpression> regex);
+
+    void Release();
+
+    cmRegularExpressionCache* Cache = nullptr;
+    std::string Pattern;
+    std::unique_ptr<cmsys::RegularExpression> Regex;
+  };
+
+  /**
+   * @brief Get the compiled form of a pattern.
+   *
+   * The result is valid even if the pattern failed to compile; check
+   * is_valid() on it.  Patterns that fail to compile are not cached.
+   */
+  Lease Acquire(std::string const& pattern);
+
+  /** Get a compiled pattern, using the cache only if one is given.  */
+  static Lease Acquire(cmRegularExpressionCache* cache,
+                       std::string const& pattern);
+
+  std::size_t GetCapacity() const { return this->Capacity; }
+
+#if !defined(CMAKE_BOOTSTRAP)
+  /** Hit, miss and eviction counts for the profiling output.  */
+  Json::Value GetStatistics() const;
+#endif
+
+private:
+  struct Entry
+  {
+    std::string Pattern;
+    std::unique_ptr<cmsys::RegularExpression> Regex;
+  };
+  using EntryList = std::list<Entry>;
+
+  void Release(std::string pattern,
+               std::unique_ptr<cmsys::RegularExpression> regex);
+
+  std::size_t Capacity;
+  // Most recently used entries first.
+  EntryList Entries;
+  std::unordered_map<std::string, EntryList::iterator> Index;
+
+  std::size_t Hits = 0;
+  std::size_t Misses = 0;
+  std::size_t Evictions = 0;
+};
@@ -7,6 +7,7 @@
 #include <cm/string_view>
 #include <cmext/string_view>
 
+#include "cmFileSystemCache.h"
 #include "cmGlobalGenerator.h"
 #include "cmList.h"
 #include "cmListFileCache.h"
@@ -180,7 +181,7 @@ bool cmSourceFile::FindFullPath(std::string* error,
         makefile->GetGlobalGenerator()->IsGeneratedFile(fullPath)) {
       this->IsGenerated = true;
     }
-    if (this->IsGenerated || cmSystemTools::FileExists(fullPath)) {
+    if (this->IsGenerated || cmFileSystemCache::FileExists(fullPath)) {
       this->FullPath = fullPath;
       return true;
     }
@@ -197,7 +198,7 @@ bool cmSourceFile::FindFullPath(std::string* error,
               makefile->GetGlobalGenerator()->IsGeneratedFile(extPath)) {
             this->IsGenerated = true;
           }
-          if (this->IsGenerated || cmSystemTools::FileExists(extPath)) {
+          if (this->IsGenerated || cmFileSystemCache::FileExists(extPath)) {
             this->FullPath = extPath;
             if (cmp0115 == cmPolicies::WARN) {
               std::string warning = cmStrCat("File:\n  "_s, extPath);
@@ -6,6 +6,7 @@
 
 #include <cm/string_view>
 
+#include "cmFileSystemCache.h"
 #include "cmGlobalGenerator.h"
 #include "cmMakefile.h"
 #include "cmMessageType.h"
@@ -132,7 +133,7 @@ void cmSourceFileLocation::UpdateExtension(std::string const& name)
       tryPath += "/";
     }
     tryPath += this->Name;
-    if (cmSystemTools::FileExists(tryPath, true)) {
+    if (cmFileSystemCache::FileExists(tryPath, true)) {
       // We found a source file named by the user on disk.  Trust it's
       // extension.
       this->Name = cmSystemTools::GetFilenameName(name);
@@ -22,6 +22,7 @@
 #include "cmListFileCache.h"
 #include "cmMakefile.h"
 #include "cmMessageType.h"
+#include "cmRegularExpressionCache.h"
 #include "cmStatePrivate.h"
 #include "cmStateSnapshot.h"
 #include "cmStringAlgorithms.h"
@@ -39,6 +40,7 @@ cmState::cmState(Role role, TryCompile isTryCompile)
 {
   this->CacheManager = cm::make_unique<cmCacheManager>();
   this->GlobVerificationManager = cm::make_unique<cmGlobVerificationManager>();
+  this->RegularExpressionCache = cm::make_unique<cmRegularExpressionCache>();
 }
 
 cmState::~cmState() = default;
@@ -559,11 +561,19 @@ bool cmState::AddScriptedCommand(std::string const& name,
     this->ScriptedCommands["_" + sName] = *oldCmd;
   }
 
+  if (this->CommandListener) {
+    this->CommandListener(name, type, command.Value);
+  }
   this->ScriptedCommands[sName] =
     CommandDescriptor{ type, std::move(command.Value) };
   return true;
 }
 
+void cmState::SetScriptedCommandListener(ScriptedCommandListener listener)
+{
+  this->CommandListener = std::move(listener);
+}
+
 cmState::CommandDescriptor const* cmState::GetCommandDescriptorByExactName(
   std::string const& name) const
 {
@@ -733,6 +743,12 @@ cmValue cmState::GetGlobalProperty(std::string const& prop)
   return this->GlobalProperties.GetPropertyValue(prop);
 }
 
+std::vector<std::pair<std::string, std::string>>
+cmState::GetGlobalPropertyList() const
+{
+  return this->GlobalProperties.GetList();
+}
+
 bool cmState::GetGlobalPropertyAsBool(std::string const& prop)
 {
   return this->GetGlobalProperty(prop).IsOn();
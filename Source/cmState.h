@@ -33,6 +33,7 @@ class cmMakefile;
 class cmStateSnapshot;
 class cmMessenger;
 class cmExecutionStatus;
+class cmRegularExpressionCache;
 class cmListFileBacktrace;
 struct cmGlobCacheEntry;
 struct cmListFileArgument;
@@ -202,11 +203,20 @@ public:
   void RemoveUserDefinedCommands();
   std::vector<std::string> GetCommandNames() const;
 
+  // Called for every scripted command added while it is set
+  using ScriptedCommandListener =
+    std::function<void(std::string const&, cmStateEnums::CommandType,
+                       Command const&)>;
+  void SetScriptedCommandListener(ScriptedCommandListener listener);
+
   void SetGlobalProperty(std::string const& prop, std::string const& value);
   void SetGlobalProperty(std::string const& prop, cmValue value);
   void AppendGlobalProperty(std::string const& prop, std::string const& value,
                             bool asString = false);
   cmValue GetGlobalProperty(std::string const& prop);
+  // Get a sorted by key list of the global properties that are set
+  std::vector<std::pair<std::string, std::string>> GetGlobalPropertyList()
+    const;
   bool GetGlobalPropertyAsBool(std::string const& prop);
 
   std::string const& GetSourceDirectory() const;
@@ -283,6 +293,12 @@ public:
   }
   bool IsReconfiguring() const { return this->Reconfiguring; }
 
+  //! Get the cache of compiled regular expressions used by commands.
+  cmRegularExpressionCache& GetRegularExpressionCache() const
+  {
+    return *this->RegularExpressionCache;
+  }
+
 private:
   friend class cmake;
   cmStateSnapshot Reset(cmStateSnapshot const& diagnosticState);
@@ -330,9 +346,11 @@ private:
   std::unordered_map<std::string, CommandDescriptor> BuiltinCommands;
   std::unordered_map<std::string, CommandDescriptor> ScriptedCommands;
   std::unordered_set<std::string> FlowControlCommands;
+  ScriptedCommandListener CommandListener;
   cmPropertyMap GlobalProperties;
   std::unique_ptr<cmCacheManager> CacheManager;
   std::unique_ptr<cmGlobVerificationManager> GlobVerificationManager;
+  std::unique_ptr<cmRegularExpressionCache> RegularExpressionCache;
 
   cmLinkedTree<cmStateDetail::BuildsystemDirectoryStateType>
     BuildsystemDirectory;
@@ -9,6 +9,7 @@
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 #include <cm/iterator>
 #include <cmext/algorithm>
@@ -371,6 +372,12 @@ void cmStateSnapshot::RemoveDefinition(std::string const& name)
   this->Position->Vars->Unset(name);
 }
 
+void cmStateSnapshot::SetLazyDefinitions(
+  std::shared_ptr<cmLazyDefinitions const> lazy)
+{
+  this->Position->Vars->SetLazy(std::move(lazy));
+}
+
 std::vector<std::string> cmStateSnapshot::ClosureKeys() const
 {
   return cmDefinitions::ClosureKeys(this->Position->Vars,
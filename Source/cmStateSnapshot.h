@@ -5,6 +5,7 @@
 
 #include "cmConfigure.h" // IWYU pragma: keep
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -15,6 +16,7 @@
 #include "cmStateTypes.h"
 #include "cmValue.h"
 
+class cmLazyDefinitions;
 class cmPackageState;
 class cmState;
 class cmStateDirectory;
@@ -29,6 +31,7 @@ public:
   bool IsInitialized(std::string const& name) const;
   void SetDefinition(std::string const& name, cm::string_view value);
   void RemoveDefinition(std::string const& name);
+  void SetLazyDefinitions(std::shared_ptr<cmLazyDefinitions const> lazy);
   std::vector<std::string> ClosureKeys() const;
   bool RaiseScope(std::string const& var, char const* varDef);
 
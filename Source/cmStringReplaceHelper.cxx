@@ -8,12 +8,15 @@
 
 #include "cmMakefile.h"
 #include "cmPolicies.h"
+#include "cmState.h"
 
 cmStringReplaceHelper::cmStringReplaceHelper(std::string const& regex,
                                              std::string replace_expr,
                                              cmMakefile* makefile)
   : RegExString(regex)
-  , RegularExpression(regex)
+  , RegularExpression(cmRegularExpressionCache::Acquire(
+      makefile ? &makefile->GetState()->GetRegularExpressionCache() : nullptr,
+      regex))
   , ReplaceExpression(std::move(replace_expr))
   , Makefile(makefile)
 {
@@ -32,7 +35,7 @@ bool cmStringReplaceHelper::Replace(cm::string_view input, std::string& output)
   }
 
   // Scan through the input for all matches.
-  auto& re = this->RegularExpression;
+  auto& re = *this->RegularExpression;
   std::string::size_type base = 0;
   unsigned optNonEmpty = 0;
   while (re.find(input.data(), base, optAnchor | optNonEmpty)) {
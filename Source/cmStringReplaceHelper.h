@@ -10,6 +10,8 @@
 
 #include "cmsys/RegularExpression.hxx"
 
+#include "cmRegularExpressionCache.h"
+
 class cmMakefile;
 
 class cmStringReplaceHelper
@@ -20,7 +22,7 @@ public:
 
   bool IsRegularExpressionValid() const
   {
-    return this->RegularExpression.is_valid();
+    return this->RegularExpression->is_valid();
   }
   bool IsReplaceExpressionValid() const
   {
@@ -59,7 +61,7 @@ private:
 
   std::string ErrorString;
   std::string RegExString;
-  cmsys::RegularExpression RegularExpression;
+  cmRegularExpressionCache::Lease RegularExpression;
   bool ValidReplaceExpression = true;
   std::string ReplaceExpression;
   std::vector<RegexReplacement> Replacements;
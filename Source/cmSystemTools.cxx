@@ -3013,6 +3013,7 @@ std::string cmSystemToolsCPackCommand;
 std::string cmSystemToolsCMakeCursesCommand;
 std::string cmSystemToolsCMakeGUICommand;
 std::string cmSystemToolsCMClDepsCommand;
+std::string cmSystemToolsCMCmdHelperCommand;
 std::string cmSystemToolsCMakeRoot;
 std::string cmSystemToolsHTMLDoc;
 
@@ -3201,6 +3202,11 @@ void cmSystemTools::FindCMakeResources(char const* argv0)
   if (!cmSystemTools::FileExists(cmSystemToolsCMClDepsCommand)) {
     cmSystemToolsCMClDepsCommand.clear();
   }
+  cmSystemToolsCMCmdHelperCommand =
+    cmStrCat(exe_dir, "/cmcmdhelper", cmSystemTools::GetExecutableExtension());
+  if (!cmSystemTools::FileExists(cmSystemToolsCMCmdHelperCommand)) {
+    cmSystemToolsCMCmdHelperCommand.clear();
+  }
 }
 
 std::string const& cmSystemTools::GetCMakeCommand()
@@ -3233,6 +3239,11 @@ std::string const& cmSystemTools::GetCMClDepsCommand()
   return cmSystemToolsCMClDepsCommand;
 }
 
+std::string const& cmSystemTools::GetCMCmdHelperCommand()
+{
+  return cmSystemToolsCMCmdHelperCommand;
+}
+
 std::string const& cmSystemTools::GetCMakeRoot()
 {
   return cmSystemToolsCMakeRoot;
@@ -564,6 +564,7 @@ public:
   static std::string const& GetCMakeGUICommand();
   static std::string const& GetCMakeCursesCommand();
   static std::string const& GetCMClDepsCommand();
+  static std::string const& GetCMCmdHelperCommand();
   static std::string const& GetCMakeRoot();
   static bool GetCMakeInBuildTree();
   static std::string const& GetHTMLDoc();
@@ -24,6 +24,7 @@
 #include "cmFileSet.h"
 #include "cmFileSetMetadata.h"
 #include "cmFindPackageStack.h"
+#include "cmGenExMemo.h"
 #include "cmGeneratorExpression.h"
 #include "cmGeneratorTarget.h"
 #include "cmGlobalGenerator.h"
@@ -100,6 +101,12 @@ cmValue cmTargetPropertyComputer::GetSources<cmTarget>(cmTarget const* tgt)
 }
 
 namespace {
+// Memoized generator expression results may depend on any target property.
+void InvalidateGenExResults(cmMakefile const* mf)
+{
+  mf->GetCMakeInstance()->GetGenExMemo().Invalidate();
+}
+
 struct FileSetEntries
 {
   FileSetEntries(cm::string_view propertyName)
@@ -1377,6 +1384,7 @@ void cmTarget::AddPostBuildCommand(cmCustomCommand&& cmd)
 void cmTarget::AddTracedSources(std::vector<std::string> const& srcs)
 {
   if (!srcs.empty()) {
+    InvalidateGenExResults(this->impl->Makefile);
     this->impl->Sources.WriteDirect(this->impl.get(), {},
                                     cmValue(cmJoin(srcs, ";")),
                                     UsageRequirementProperty::Action::Append);
@@ -1456,6 +1464,7 @@ cmSourceFile* cmTarget::AddSource(std::string const& src, bool before)
   auto const& sources = this->impl->Sources.Entries;
   if (std::find_if(sources.begin(), sources.end(),
                    TargetPropertyEntryFinder(sfl)) == sources.end()) {
+    InvalidateGenExResults(this->impl->Makefile);
     this->impl->Sources.WriteDirect(
       this->impl.get(), {}, cmValue(src),
       before ? UsageRequirementProperty::Action::Prepend
@@ -1596,6 +1605,7 @@ cmTarget::LinkLibraryVectorType const& cmTarget::GetOriginalLinkLibraries()
 void cmTarget::AddLinkLibrary(cmMakefile& mf, std::string const& lib,
                               cmTargetLinkLibraryType llt)
 {
+  InvalidateGenExResults(this->impl->Makefile);
   cmTarget* tgt = mf.FindTargetToUse(lib);
   {
     bool const isNonImportedTarget = tgt && !tgt->IsImported();
@@ -2171,6 +2181,7 @@ void cmTarget::SetProperty(std::string const& prop, cmValue value)
   if (!IsSettableProperty(this->impl->Makefile, this, prop)) {
     return;
   }
+  InvalidateGenExResults(this->impl->Makefile);
 
   UsageRequirementProperty* usageRequirements[] = {
     &this->impl->IncludeDirectories,
@@ -2284,6 +2295,7 @@ void cmTarget::AppendProperty(std::string const& prop,
   if (!IsSettableProperty(this->impl->Makefile, this, prop)) {
     return;
   }
+  InvalidateGenExResults(this->impl->Makefile);
   if (prop == "IMPORTED_GLOBAL") {
     this->impl->Makefile->IssueMessage(
       MessageType::FATAL_ERROR,
@@ -2529,6 +2541,7 @@ void cmTarget::FinalizeTargetConfiguration(cmBTStringRange compileDefinitions)
 
 void cmTarget::InsertInclude(BT<std::string> const& entry, bool before)
 {
+  InvalidateGenExResults(this->impl->Makefile);
   this->impl->IncludeDirectories.WriteDirect(
     entry,
     before ? UsageRequirementProperty::Action::Prepend
@@ -2537,6 +2550,7 @@ void cmTarget::InsertInclude(BT<std::string> const& entry, bool before)
 
 void cmTarget::InsertCompileOption(BT<std::string> const& entry, bool before)
 {
+  InvalidateGenExResults(this->impl->Makefile);
   this->impl->CompileOptions.WriteDirect(
     entry,
     before ? UsageRequirementProperty::Action::Prepend
@@ -2545,12 +2559,14 @@ void cmTarget::InsertCompileOption(BT<std::string> const& entry, bool before)
 
 void cmTarget::InsertCompileDefinition(BT<std::string> const& entry)
 {
+  InvalidateGenExResults(this->impl->Makefile);
   this->impl->CompileDefinitions.WriteDirect(
     entry, UsageRequirementProperty::Action::Append);
 }
 
 void cmTarget::InsertLinkOption(BT<std::string> const& entry, bool before)
 {
+  InvalidateGenExResults(this->impl->Makefile);
   this->impl->LinkOptions.WriteDirect(
     entry,
     before ? UsageRequirementProperty::Action::Prepend
@@ -2559,6 +2575,7 @@ void cmTarget::InsertLinkOption(BT<std::string> const& entry, bool before)
 
 void cmTarget::InsertLinkDirectory(BT<std::string> const& entry, bool before)
 {
+  InvalidateGenExResults(this->impl->Makefile);
   this->impl->LinkDirectories.WriteDirect(
     entry,
     before ? UsageRequirementProperty::Action::Prepend
@@ -2567,6 +2584,7 @@ void cmTarget::InsertLinkDirectory(BT<std::string> const& entry, bool before)
 
 void cmTarget::InsertPrecompileHeader(BT<std::string> const& entry)
 {
+  InvalidateGenExResults(this->impl->Makefile);
   this->impl->PrecompileHeaders.WriteDirect(
     entry, UsageRequirementProperty::Action::Append);
 }
@@ -3,12 +3,16 @@
 #include "cmTransformDepfile.h"
 
 #include <algorithm>
-#include <functional>
+#include <cstddef>
+#include <ios>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include <cm/optional>
+#include <cm/string_view>
+#include <cmext/string_view>
 
 #include "cmsys/FStream.hxx"
 
@@ -22,67 +26,181 @@
 #include "cmSystemTools.h"
 
 namespace {
-void WriteFilenameGcc(cmsys::ofstream& fout, std::string const& filename)
+// Convert paths for the depfile, reusing the work for files in the same
+// directory.  Depfiles typically name thousands of files in a few hundred
+// directories.
+class PathFormatter
 {
-  for (auto c : filename) {
-    switch (c) {
-      case '$':
-        fout << "$$";
-        break;
-      case '#':
-        fout << "\\#";
-        break;
-      case ' ':
-        fout << "\\ ";
-        break;
-      case '\\':
-        fout << "\\\\";
-        break;
-      default:
-        fout << c;
-        break;
+public:
+  explicit PathFormatter(cmLocalGenerator const& lg)
+    : LG(lg)
+    // full paths must be preserved for Xcode compliance
+    , KeepFullPaths(lg.GetGlobalGenerator()->GetName() == "Xcode")
+  {
+  }
+
+  std::string Format(std::string const& path)
+  {
+    if (this->KeepFullPaths) {
+      return path;
+    }
+    std::string::size_type const slash = path.rfind('/');
+    if (slash == std::string::npos || slash == 0 || path[slash - 1] == '/' ||
+        this->IsTopDirectory(path)) {
+      return this->LG.MaybeRelativeToTopBinDir(path);
+    }
+    cm::string_view const name(path.data() + slash + 1,
+                               path.size() - slash - 1);
+    if (name.empty() || name == "."_s || name == ".."_s) {
+      return this->LG.MaybeRelativeToTopBinDir(path);
     }
+    std::string dir = path.substr(0, slash);
+    auto i = this->Directories.find(dir);
+    if (i == this->Directories.end()) {
+      std::string formatted = this->LG.MaybeRelativeToTopBinDir(dir);
+      i = this->Directories.emplace(std::move(dir), std::move(formatted))
+            .first;
+    }
+    std::string const& formatted = i->second;
+    if (formatted == "."_s) {
+      return std::string(name);
+    }
+    if (!formatted.empty() && formatted.back() == '/') {
+      return cmStrCat(formatted, name);
+    }
+    return cmStrCat(formatted, '/', name);
   }
-}
+
+private:
+  // Paths are converted relative to these directories, so the conversion
+  // of a directory itself is not that of its parent plus its name.
+  bool IsTopDirectory(std::string const& path) const
+  {
+    return cmSystemTools::ComparePath(path, this->LG.GetBinaryDirectory()) ||
+      cmSystemTools::ComparePath(path,
+                                 this->LG.GetRelativePathTopBinary()) ||
+      cmSystemTools::ComparePath(path, this->LG.GetRelativePathTopSource());
+  }
+
+  cmLocalGenerator const& LG;
+  bool KeepFullPaths;
+  std::unordered_map<std::string, std::string> Directories;
+};
+
+// Write the output in large chunks instead of one stream operation per
+// character.
+std::size_t const BufferSize = 64 * 1024;
+
+class BufferedWriter
+{
+public:
+  explicit BufferedWriter(cmsys::ofstream& fout)
+    : Out(fout)
+  {
+    this->Buffer.reserve(BufferSize);
+  }
+  ~BufferedWriter() { this->Flush(); }
+
+  BufferedWriter(BufferedWriter const&) = delete;
+  BufferedWriter& operator=(BufferedWriter const&) = delete;
+
+  void Write(cm::string_view s)
+  {
+    this->Buffer.append(s.data(), s.size());
+    if (this->Buffer.size() >= BufferSize) {
+      this->Flush();
+    }
+  }
+
+  void WriteFilenameGcc(std::string const& filename)
+  {
+    char const* begin = filename.data();
+    char const* const end = begin + filename.size();
+    for (char const* c = begin; c != end; ++c) {
+      char const* escaped;
+      switch (*c) {
+        case '$':
+          escaped = "$$";
+          break;
+        case '#':
+          escaped = "\\#";
+          break;
+        case ' ':
+          escaped = "\\ ";
+          break;
+        case '\\':
+          escaped = "\\\\";
+          break;
+        default:
+          continue;
+      }
+      this->Buffer.append(begin, c);
+      this->Buffer.append(escaped);
+      begin = c + 1;
+    }
+    this->Write(
+      cm::string_view(begin, static_cast<std::size_t>(end - begin)));
+  }
+
+  void Flush()
+  {
+    this->Out.write(this->Buffer.data(),
+                    static_cast<std::streamsize>(this->Buffer.size()));
+    this->Buffer.clear();
+  }
+
+private:
+  cmsys::ofstream& Out;
+  std::string Buffer;
+};
 
 void WriteDepfile(cmDepfileFormat format, cmsys::ofstream& fout,
                   cmLocalGenerator const& lg,
                   cmGccDepfileContent const& content)
 {
-  std::function<std::string(std::string const&)> formatPath =
-    [&lg](std::string const& path) -> std::string {
-    return lg.MaybeRelativeToTopBinDir(path);
-  };
-  if (lg.GetGlobalGenerator()->GetName() == "Xcode") {
-    // full paths must be preserved for Xcode compliance
-    formatPath = [](std::string const& path) -> std::string { return path; };
+  PathFormatter formatter(lg);
+  BufferedWriter out(fout);
+
+  // Convert the dependencies once since the Makefile format lists them
+  // twice.
+  std::vector<std::vector<std::string>> paths;
+  paths.reserve(content.size());
+  for (auto const& dep : content) {
+    std::vector<std::string> formatted;
+    formatted.reserve(dep.paths.size());
+    for (auto const& path : dep.paths) {
+      formatted.push_back(formatter.Format(path));
+    }
+    paths.push_back(std::move(formatted));
   }
 
+  auto dep_paths = paths.begin();
   for (auto const& dep : content) {
     bool first = true;
     for (auto const& rule : dep.rules) {
       if (!first) {
-        fout << " \\\n  ";
+        out.Write(" \\\n  "_s);
       }
       first = false;
-      WriteFilenameGcc(fout, formatPath(rule));
+      out.WriteFilenameGcc(formatter.Format(rule));
     }
-    fout << ':';
-    for (auto const& path : dep.paths) {
-      fout << " \\\n  ";
-      WriteFilenameGcc(fout, formatPath(path));
+    out.Write(":"_s);
+    for (auto const& path : *dep_paths) {
+      out.Write(" \\\n  "_s);
+      out.WriteFilenameGcc(path);
     }
-    fout << '\n';
+    out.Write("\n"_s);
+    ++dep_paths;
   }
 
   if (format == cmDepfileFormat::MakeDepfile) {
     // In this case, phony targets must be added for all dependencies
-    fout << "\n";
-    for (auto const& dep : content) {
-      for (auto const& path : dep.paths) {
-        fout << "\n";
-        WriteFilenameGcc(fout, formatPath(path));
-        fout << ":\n";
+    out.Write("\n"_s);
+    for (auto const& dep : paths) {
+      for (auto const& path : dep) {
+        out.Write("\n"_s);
+        out.WriteFilenameGcc(path);
+        out.Write(":\n"_s);
       }
     }
   }
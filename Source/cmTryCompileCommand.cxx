@@ -7,6 +7,7 @@
 #include "cmConfigureLog.h"
 #include "cmCoreTryCompile.h"
 #include "cmExecutionStatus.h"
+#include "cmFileSystemCache.h"
 #include "cmMakefile.h"
 #include "cmMessageType.h"
 #include "cmRange.h"
@@ -31,6 +32,31 @@ void WriteTryCompileEvent(cmConfigureLog& log, cmMakefile const& mf,
   }
 }
 #endif
+
+void FinishTryCompile(cmCoreTryCompile& tc,
+                      cmCoreTryCompile::Arguments const& arguments,
+                      cm::optional<cmTryCompileResult> const& compileResult)
+{
+  cmMakefile& mf = *tc.Makefile;
+#ifndef CMAKE_BOOTSTRAP
+  if (compileResult && !arguments.NoLog) {
+    if (cmConfigureLog* log = mf.GetCMakeInstance()->GetConfigureLog()) {
+      WriteTryCompileEvent(*log, mf, *compileResult);
+    }
+  }
+#else
+  static_cast<void>(arguments);
+  static_cast<void>(compileResult);
+#endif
+
+  // if They specified clean then we clean up what we can
+  if (tc.SrcFileSignature) {
+    if (!mf.GetCMakeInstance()->GetDebugTryCompile()) {
+      tc.CleanupFiles(tc.BinaryDirectory);
+    }
+  }
+  cmFileSystemCache::Invalidate();
+}
 }
 
 bool cmTryCompileCommand(std::vector<std::string> const& args,
@@ -81,21 +107,13 @@ bool cmTryCompileCommand(std::vector<std::string> const& args,
     return true;
   }
 
-  cm::optional<cmTryCompileResult> compileResult =
-    tc.TryCompileCode(arguments, targetType);
-#ifndef CMAKE_BOOTSTRAP
-  if (compileResult && !arguments.NoLog) {
-    if (cmConfigureLog* log = mf.GetCMakeInstance()->GetConfigureLog()) {
-      WriteTryCompileEvent(*log, mf, *compileResult);
-    }
+  if (arguments.Defer) {
+    tc.DeferTryCompileCode(arguments, targetType, FinishTryCompile);
+    return true;
   }
-#endif
 
-  // if They specified clean then we clean up what we can
-  if (tc.SrcFileSignature) {
-    if (!mf.GetCMakeInstance()->GetDebugTryCompile()) {
-      tc.CleanupFiles(tc.BinaryDirectory);
-    }
-  }
+  cm::optional<cmTryCompileResult> compileResult =
+    tc.TryCompileCode(arguments, targetType);
+  FinishTryCompile(tc, arguments, compileResult);
   return true;
 }
@@ -14,6 +14,7 @@
 #include "cmCoreTryCompile.h"
 #include "cmDuration.h"
 #include "cmExecutionStatus.h"
+#include "cmFileSystemCache.h"
 #include "cmList.h"
 #include "cmMakefile.h"
 #include "cmMessageType.h"
@@ -258,6 +259,7 @@ bool TryRunCommandImpl::TryRunCode(std::vector<std::string> const& argv)
   if (!this->Makefile->GetCMakeInstance()->GetDebugTryCompile()) {
     this->CleanupFiles(this->BinaryDirectory);
   }
+  cmFileSystemCache::Invalidate();
   return true;
 }
 
@@ -12,6 +12,8 @@
 
 #include <cm3p/uv.h>
 
+#include "cmFileSystemCache.h"
+
 namespace cm {
 
 struct uv_loop_deleter
@@ -231,6 +233,8 @@ int uv_process_ptr::spawn(uv_loop_t& loop, uv_process_options_t const& options,
                           void* data)
 {
   this->allocate(data);
+  // The child process may modify the file system.
+  cmFileSystemCache::Invalidate();
   return uv_spawn(&loop, *this, &options);
 }
 
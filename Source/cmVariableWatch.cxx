@@ -7,6 +7,8 @@
 #include <utility>
 #include <vector>
 
+#include "cmStringAlgorithms.h"
+
 std::string const& cmVariableWatch::GetAccessAsString(AccessType accessType)
 {
   static std::array<std::string, 6> const cmVariableWatchAccessStrings = {
@@ -62,6 +64,12 @@ void cmVariableWatch::RemoveWatch(std::string const& variable,
   }
 }
 
+bool cmVariableWatch::HasWatchWithPrefix(std::string const& prefix) const
+{
+  auto mit = this->WatchMap.lower_bound(prefix);
+  return mit != this->WatchMap.end() && cmHasPrefix(mit->first, prefix);
+}
+
 bool cmVariableWatch::VariableAccessed(std::string const& variable,
                                        AccessType accessType,
                                        char const* newValue,
@@ -53,6 +53,11 @@ public:
   bool VariableAccessed(std::string const& variable, AccessType accessType,
                         char const* newValue, cmMakefile const* mf) const;
 
+  /**
+   * Return whether any variable whose name starts with the prefix is watched
+   */
+  bool HasWatchWithPrefix(std::string const& prefix) const;
+
   /**
    * Return the access as string
    */
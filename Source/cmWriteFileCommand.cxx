@@ -8,6 +8,7 @@
 
 #include "cmDiagnostics.h"
 #include "cmExecutionStatus.h"
+#include "cmFileSystemCache.h"
 #include "cmMakefile.h"
 #include "cmStringAlgorithms.h"
 #include "cmSystemTools.h"
@@ -81,6 +82,7 @@ bool cmWriteFileCommand(std::vector<std::string> const& args,
   }
   file << message << '\n';
   file.close();
+  cmFileSystemCache::Invalidate();
   if (mode && !writable) {
     cmSystemTools::SetPermissions(fileName.c_str(), mode);
   }
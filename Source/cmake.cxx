@@ -45,7 +45,9 @@
 #include "cmDocumentationEntry.h"
 #include "cmDuration.h"
 #include "cmExternalMakefileProjectGenerator.h"
+#include "cmFileSystemCache.h"
 #include "cmFileTimeCache.h"
+#include "cmGenExMemo.h"
 #include "cmGeneratorTarget.h"
 #include "cmGlobCacheEntry.h" // IWYU pragma: keep
 #include "cmGlobalGenerator.h"
@@ -57,6 +59,7 @@
 #include "cmMakefile.h"
 #include "cmMessenger.h"
 #include "cmPolicies.h"
+#include "cmRegularExpressionCache.h"
 #include "cmState.h"
 #include "cmStateDirectory.h"
 #include "cmStringAlgorithms.h"
@@ -87,10 +90,14 @@
 #  include "cmCMakeSarifLogger.h"
 #  include "cmConfigureLog.h"
 #  include "cmFileAPI.h"
+#  include "cmFindPackageResolutionCache.h"
 #  include "cmGraphVizWriter.h"
 #  include "cmInstrumentation.h"
 #  include "cmInstrumentationInterrupt.h"
 #  include "cmInstrumentationQuery.h"
+#  include "cmLanguageSetupCache.h"
+#  include "cmListFileParseCache.h"
+#  include "cmListFilePrefetcher.h"
 #  include "cmMakefileProfilingData.h"
 #  include "cmVariableWatch.h"
 #endif
@@ -324,6 +331,7 @@ cmake::cmake(cmState::Role role, cmState::TryCompile isTryCompile)
 #endif
   , State(cm::make_unique<cmState>(role, isTryCompile))
   , Messenger(cm::make_unique<cmMessenger>())
+  , GenExMemo(cm::make_unique<cm::GenEx::Memo>())
 {
   this->TraceFile.close();
   this->CurrentSnapshot = this->State->CreateBaseSnapshot();
@@ -1445,6 +1453,18 @@ void cmake::SetArgs(std::vector<std::string> const& args)
       profilingOutput = cmSystemTools::ToNormalizedPathOnDisk(value);
       return true;
     });
+  arguments.emplace_back(
+    "--configure-jobs", "No number specified for --configure-jobs",
+    CommandArgument::Values::One,
+    [](std::string const& value, cmake* state) -> bool {
+      unsigned long jobs = 0;
+      if (!cmStrToULong(value, &jobs) || jobs == 0 || jobs > UINT_MAX) {
+        cmSystemTools::Error("Invalid value specified for --configure-jobs");
+        return false;
+      }
+      state->SetConfigureJobs(static_cast<unsigned int>(jobs));
+      return true;
+    });
   arguments.emplace_back("--preset", "No preset specified for --preset",
                          CommandArgument::Values::One,
                          [&](std::string const& value, cmake*) -> bool {
@@ -2793,6 +2813,26 @@ int cmake::ActualConfigure()
       this->FileAPI->GetConfigureLogVersions());
     this->Instrumentation->ClearGeneratedQueries();
     this->Instrumentation->CheckCDashVariable();
+    if (this->State->GetCacheEntryValue("CMAKE_LISTFILE_CACHE").IsOn()) {
+      this->ListFileParseCache =
+        cm::make_unique<cmListFileParseCache>(this->GetHomeOutputDirectory());
+      this->ListFileParseCache->Load();
+    }
+    cmValue const resolutionCache =
+      this->State->GetCacheEntryValue("CMAKE_FIND_PACKAGE_RESOLUTION_CACHE");
+    if (resolutionCache) {
+      this->MarkCliAsUsed("CMAKE_FIND_PACKAGE_RESOLUTION_CACHE");
+    }
+    if (resolutionCache.IsOn()) {
+      this->FindPackageResolutionCache =
+        cm::make_unique<cmFindPackageResolutionCache>(
+          this->GetHomeOutputDirectory());
+      this->FindPackageResolutionCache->Load();
+    }
+    if (this->ConfigureJobs > 1) {
+      this->ListFilePrefetcher =
+        cm::make_unique<cmListFilePrefetcher>(this->ConfigureJobs - 1);
+    }
   }
 #endif
 
@@ -2838,6 +2878,47 @@ int cmake::ActualConfigure()
 
 #if !defined(CMAKE_BOOTSTRAP)
   this->ConfigureLog.reset();
+  if (this->ListFileParseCache) {
+    this->ListFileParseCache->Save();
+    if (this->IsProfilingEnabled()) {
+      this->GetProfilingOutput().CounterEntry(
+        "configure", "listfile-parse-cache",
+        this->ListFileParseCache->GetStatistics());
+    }
+    this->ListFileParseCache.reset();
+  }
+  if (this->FindPackageResolutionCache) {
+    this->FindPackageResolutionCache->Save();
+    if (this->IsProfilingEnabled()) {
+      this->GetProfilingOutput().CounterEntry(
+        "configure", "find-package-resolution-cache",
+        this->FindPackageResolutionCache->GetStatistics());
+    }
+    this->FindPackageResolutionCache.reset();
+  }
+  if (cmLanguageSetupCache const* languageSetupCache =
+        this->GlobalGenerator->GetLanguageSetupCache()) {
+    if (this->IsProfilingEnabled()) {
+      this->GetProfilingOutput().CounterEntry(
+        "configure", "try-compile-language-setup",
+        languageSetupCache->GetStatistics());
+    }
+  }
+  if (this->ListFilePrefetcher) {
+    if (this->IsProfilingEnabled()) {
+      this->GetProfilingOutput().CounterEntry(
+        "configure", "listfile-prefetch",
+        this->ListFilePrefetcher->GetStatistics());
+    }
+    this->ListFilePrefetcher.reset();
+  }
+  if (this->IsProfilingEnabled()) {
+    this->GetProfilingOutput().CounterEntry(
+      "configure", "regex-cache",
+      this->State->GetRegularExpressionCache().GetStatistics());
+    this->GetProfilingOutput().CounterEntry(
+      "configure", "filesystem-cache", cmFileSystemCache::GetStatistics());
+  }
 #endif
 
   // Before saving the cache
@@ -3202,7 +3283,15 @@ int cmake::Generate()
       this->FileAPI->WriteReplies(cmFileAPI::IndexFor::FailedCompute);
       return -1;
     }
+    this->GenExMemo->SetEvaluationEnabled(true);
     this->GlobalGenerator->Generate();
+    this->GenExMemo->SetEvaluationEnabled(false);
+    if (this->IsProfilingEnabled()) {
+      this->GetProfilingOutput().CounterEntry(
+        "generate", "genex-memo", this->GenExMemo->GetStatistics());
+      this->GetProfilingOutput().CounterEntry(
+        "generate", "filesystem-cache", cmFileSystemCache::GetStatistics());
+    }
     if (this->Instrumentation->HasQuery()) {
       this->Instrumentation->WriteCMakeContent(this->GlobalGenerator);
     }
@@ -3221,7 +3310,9 @@ int cmake::Generate()
   if (!this->GlobalGenerator->Compute()) {
     return -1;
   }
+  this->GenExMemo->SetEvaluationEnabled(true);
   this->GlobalGenerator->Generate();
+  this->GenExMemo->SetEvaluationEnabled(false);
 #endif
   auto endTime = std::chrono::steady_clock::now();
   {
@@ -3263,6 +3354,7 @@ void cmake::AddCacheEntry(std::string const& key, cmValue value,
 {
   this->State->AddCacheEntry(key, value, helpString,
                              static_cast<cmStateEnums::CacheEntryType>(type));
+  this->GenExMemo->Invalidate();
   this->UnwatchUnusedCli(key);
 }
 
@@ -3435,7 +3527,8 @@ bool cmake::SaveCache(std::string const& path)
   static auto const entries = { "CMAKE_CACHE_MAJOR_VERSION",
                                 "CMAKE_CACHE_MINOR_VERSION",
                                 "CMAKE_CACHE_PATCH_VERSION",
-                                "CMAKE_CACHEFILE_DIR" };
+                                "CMAKE_CACHEFILE_DIR",
+                                "CMAKE_CACHE_IMAGE" };
   for (auto const& entry : entries) {
     this->UnwatchUnusedCli(entry);
   }
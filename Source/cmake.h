@@ -48,6 +48,12 @@ class cmDebuggerAdapter;
 }
 #endif
 
+namespace cm {
+namespace GenEx {
+class Memo;
+}
+}
+
 class cmExternalMakefileProjectGeneratorFactory;
 class cmCMakePresetsArgs;
 class cmCMakePresetsConfigureArgs;
@@ -55,7 +61,10 @@ class cmCMakePresetsWorkflowArgs;
 class cmFileAPI;
 class cmInstrumentation;
 class cmFileTimeCache;
+class cmFindPackageResolutionCache;
 class cmGlobalGenerator;
+class cmListFileParseCache;
+class cmListFilePrefetcher;
 class cmMakefile;
 class cmMessenger;
 class cmVariableWatch;
@@ -593,6 +602,9 @@ public:
 
   cmMessenger* GetMessenger() const { return this->Messenger.get(); }
 
+  //! Get the memo of parsed and evaluated generator expressions.
+  cm::GenEx::Memo& GetGenExMemo() const { return *this->GenExMemo; }
+
 #ifndef CMAKE_BOOTSTRAP
   /// Get the SARIF file path if set manually for this run
   cm::optional<std::string> GetSarifFilePath() const
@@ -689,6 +701,27 @@ public:
     }
     return cm::nullopt;
   }
+
+  //! Get the persistent list file parse cache, if enabled.
+  cmListFileParseCache* GetListFileParseCache() const
+  {
+    return this->ListFileParseCache.get();
+  }
+
+  //! Get the persistent find_package resolution cache, if enabled.
+  cmFindPackageResolutionCache* GetFindPackageResolutionCache() const
+  {
+    return this->FindPackageResolutionCache.get();
+  }
+
+  //! Get the parser of list files on worker threads, if enabled.
+  cmListFilePrefetcher* GetListFilePrefetcher() const
+  {
+    return this->ListFilePrefetcher.get();
+  }
+
+  //! Set the number of threads used during the configure step.
+  void SetConfigureJobs(unsigned int jobs) { this->ConfigureJobs = jobs; }
 #endif
 
 #ifdef CMake_ENABLE_DEBUGGER
@@ -819,6 +852,7 @@ private:
   std::unique_ptr<cmState> State;
   cmStateSnapshot CurrentSnapshot;
   std::unique_ptr<cmMessenger> Messenger;
+  std::unique_ptr<cm::GenEx::Memo> GenExMemo;
 
   using DiagnosticAlterationMethod =
     void (cmStateSnapshot::*)(cmDiagnosticCategory, cmDiagnosticAction, bool);
@@ -874,6 +908,10 @@ private:
 
 #if !defined(CMAKE_BOOTSTRAP)
   std::unique_ptr<cmMakefileProfilingData> ProfilingOutput;
+  std::unique_ptr<cmListFileParseCache> ListFileParseCache;
+  std::unique_ptr<cmFindPackageResolutionCache> FindPackageResolutionCache;
+  std::unique_ptr<cmListFilePrefetcher> ListFilePrefetcher;
+  unsigned int ConfigureJobs = 1;
 #endif
 
 #ifdef CMake_ENABLE_DEBUGGER
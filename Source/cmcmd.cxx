@@ -61,6 +61,10 @@
 #  include "cmVisualStudioWCEPlatformParser.h"
 #endif
 
+#if !defined(CMAKE_BOOTSTRAP) && defined(CMake_USE_COMMAND_HELPER)
+#  include "cmCommandHelperServer.h"
+#endif
+
 #include <array>
 #include <chrono>
 #include <cstdint>
@@ -904,6 +908,70 @@ bool Bin2C(std::ostream& sout, std::istream& sin,
   sout << Bin2CPrintChars(sin, printTrailingComma, printSigned, base, false);
   return true;
 }
+
+// Before a custom command runs, move its previous outputs to a staging
+// directory.  After it ran, move back those it rewrote with identical
+// content or did not write at all, so they keep their timestamp.
+int PreserveUnchangedOutputs(std::vector<std::string> const& args)
+{
+  std::string const& mode = args[2];
+  std::string const& stagingDir = args[3];
+  auto const stagedPath = [&stagingDir](std::size_t i) -> std::string {
+    return cmStrCat(stagingDir, '/', i - 4);
+  };
+
+  if (mode == "stage") {
+    // Drop what a failed run of the command left behind.
+    if (cmSystemTools::FileIsDirectory(stagingDir)) {
+      cmSystemTools::RemoveADirectory(stagingDir);
+    }
+    bool haveStagingDir = false;
+    for (std::size_t i = 4; i < args.size(); ++i) {
+      std::string const& output = args[i];
+      if (!cmSystemTools::FileExists(output, true) ||
+          cmSystemTools::FileIsSymlink(output)) {
+        continue;
+      }
+      if (!haveStagingDir) {
+        if (!cmSystemTools::MakeDirectory(stagingDir)) {
+          // Run the command without preserving anything.
+          return 0;
+        }
+        haveStagingDir = true;
+      }
+      // An output that cannot be moved stays in place and is simply
+      // not preserved.
+      cmSystemTools::RenameFile(output, stagedPath(i));
+    }
+    return 0;
+  }
+
+  if (mode == "restore") {
+    if (!cmSystemTools::FileIsDirectory(stagingDir)) {
+      return 0;
+    }
+    int result = 0;
+    for (std::size_t i = 4; i < args.size(); ++i) {
+      std::string const& output = args[i];
+      std::string const staged = stagedPath(i);
+      if (!cmSystemTools::FileExists(staged, true)) {
+        continue;
+      }
+      if (!cmSystemTools::FileExists(output) ||
+          !cmSystemTools::FilesDiffer(staged, output)) {
+        if (!cmSystemTools::RenameFile(staged, output)) {
+          std::cerr << "Error restoring unchanged output \"" << output
+                    << "\"\n";
+          result = 1;
+        }
+      }
+    }
+    cmSystemTools::RemoveADirectory(stagingDir);
+    return result;
+  }
+
+  return 1;
+}
 }
 
 // called when args[0] == "__run_co_compile"
@@ -1256,6 +1324,12 @@ int cmcmd::ExecuteCMakeCommand(std::vector<std::string> const& args,
       return cmcmd::HandleCoCompileCommands(args);
     }
 
+#if !defined(CMAKE_BOOTSTRAP) && defined(CMake_USE_COMMAND_HELPER)
+    if (args[1] == cmCommandHelper::ServerCommand) {
+      return cmCommandHelper::RunServer(args);
+    }
+#endif
+
     // Echo string
     if (args[1] == "echo") {
       std::cout << cmJoin(cmMakeRange(args).advance(2), " ") << std::endl;
@@ -2383,6 +2457,11 @@ int cmcmd::ExecuteCMakeCommand(std::vector<std::string> const& args,
     }
 #endif
 
+    // Internal support for preserving unchanged custom command outputs
+    if (args[1] == "cmake_preserve_unchanged_outputs" && args.size() >= 4) {
+      return PreserveUnchangedOutputs(args);
+    }
+
     // Internal depfile transformation
     if (args[1] == "cmake_transform_depfile" && args.size() == 10) {
       auto format = cmDepfileFormat::GccDepfile;
@@ -0,0 +1,253 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+
+// Client of the cmake command helper server.
+//
+//   cmcmdhelper <cmake> -E <command> [<arg>...]
+//
+// Runs "<cmake> -E <command> [<arg>...]" in a helper server started from
+// the given cmake executable, which saves the startup of a cmake process
+// for every invocation.  The first invocation starts the server and runs
+// the command itself, and the server exits when it has been idle for a
+// while.  Whenever the server cannot be used, the command runs in a new
+// cmake process as it would without the helper.
+//
+// This program is kept small and does not link to CMakeLib so that it
+// starts quickly.  See cmCommandHelperServer.h for the protocol.
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+
+#include "cmCommandHelperServer.h"
+
+#ifdef MSG_NOSIGNAL
+#  define CM_SEND_FLAGS MSG_NOSIGNAL
+#else
+#  define CM_SEND_FLAGS 0
+#endif
+
+extern char** environ;
+
+namespace {
+
+[[noreturn]] void RunCMake(char** cmakeArgv)
+{
+  execv(cmakeArgv[0], cmakeArgv);
+  fprintf(stderr, "cmcmdhelper: cannot run %s: %s\n", cmakeArgv[0],
+          strerror(errno));
+  exit(1);
+}
+
+// The socket of the server belongs to the current user and to the exact
+// cmake executable, so a rebuilt or updated cmake starts a new server.
+bool GetSocketPath(char const* cmake, std::string& path)
+{
+  struct stat st;
+  if (stat(cmake, &st) != 0) {
+    return false;
+  }
+  char const* tmp = getenv("TMPDIR");
+  if (!tmp || !*tmp) {
+    tmp = "/tmp";
+  }
+  std::string dir = tmp;
+  while (dir.size() > 1 && dir.back() == '/') {
+    dir.pop_back();
+  }
+  dir += "/cmake-cmd-helper-" + std::to_string(getuid());
+  if (mkdir(dir.c_str(), 0700) != 0 && errno != EEXIST) {
+    return false;
+  }
+  // Do not use a directory that other users can write to.
+  struct stat dst;
+  if (lstat(dir.c_str(), &dst) != 0 || !S_ISDIR(dst.st_mode) ||
+      dst.st_uid != getuid() || (dst.st_mode & 077) != 0) {
+    return false;
+  }
+
+  std::uint64_t hash = 14695981039346656037ull;
+  auto add = [&hash](void const* data, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+      hash ^= static_cast<unsigned char const*>(data)[i];
+      hash *= 1099511628211ull;
+    }
+  };
+  add(cmake, strlen(cmake));
+  add(&st.st_dev, sizeof(st.st_dev));
+  add(&st.st_ino, sizeof(st.st_ino));
+  add(&st.st_size, sizeof(st.st_size));
+  add(&st.st_mtime, sizeof(st.st_mtime));
+  char name[32];
+  snprintf(name, sizeof(name), "/%016llx.sock",
+           static_cast<unsigned long long>(hash));
+  path = dir + name;
+  return path.size() < sizeof(sockaddr_un::sun_path);
+}
+
+// Start the server in a new session, detached from the build tool: it
+// must not hold on to the pipes the build tool reads output from.
+void StartServer(char const* cmake, std::string const& socketPath)
+{
+  pid_t pid = fork();
+  if (pid < 0) {
+    return;
+  }
+  if (pid > 0) {
+    while (waitpid(pid, nullptr, 0) < 0 && errno == EINTR) {
+    }
+    return;
+  }
+  setsid();
+  if (fork() != 0) {
+    _exit(0);
+  }
+  int null = open("/dev/null", O_RDWR);
+  if (null >= 0) {
+    dup2(null, 0);
+    dup2(null, 1);
+    dup2(null, 2);
+  }
+  for (int fd = 3; fd < 1024; ++fd) {
+    close(fd);
+  }
+  char const* argv[] = { cmake, "-E", cmCommandHelper::ServerCommand,
+                         socketPath.c_str(), nullptr };
+  execv(cmake, const_cast<char**>(argv));
+  _exit(1);
+}
+
+bool SendAll(int fd, char const* data, std::size_t size)
+{
+  while (size > 0) {
+    ssize_t n = send(fd, data, size, CM_SEND_FLAGS);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    data += n;
+    size -= static_cast<std::size_t>(n);
+  }
+  return true;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 4 || strcmp(argv[2], "-E") != 0) {
+    fprintf(stderr, "Usage: cmcmdhelper <cmake> -E <command> [<arg>...]\n");
+    return 1;
+  }
+  char** cmakeArgv = argv + 1;
+
+  std::string socketPath;
+  if (!GetSocketPath(cmakeArgv[0], socketPath)) {
+    RunCMake(cmakeArgv);
+  }
+
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) {
+    RunCMake(cmakeArgv);
+  }
+#ifdef SO_NOSIGPIPE
+  int on = 1;
+  setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+  sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  memcpy(addr.sun_path, socketPath.c_str(), socketPath.size() + 1);
+  if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+    close(fd);
+    StartServer(cmakeArgv[0], socketPath);
+    RunCMake(cmakeArgv);
+  }
+
+  // Send the working directory, the arguments after "-E", and the
+  // environment, along with our standard streams.
+  std::string request;
+  char cwd[4096];
+  if (!getcwd(cwd, sizeof(cwd))) {
+    close(fd);
+    RunCMake(cmakeArgv);
+  }
+  request.append(cwd).push_back('\0');
+  request.append(std::to_string(argc - 3)).push_back('\0');
+  for (int i = 3; i < argc; ++i) {
+    request.append(argv[i]).push_back('\0');
+  }
+  for (char** e = environ; *e; ++e) {
+    request.append(*e).push_back('\0');
+  }
+  std::uint32_t const size = static_cast<std::uint32_t>(request.size());
+
+  int fds[3] = { 0, 1, 2 };
+  char control[CMSG_SPACE(sizeof(fds))];
+  memset(control, 0, sizeof(control));
+  iovec iov;
+  iov.iov_base = const_cast<std::uint32_t*>(&size);
+  iov.iov_len = sizeof(size);
+  msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+  cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+  memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+  ssize_t sent;
+  do {
+    sent = sendmsg(fd, &msg, CM_SEND_FLAGS);
+  } while (sent < 0 && errno == EINTR);
+  if (sent != static_cast<ssize_t>(sizeof(size)) ||
+      !SendAll(fd, request.data(), request.size())) {
+    close(fd);
+    RunCMake(cmakeArgv);
+  }
+
+  // The server declines commands that it does not run before touching
+  // the streams, so they can still run here.  Otherwise it accepts the
+  // command and sends its exit code when it is done.
+  char reply[1 + sizeof(std::int32_t)];
+  std::size_t got = 0;
+  while (got < sizeof(reply)) {
+    ssize_t n = recv(fd, reply + got, sizeof(reply) - got, 0);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      break;
+    }
+    got += static_cast<std::size_t>(n);
+  }
+  close(fd);
+  if (got == 0 || reply[0] == cmCommandHelper::ReplyDeclined) {
+    RunCMake(cmakeArgv);
+  }
+  if (got != sizeof(reply) || reply[0] != cmCommandHelper::ReplyAccepted) {
+    fprintf(stderr, "cmcmdhelper: the helper server failed to run: %s\n",
+            argv[3]);
+    return 1;
+  }
+  std::int32_t code;
+  memcpy(&code, reply + 1, sizeof(code));
+  return code;
+}
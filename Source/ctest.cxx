@@ -167,6 +167,8 @@ cmDocumentationEntry const cmDocumentationOptions[] = {
   { "--overwrite <option-name>", "Overwrite CTest configuration option." },
   { "--extra-submit <file>[;<file>]", "Submit extra files to the dashboard." },
   { "--http-header <header>", "Append HTTP header when submitting" },
+  { "--schedule-critical-path",
+    "Start tests on the longest chains of dependent tests first" },
   { "--schedule-random", "Use a random order for scheduling tests" },
   { "--schedule-random-seed <seed>",
     "Override seed for random order of tests" },
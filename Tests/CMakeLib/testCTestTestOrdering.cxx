@@ -0,0 +1,283 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "cmCTestTestOrdering.h"
+
+#include "testCommon.h"
+
+namespace {
+
+cmCTestOrderingTest MakeTest(float cost, std::set<int> depends = {},
+                             std::size_t processors = 1)
+{
+  cmCTestOrderingTest test;
+  test.Cost = cost;
+  test.Processors = processors;
+  test.Depends = std::move(depends);
+  return test;
+}
+
+std::string ToString(std::vector<int> const& order)
+{
+  std::string s;
+  for (int test : order) {
+    if (!s.empty()) {
+      s += ' ';
+    }
+    s += std::to_string(test);
+  }
+  return s;
+}
+
+// Simulate a test run that starts tests like
+// cmCTestMultiProcessHandler::StartNextTests and return its wall time.
+double Simulate(cmCTestOrderingTests const& tests,
+                std::vector<int> const& order, std::size_t parallelLevel)
+{
+  std::map<int, std::size_t> unfinished;
+  std::map<int, std::vector<int>> dependents;
+  for (auto const& t : tests) {
+    unfinished[t.first] = t.second.Depends.size();
+    for (int d : t.second.Depends) {
+      dependents[d].push_back(t.first);
+    }
+  }
+  auto processors = [&](int test) {
+    return std::min(tests.at(test).Processors, parallelLevel);
+  };
+
+  std::list<int> pending(order.begin(), order.end());
+  std::multimap<double, int> running;
+  std::size_t used = 0;
+  double now = 0;
+  while (!pending.empty() || !running.empty()) {
+    for (auto ti = pending.begin();
+         ti != pending.end() && used < parallelLevel;) {
+      int test = *ti;
+      if (unfinished[test] == 0 &&
+          processors(test) <= parallelLevel - used) {
+        used += processors(test);
+        running.emplace(now + tests.at(test).Cost, test);
+        ti = pending.erase(ti);
+      } else {
+        ++ti;
+      }
+    }
+    if (running.empty()) {
+      // Unreachable dependencies.
+      return -1;
+    }
+    auto finished = running.begin();
+    now = finished->first;
+    used -= processors(finished->second);
+    for (int d : dependents[finished->second]) {
+      --unfinished[d];
+    }
+    running.erase(finished);
+  }
+  return now;
+}
+
+std::vector<int> OrderByDependencyLevel(cmCTestOrderingTests const& tests)
+{
+  std::set<int> roots;
+  for (auto const& t : tests) {
+    roots.insert(t.first);
+  }
+  return cmCTestOrderTestsByDependencyLevel(tests, roots);
+}
+
+bool DependenciesFirst(cmCTestOrderingTests const& tests,
+                       std::vector<int> const& order)
+{
+  std::set<int> seen;
+  for (int test : order) {
+    for (int d : tests.at(test).Depends) {
+      if (seen.find(d) == seen.end()) {
+        return false;
+      }
+    }
+    seen.insert(test);
+  }
+  return seen.size() == tests.size();
+}
+
+// A small deterministic generator for synthetic test suites.
+class Random
+{
+public:
+  Random(std::uint32_t seed)
+    : State(seed)
+  {
+  }
+
+  std::uint32_t Next(std::uint32_t n)
+  {
+    this->State = this->State * 1664525u + 1013904223u;
+    return (this->State >> 8) % n;
+  }
+
+private:
+  std::uint32_t State;
+};
+
+// Independent tests, fixtures with a cheap setup and expensive tests
+// requiring it, and chains of cheap dependent tests.
+cmCTestOrderingTests MakeSuite(std::uint32_t seed)
+{
+  Random random(seed);
+  cmCTestOrderingTests tests;
+  int index = 1;
+  for (int i = 0; i < 200; ++i) {
+    tests[index++] = MakeTest(static_cast<float>(1 + random.Next(30)), {},
+                              1 + random.Next(2));
+  }
+  for (int f = 0; f < 6; ++f) {
+    int setup = index++;
+    tests[setup] = MakeTest(static_cast<float>(1 + random.Next(5)));
+    std::set<int> users;
+    for (int i = 0, n = 1 + static_cast<int>(random.Next(4)); i < n; ++i) {
+      users.insert(index);
+      tests[index++] =
+        MakeTest(static_cast<float>(60 + random.Next(240)), { setup });
+    }
+    tests[index++] = MakeTest(1, users);
+  }
+  for (int c = 0; c < 20; ++c) {
+    int previous = 0;
+    for (int i = 0; i < 4; ++i) {
+      std::set<int> depends;
+      if (previous != 0) {
+        depends.insert(previous);
+      }
+      previous = index;
+      tests[index++] =
+        MakeTest(static_cast<float>(1 + random.Next(5)), depends);
+    }
+  }
+  return tests;
+}
+
+bool testDependencyLevel()
+{
+  std::cout << "testDependencyLevel()\n";
+
+  cmCTestOrderingTests tests;
+  tests[1] = MakeTest(1);
+  tests[2] = MakeTest(5, { 1 });
+  tests[3] = MakeTest(9);
+  tests[4] = MakeTest(2, { 2 });
+  ASSERT_EQUAL(ToString(OrderByDependencyLevel(tests)), "1 2 3 4");
+
+  // Only the given roots and their dependencies are ordered.
+  ASSERT_EQUAL(ToString(cmCTestOrderTestsByDependencyLevel(tests, { 2, 3 })),
+               "1 3 2");
+  return true;
+}
+
+bool testCriticalPath()
+{
+  std::cout << "testCriticalPath()\n";
+
+  cmCTestOrderingTests tests;
+  tests[1] = MakeTest(1);
+  tests[2] = MakeTest(50, { 1 });
+  tests[3] = MakeTest(20);
+  tests[4] = MakeTest(1);
+  tests[5] = MakeTest(1, { 4 });
+  tests[6] = MakeTest(1, { 5 });
+  tests[7] = MakeTest(20, {}, 4);
+  ASSERT_EQUAL(ToString(cmCTestOrderTestsByCriticalPath(tests)),
+               "1 2 7 3 4 5 6");
+  return true;
+}
+
+bool testDependenciesFirst()
+{
+  std::cout << "testDependenciesFirst()\n";
+
+  // Without any cost data, longer chains of tests come first.
+  cmCTestOrderingTests tests;
+  tests[1] = MakeTest(0, { 2 });
+  tests[2] = MakeTest(0, { 3 });
+  tests[3] = MakeTest(0);
+  tests[4] = MakeTest(0, { 3 });
+  ASSERT_EQUAL(ToString(cmCTestOrderTestsByCriticalPath(tests)), "3 2 1 4");
+
+  for (std::uint32_t seed = 1; seed <= 5; ++seed) {
+    cmCTestOrderingTests suite = MakeSuite(seed);
+    ASSERT_TRUE(DependenciesFirst(suite, OrderByDependencyLevel(suite)));
+    ASSERT_TRUE(
+      DependenciesFirst(suite, cmCTestOrderTestsByCriticalPath(suite)));
+  }
+  return true;
+}
+
+bool testMakespan()
+{
+  std::cout << "testMakespan()\n";
+
+  // A fixture whose long test waits behind many deep but cheap chains.
+  cmCTestOrderingTests tests;
+  int index = 1;
+  for (int c = 0; c < 16; ++c) {
+    int previous = 0;
+    for (int i = 0; i < 4; ++i) {
+      std::set<int> depends;
+      if (previous != 0) {
+        depends.insert(previous);
+      }
+      previous = index;
+      tests[index++] = MakeTest(5, depends);
+    }
+  }
+  int setup = index++;
+  tests[setup] = MakeTest(1);
+  tests[index++] = MakeTest(300, { setup });
+
+  double level = Simulate(tests, OrderByDependencyLevel(tests), 4);
+  double critical = Simulate(tests, cmCTestOrderTestsByCriticalPath(tests), 4);
+  std::cout << "  fixture -j4: dependency level " << level
+            << ", critical path " << critical << '\n';
+  ASSERT_EQUAL(critical, 301);
+  ASSERT_TRUE(level > critical);
+
+  // Report the makespan of synthetic suites under both orderings.
+  for (std::size_t parallelLevel : { 4, 16, 64 }) {
+    double levelTotal = 0;
+    double criticalTotal = 0;
+    for (std::uint32_t seed = 1; seed <= 5; ++seed) {
+      cmCTestOrderingTests suite = MakeSuite(seed);
+      double l = Simulate(suite, OrderByDependencyLevel(suite), parallelLevel);
+      double c =
+        Simulate(suite, cmCTestOrderTestsByCriticalPath(suite), parallelLevel);
+      ASSERT_TRUE(l > 0 && c > 0);
+      levelTotal += l;
+      criticalTotal += c;
+    }
+    std::cout << "  synthetic -j" << parallelLevel << ": dependency level "
+              << levelTotal / 5 << ", critical path " << criticalTotal / 5
+              << '\n';
+  }
+  return true;
+}
+}
+
+int testCTestTestOrdering(int /*unused*/, char* /*unused*/[])
+{
+  return runTests({
+    testDependencyLevel,
+    testCriticalPath,
+    testDependenciesFirst,
+    testMakespan,
+  });
+}
@@ -113,7 +113,7 @@ int testGccDepfileReader(int argc, char* argv[])
 
   std::string dataDirPath = argv[1];
   dataDirPath += "/testGccDepfileReader_data";
-  int const numberOfTestFiles = 7; // 6th file doesn't exist
+  int const numberOfTestFiles = 8; // 6th file doesn't exist
   for (int i = 1; i <= numberOfTestFiles; ++i) {
     std::string const base = dataDirPath + "/deps" + std::to_string(i);
     std::string const depfile = base + ".d";
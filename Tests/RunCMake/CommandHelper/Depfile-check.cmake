@@ -0,0 +1,14 @@
+file(GLOB_RECURSE build_files
+  "${RunCMake_TEST_BINARY_DIR}/*.ninja"
+  "${RunCMake_TEST_BINARY_DIR}/*.make"
+  )
+set(found 0)
+foreach(f IN LISTS build_files)
+  file(STRINGS "${f}" lines REGEX "cmcmdhelper")
+  if(lines)
+    set(found 1)
+  endif()
+endforeach()
+if(NOT found)
+  set(RunCMake_TEST_FAILED "No build file runs cmake through cmcmdhelper.")
+endif()
@@ -0,0 +1,7 @@
+cmake_policy(SET CMP0116 NEW)
+add_custom_command(
+  OUTPUT out.txt
+  COMMAND ${CMAKE_COMMAND} -P ${CMAKE_CURRENT_SOURCE_DIR}/WriteDepfile.cmake
+  DEPFILE out.d
+  )
+add_custom_target(drive ALL DEPENDS out.txt)
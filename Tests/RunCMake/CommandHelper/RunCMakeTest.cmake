@@ -0,0 +1,21 @@
+include(RunCMake)
+
+get_filename_component(bin_dir "${CMAKE_COMMAND}" DIRECTORY)
+set(helper "${bin_dir}/cmcmdhelper")
+
+# The first invocation starts the server and runs the command itself.
+# Later ones run the command in the server.  Both must behave the same.
+run_cmake_command(EchoColor-1
+  ${helper} ${CMAKE_COMMAND} -E cmake_echo_color --switch= --red hello)
+run_cmake_command(EchoColor-2
+  ${helper} ${CMAKE_COMMAND} -E cmake_echo_color --switch= --red hello)
+run_cmake_command(BadArgs
+  ${helper} ${CMAKE_COMMAND} -E cmake_transform_depfile)
+run_cmake_command(Declined ${helper} ${CMAKE_COMMAND} -E echo declined)
+
+block()
+  set(RunCMake_TEST_BINARY_DIR ${RunCMake_BINARY_DIR}/Depfile-build)
+  run_cmake_with_options(Depfile -DCMAKE_COMMAND_HELPER=ON)
+  set(RunCMake_TEST_NO_CLEAN 1)
+  run_cmake_command(Depfile-build ${CMAKE_COMMAND} --build .)
+endblock()
@@ -0,0 +1,2 @@
+file(WRITE out.txt "out\n")
+file(WRITE out.d "out.txt: ${CMAKE_CURRENT_LIST_FILE}\n")
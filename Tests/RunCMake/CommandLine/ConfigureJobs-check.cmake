@@ -0,0 +1,10 @@
+file(READ "${ConfigureJobsOutput}" profile)
+if(NOT profile MATCHES [["name" *: *"listfile-prefetch"]])
+  set(RunCMake_TEST_FAILED "Expected a listfile-prefetch counter event")
+  return()
+endif()
+# Every literal add_subdirectory() call is prefetched, even if not reached.
+if(NOT profile MATCHES [["queued" *: *([0-9]+)]] OR NOT CMAKE_MATCH_1 EQUAL 4)
+  set(RunCMake_TEST_FAILED
+    "Expected 4 prefetched list files, got ${CMAKE_MATCH_1}")
+endif()
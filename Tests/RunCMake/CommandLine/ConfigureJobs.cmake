@@ -0,0 +1,6 @@
+add_subdirectory(ConfigureJobs/a)
+add_subdirectory(ConfigureJobs/b)
+if(FALSE)
+  add_subdirectory(ConfigureJobs/missing)
+endif()
+add_subdirectory(ConfigureJobs/c)
@@ -0,0 +1,23 @@
+file(READ "${FileSystemCacheOutput}" profile)
+string(JSON n LENGTH "${profile}")
+math(EXPR last "${n} - 1")
+set(hits "")
+foreach(i RANGE ${last})
+  string(JSON ph GET "${profile}" ${i} ph)
+  if(ph STREQUAL "C")
+    string(JSON name GET "${profile}" ${i} name)
+    string(JSON cat GET "${profile}" ${i} cat)
+    if(name STREQUAL "filesystem-cache" AND cat STREQUAL "configure")
+      string(JSON hits GET "${profile}" ${i} args hits)
+    endif()
+  endif()
+endforeach()
+if(hits STREQUAL "")
+  set(RunCMake_TEST_FAILED "Expected a filesystem-cache counter event")
+  return()
+endif()
+# The repeated searches for the file reuse the first result.
+if(hits LESS 4)
+  set(RunCMake_TEST_FAILED
+    "Expected at least 4 filesystem cache hits, got ${hits}")
+endif()
@@ -0,0 +1,15 @@
+set(dir "${CMAKE_CURRENT_BINARY_DIR}/include")
+file(MAKE_DIRECTORY "${dir}")
+find_file(missing NAMES FileSystemCache.h PATHS "${dir}" NO_DEFAULT_PATH)
+if(missing)
+  message(FATAL_ERROR "Found ${missing} before it was written")
+endif()
+
+# Files written by CMake are seen by the next query.
+file(WRITE "${dir}/FileSystemCache.h" "")
+foreach(i RANGE 4)
+  find_file(found_${i} NAMES FileSystemCache.h PATHS "${dir}" NO_DEFAULT_PATH)
+  if(NOT found_${i})
+    message(FATAL_ERROR "Did not find FileSystemCache.h after writing it")
+  endif()
+endforeach()
@@ -0,0 +1,18 @@
+foreach(i RANGE 3)
+  file(READ "${RunCMake_TEST_BINARY_DIR}/out${i}.txt" content)
+  if(NOT content STREQUAL "A;B\n")
+    set(RunCMake_TEST_FAILED "out${i}.txt contains \"${content}\"")
+    return()
+  endif()
+endforeach()
+
+file(READ "${GenExMemoOutput}" profile)
+if(NOT profile MATCHES [["name" *: *"genex-memo"]])
+  set(RunCMake_TEST_FAILED "Expected a genex-memo counter event")
+  return()
+endif()
+# The same expression is evaluated for four outputs in the same context.
+if(NOT profile MATCHES [["eval_hits" *: *([0-9]+)]] OR CMAKE_MATCH_1 LESS 3)
+  set(RunCMake_TEST_FAILED
+    "Expected at least 3 memoized evaluations, got ${CMAKE_MATCH_1}")
+endif()
@@ -0,0 +1,7 @@
+add_library(iface INTERFACE)
+set_property(TARGET iface PROPERTY INTERFACE_COMPILE_DEFINITIONS
+  A $<$<BOOL:1>:B> $<$<BOOL:0>:C>)
+foreach(i RANGE 3)
+  file(GENERATE OUTPUT out${i}.txt
+    CONTENT "$<TARGET_PROPERTY:iface,INTERFACE_COMPILE_DEFINITIONS>\n")
+endforeach()
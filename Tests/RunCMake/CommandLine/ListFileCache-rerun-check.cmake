@@ -0,0 +1,14 @@
+file(READ "${ListFileCacheOutput}" profile)
+if(NOT profile MATCHES [["name" *: *"listfile-parse-cache"]])
+  set(RunCMake_TEST_FAILED "Expected a listfile-parse-cache counter event")
+  return()
+endif()
+if(NOT profile MATCHES [["hits" *: *([0-9]+)]] OR CMAKE_MATCH_1 EQUAL 0)
+  set(RunCMake_TEST_FAILED "Expected list file parse cache hits")
+  return()
+endif()
+if(NOT profile MATCHES [["misses" *: *([0-9]+)]] OR NOT CMAKE_MATCH_1 EQUAL 1)
+  # Only the counter file rewritten by the previous run should miss.
+  set(RunCMake_TEST_FAILED
+    "Expected exactly one list file parse cache miss, got ${CMAKE_MATCH_1}")
+endif()
@@ -0,0 +1,8 @@
+set(counter_file "${CMAKE_CURRENT_BINARY_DIR}/counter.cmake")
+set(counter 0)
+if(EXISTS "${counter_file}")
+  include("${counter_file}")
+endif()
+math(EXPR counter "${counter} + 1")
+file(WRITE "${counter_file}" "set(counter ${counter})\n")
+message(STATUS "counter=${counter}")
@@ -0,0 +1,10 @@
+file(READ "${RegexCacheOutput}" profile)
+if(NOT profile MATCHES [["name" *: *"regex-cache"]])
+  set(RunCMake_TEST_FAILED "Expected a regex-cache counter event")
+  return()
+endif()
+# Each of the two patterns is compiled once and then reused.
+if(NOT profile MATCHES [["hits" *: *([0-9]+)]] OR CMAKE_MATCH_1 LESS 18)
+  set(RunCMake_TEST_FAILED
+    "Expected at least 18 regex cache hits, got ${CMAKE_MATCH_1}")
+endif()
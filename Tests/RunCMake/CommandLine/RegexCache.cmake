@@ -0,0 +1,5 @@
+foreach(i RANGE 9)
+  string(REGEX MATCH "^([0-9]+)\\.([0-9]+)" version "3.${i}.1")
+  if(version MATCHES "^3\\.")
+  endif()
+endforeach()
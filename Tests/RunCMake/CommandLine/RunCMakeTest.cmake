@@ -1270,6 +1270,50 @@ set(RunCMake_TEST_OPTIONS --profiling-format=google-trace --profiling-output=${P
 run_cmake(ProfilingTest)
 unset(RunCMake_TEST_OPTIONS)
 
+block()
+  set(RunCMake_TEST_BINARY_DIR "${RunCMake_BINARY_DIR}/ListFileCache-build")
+  set(ListFileCacheOutput ${RunCMake_TEST_BINARY_DIR}/output.json)
+  set(RunCMake_TEST_OPTIONS -DCMAKE_LISTFILE_CACHE=ON
+    --profiling-format=google-trace --profiling-output=${ListFileCacheOutput})
+  run_cmake(ListFileCache)
+  set(RunCMake_TEST_NO_CLEAN 1)
+  run_cmake_command(ListFileCache-rerun ${CMAKE_COMMAND} .
+    --profiling-format=google-trace --profiling-output=${ListFileCacheOutput})
+endblock()
+
+block()
+  set(RunCMake_TEST_BINARY_DIR "${RunCMake_BINARY_DIR}/ConfigureJobs-build")
+  set(ConfigureJobsOutput ${RunCMake_TEST_BINARY_DIR}/output.json)
+  set(RunCMake_TEST_OPTIONS --configure-jobs 4
+    --profiling-format=google-trace --profiling-output=${ConfigureJobsOutput})
+  run_cmake(ConfigureJobs)
+endblock()
+run_cmake_with_options(configure-jobs-invalid --configure-jobs=0)
+
+block()
+  set(RunCMake_TEST_BINARY_DIR "${RunCMake_BINARY_DIR}/RegexCache-build")
+  set(RegexCacheOutput ${RunCMake_TEST_BINARY_DIR}/output.json)
+  set(RunCMake_TEST_OPTIONS
+    --profiling-format=google-trace --profiling-output=${RegexCacheOutput})
+  run_cmake(RegexCache)
+endblock()
+
+block()
+  set(RunCMake_TEST_BINARY_DIR "${RunCMake_BINARY_DIR}/GenExMemo-build")
+  set(GenExMemoOutput ${RunCMake_TEST_BINARY_DIR}/output.json)
+  set(RunCMake_TEST_OPTIONS
+    --profiling-format=google-trace --profiling-output=${GenExMemoOutput})
+  run_cmake(GenExMemo)
+endblock()
+
+block()
+  set(RunCMake_TEST_BINARY_DIR "${RunCMake_BINARY_DIR}/FileSystemCache-build")
+  set(FileSystemCacheOutput ${RunCMake_TEST_BINARY_DIR}/output.json)
+  set(RunCMake_TEST_OPTIONS
+    --profiling-format=google-trace --profiling-output=${FileSystemCacheOutput})
+  run_cmake(FileSystemCache)
+endblock()
+
 run_cmake_with_options(help-arbitrary "--help" "CMAKE_CXX_IGNORE_EXTENSIONS")
 run_cmake_with_options(help-variable-lang "--help-variable" "CMAKE_CXX_PVS_STUDIO")
 
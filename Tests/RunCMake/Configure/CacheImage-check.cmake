@@ -0,0 +1,10 @@
+set(image "${RunCMake_TEST_BINARY_DIR}/CMakeFiles/CMakeCache.bin")
+if(RunCMake_TEST_VARIANT_DESCRIPTION STREQUAL "-rerun")
+  if(NOT EXISTS "${image}")
+    set(RunCMake_TEST_FAILED "Cache image not written:\n  ${image}")
+  endif()
+elseif(RunCMake_TEST_VARIANT_DESCRIPTION STREQUAL "-off")
+  if(EXISTS "${image}")
+    set(RunCMake_TEST_FAILED "Cache image not removed:\n  ${image}")
+  endif()
+endif()
@@ -0,0 +1 @@
+set(CACHE_IMAGE_VALUE "old" CACHE STRING "Value to edit in CMakeCache.txt")
@@ -67,6 +67,31 @@ block()
   run_cmake(RemoveCache)
 endblock()
 
+block()
+  set(RunCMake_TEST_BINARY_DIR ${RunCMake_BINARY_DIR}/CacheImage-build)
+  run_cmake_with_options(CacheImage -DCMAKE_CACHE_IMAGE=ON)
+  set(RunCMake_TEST_NO_CLEAN 1)
+  execute_process(COMMAND ${CMAKE_COMMAND} -E sleep 1) # handle 1s resolution
+  set(RunCMake_TEST_VARIANT_DESCRIPTION "-rerun")
+  run_cmake(CacheImage)
+  # Edits of CMakeCache.txt take precedence over the image.
+  set(cache "${RunCMake_TEST_BINARY_DIR}/CMakeCache.txt")
+  file(READ "${cache}" content)
+  string(REPLACE "CACHE_IMAGE_VALUE:STRING=old" "CACHE_IMAGE_VALUE:STRING=new"
+    content "${content}")
+  file(WRITE "${cache}" "${content}")
+  run_cmake_command(CacheImage-edited ${CMAKE_COMMAND} -N -L .)
+  # A damaged image is ignored.
+  set(image "${RunCMake_TEST_BINARY_DIR}/CMakeFiles/CMakeCache.bin")
+  execute_process(COMMAND ${CMAKE_COMMAND} -E sleep 1) # handle 1s resolution
+  set(RunCMake_TEST_VARIANT_DESCRIPTION "-corrupt")
+  run_cmake_with_options(CacheImage -DCACHE_IMAGE_VALUE=corrupt)
+  file(WRITE "${image}" "CMCACHE")
+  run_cmake_command(CacheImage-corrupt ${CMAKE_COMMAND} -N -L .)
+  set(RunCMake_TEST_VARIANT_DESCRIPTION "-off")
+  run_cmake_with_options(CacheImage -DCMAKE_CACHE_IMAGE=OFF)
+endblock()
+
 if(NOT RunCMake_GENERATOR MATCHES "^Ninja Multi-Config$")
   run_cmake(NoCMAKE_CROSS_CONFIGS)
   run_cmake(NoCMAKE_DEFAULT_BUILD_TYPE)
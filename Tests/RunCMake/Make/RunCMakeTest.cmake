@@ -64,6 +64,20 @@ run_VerboseBuildShort()
 
 run_cmake(IncludeRegexSubdir)
 
+function(run_SharedIncludeCache)
+  set(RunCMake_TEST_BINARY_DIR ${RunCMake_BINARY_DIR}/SharedIncludeCache-build)
+  run_cmake_with_options(SharedIncludeCache -DCMAKE_DEPENDS_USE_COMPILER=OFF)
+  set(RunCMake_TEST_NO_CLEAN 1)
+  set(RunCMake_TEST_OUTPUT_MERGE 1)
+  run_cmake_command(SharedIncludeCache-build ${CMAKE_COMMAND} --build .)
+  # Change the header in a later time step than its first scan.
+  execute_process(COMMAND ${CMAKE_COMMAND} -E sleep 1.125)
+  file(WRITE "${RunCMake_TEST_BINARY_DIR}/include/shared.h"
+    "#include \"second.h\"\n")
+  run_cmake_command(SharedIncludeCache-rebuild ${CMAKE_COMMAND} --build .)
+endfunction()
+run_SharedIncludeCache()
+
 function(run_MakefileConflict)
   run_cmake(MakefileConflict)
   set(RunCMake_TEST_NO_CLEAN 1)
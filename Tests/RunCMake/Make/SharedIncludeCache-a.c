@@ -0,0 +1,5 @@
+#include "shared.h"
+int shared_a(void)
+{
+  return 0;
+}
@@ -0,0 +1,5 @@
+#include "shared.h"
+int shared_b(void)
+{
+  return 0;
+}
@@ -0,0 +1,3 @@
+set(expect first)
+set(reject second)
+include("${RunCMake_SOURCE_DIR}/SharedIncludeCacheCheck.cmake")
@@ -0,0 +1,3 @@
+set(expect second)
+set(reject first)
+include("${RunCMake_SOURCE_DIR}/SharedIncludeCacheCheck.cmake")
@@ -0,0 +1,8 @@
+enable_language(C)
+file(WRITE "${CMAKE_CURRENT_BINARY_DIR}/include/shared.h"
+  "#include \"first.h\"\n")
+file(WRITE "${CMAKE_CURRENT_BINARY_DIR}/include/first.h" "\n")
+file(WRITE "${CMAKE_CURRENT_BINARY_DIR}/include/second.h" "\n")
+include_directories("${CMAKE_CURRENT_BINARY_DIR}/include")
+add_library(shared_a STATIC SharedIncludeCache-a.c)
+add_library(shared_b STATIC SharedIncludeCache-b.c)
@@ -0,0 +1,22 @@
+# Both targets share one include cache that records the header.
+file(GLOB caches
+  "${RunCMake_TEST_BINARY_DIR}/CMakeFiles/IncludeCache/C-*.includecache")
+list(LENGTH caches count)
+if(NOT count EQUAL 1)
+  set(RunCMake_TEST_FAILED "Expected one shared include cache, found:\n  ${caches}")
+  return()
+endif()
+file(STRINGS "${caches}" lines REGEX "shared\\.h$")
+if(NOT lines)
+  set(RunCMake_TEST_FAILED "The shared include cache does not record shared.h.")
+  return()
+endif()
+
+foreach(target IN ITEMS shared_a shared_b)
+  set(depend "${RunCMake_TEST_BINARY_DIR}/CMakeFiles/${target}.dir/depend.make")
+  file(READ "${depend}" content)
+  if(NOT content MATCHES "${expect}\\.h" OR content MATCHES "${reject}\\.h")
+    set(RunCMake_TEST_FAILED "${target} should depend on ${expect}.h only:\n${content}")
+    return()
+  endif()
+endforeach()
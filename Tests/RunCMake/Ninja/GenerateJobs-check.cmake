@@ -0,0 +1,24 @@
+# Compare the files written with threads to those written without.
+foreach(file IN ITEMS build.ninja CMakeFiles/rules.ninja)
+  get_filename_component(name "${file}" NAME_WE)
+  set(serial "${RunCMake_TEST_BINARY_DIR}/${name}-serial.ninja")
+  if(NOT EXISTS "${serial}")
+    continue()
+  endif()
+  file(READ "${serial}" expect)
+  file(READ "${RunCMake_TEST_BINARY_DIR}/${file}" actual)
+  if(NOT actual STREQUAL expect)
+    string(APPEND RunCMake_TEST_FAILED
+      "${file} differs from the one written without threads.\n")
+  endif()
+endforeach()
+
+set(trace "${RunCMake_TEST_BINARY_DIR}/trace.json")
+if(EXISTS "${trace}")
+  file(READ "${trace}" trace_content)
+  if(NOT trace_content MATCHES [["statements" *: *([0-9]+)]]
+      OR CMAKE_MATCH_1 LESS 5)
+    string(APPEND RunCMake_TEST_FAILED
+      "The trace does not report formatted statements:\n${trace}\n")
+  endif()
+endif()
@@ -0,0 +1,15 @@
+enable_language(C)
+
+add_library(greeting STATIC greeting.c)
+add_library(greeting2 STATIC greeting2.c)
+add_executable(hello hello_with_two_greetings.c)
+target_link_libraries(hello PRIVATE greeting greeting2)
+
+add_custom_command(
+  OUTPUT generated.c
+  COMMAND ${CMAKE_COMMAND} -E copy ${CMAKE_CURRENT_SOURCE_DIR}/hello.c
+          generated.c
+  DEPENDS hello.c
+  )
+add_executable(generated ${CMAKE_CURRENT_BINARY_DIR}/generated.c)
+add_custom_target(custom ALL COMMAND ${CMAKE_COMMAND} -E echo custom)
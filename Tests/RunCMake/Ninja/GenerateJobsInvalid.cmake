@@ -0,0 +1 @@
+set(CMAKE_NINJA_GENERATE_JOBS 0)
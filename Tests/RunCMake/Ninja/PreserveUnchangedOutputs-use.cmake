@@ -0,0 +1 @@
+file(APPEND "${OUTPUT}" "run\n")
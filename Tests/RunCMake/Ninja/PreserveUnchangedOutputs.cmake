@@ -0,0 +1,20 @@
+file(WRITE "${CMAKE_CURRENT_BINARY_DIR}/content.txt" "unchanged\n")
+file(WRITE "${CMAKE_CURRENT_BINARY_DIR}/trigger.txt" "0\n")
+
+# Rewrite the output with the same content whenever trigger.txt changes.
+add_custom_command(
+  OUTPUT gen.txt
+  COMMAND "${CMAKE_COMMAND}" -E copy content.txt gen.txt
+  DEPENDS "${CMAKE_CURRENT_BINARY_DIR}/content.txt"
+          "${CMAKE_CURRENT_BINARY_DIR}/trigger.txt"
+  PRESERVE_UNCHANGED_OUTPUTS
+  )
+
+# Record every run of the command using the output.
+add_custom_command(
+  OUTPUT use.txt
+  COMMAND "${CMAKE_COMMAND}" -DOUTPUT=use.txt
+          -P "${CMAKE_CURRENT_SOURCE_DIR}/PreserveUnchangedOutputs-use.cmake"
+  DEPENDS "${CMAKE_CURRENT_BINARY_DIR}/gen.txt"
+  )
+add_custom_target(use ALL DEPENDS "${CMAKE_CURRENT_BINARY_DIR}/use.txt")
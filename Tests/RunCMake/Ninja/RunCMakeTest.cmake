@@ -465,3 +465,72 @@ endif()
 run_cmake(LINK_OPTIONSWithNewlines)
 
 run_cmake(StaticLibShort)
+
+function(run_GenerateJobs)
+  set(RunCMake_TEST_BINARY_DIR ${RunCMake_BINARY_DIR}/GenerateJobs-build)
+  run_cmake(GenerateJobs)
+  set(RunCMake_TEST_NO_CLEAN 1)
+  # Compilers are detected only by the first run.  Compare to a second one.
+  set(RunCMake_TEST_VARIANT_DESCRIPTION "-rerun")
+  run_cmake(GenerateJobs)
+  foreach(file IN ITEMS build.ninja CMakeFiles/rules.ninja)
+    get_filename_component(name "${file}" NAME_WE)
+    file(COPY_FILE "${RunCMake_TEST_BINARY_DIR}/${file}"
+      "${RunCMake_TEST_BINARY_DIR}/${name}-serial.ninja")
+  endforeach()
+  set(RunCMake_TEST_VARIANT_DESCRIPTION "-jobs-4")
+  run_cmake_with_options(GenerateJobs -DCMAKE_NINJA_GENERATE_JOBS=4
+    --profiling-format=google-trace
+    --profiling-output=${RunCMake_TEST_BINARY_DIR}/trace.json)
+endfunction()
+run_GenerateJobs()
+run_cmake(GenerateJobsInvalid)
+
+function(run_TargetFragments)
+  set(RunCMake_TEST_BINARY_DIR ${RunCMake_BINARY_DIR}/TargetFragments-build)
+  run_cmake(TargetFragments)
+  set(RunCMake_TEST_NO_CLEAN 1)
+  # Compilers are detected only by the first run.  Check a third one.
+  set(RunCMake_TEST_VARIANT_DESCRIPTION "-rerun")
+  run_cmake(TargetFragments)
+  set(RunCMake_TEST_VARIANT_DESCRIPTION "-unchanged")
+  run_cmake_with_options(TargetFragments
+    --profiling-format=google-trace
+    --profiling-output=${RunCMake_TEST_BINARY_DIR}/trace.json)
+endfunction()
+run_TargetFragments()
+
+function(run_PreserveUnchangedOutputs)
+  set(RunCMake_TEST_BINARY_DIR
+    ${RunCMake_BINARY_DIR}/PreserveUnchangedOutputs-build)
+  run_cmake(PreserveUnchangedOutputs)
+
+  function(check_use_runs expect)
+    file(STRINGS "${RunCMake_TEST_BINARY_DIR}/use.txt" runs)
+    list(LENGTH runs actual)
+    if(NOT actual EQUAL expect)
+      message(FATAL_ERROR
+        "The command using gen.txt ran ${actual} times, not ${expect}.")
+    endif()
+  endfunction()
+
+  run_ninja("${RunCMake_TEST_BINARY_DIR}")
+  check_use_runs(1)
+
+  # Rewriting gen.txt with the same content does not run its users.
+  sleep(1)
+  file(WRITE "${RunCMake_TEST_BINARY_DIR}/trigger.txt" "1\n")
+  run_ninja("${RunCMake_TEST_BINARY_DIR}")
+  check_use_runs(1)
+  run_ninja("${RunCMake_TEST_BINARY_DIR}")
+  if(NOT ninja_stdout MATCHES "ninja: no work to do")
+    message(FATAL_ERROR "The build is not up to date:\n${ninja_stdout}")
+  endif()
+
+  # Changing the content of gen.txt does.
+  sleep(1)
+  file(WRITE "${RunCMake_TEST_BINARY_DIR}/content.txt" "changed\n")
+  run_ninja("${RunCMake_TEST_BINARY_DIR}")
+  check_use_runs(2)
+endfunction()
+run_PreserveUnchangedOutputs()
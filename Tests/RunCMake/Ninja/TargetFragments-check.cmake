@@ -0,0 +1,35 @@
+set(fragment "${RunCMake_TEST_BINARY_DIR}/CMakeFiles/hello.dir/build.ninja")
+if(NOT EXISTS "${fragment}")
+  string(APPEND RunCMake_TEST_FAILED "Fragment not written:\n  ${fragment}\n")
+  return()
+endif()
+file(STRINGS "${fragment}" header LIMIT_COUNT 1)
+if(NOT header MATCHES "^# Fragment content hash: [0-9a-f]+$")
+  string(APPEND RunCMake_TEST_FAILED
+    "Fragment does not start with its hash:\n  ${header}\n")
+endif()
+file(READ "${RunCMake_TEST_BINARY_DIR}/build.ninja" build_ninja)
+set(include "${header}\ninclude CMakeFiles/hello.dir/build.ninja\n")
+string(FIND "${build_ninja}" "${include}" pos)
+if(pos EQUAL -1)
+  string(APPEND RunCMake_TEST_FAILED
+    "build.ninja does not include the fragment with its hash.\n")
+endif()
+if(build_ninja MATCHES "build CMakeFiles/hello.dir/")
+  string(APPEND RunCMake_TEST_FAILED
+    "build.ninja contains build statements of the fragment.\n")
+endif()
+
+set(trace "${RunCMake_TEST_BINARY_DIR}/trace.json")
+if(EXISTS "${trace}")
+  file(READ "${trace}" trace_content)
+  if(NOT trace_content MATCHES [=["fragments_written" *: *0[^0-9]]=])
+    string(APPEND RunCMake_TEST_FAILED
+      "Unchanged fragments were written again:\n${trace}\n")
+  endif()
+  if(NOT trace_content MATCHES [=["fragments_unchanged" *: *([0-9]+)]=]
+      OR CMAKE_MATCH_1 LESS 2)
+    string(APPEND RunCMake_TEST_FAILED
+      "Unchanged fragments were not counted:\n${trace}\n")
+  endif()
+endif()
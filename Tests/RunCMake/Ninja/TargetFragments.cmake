@@ -0,0 +1,6 @@
+enable_language(C)
+set(CMAKE_NINJA_TARGET_FRAGMENTS ON)
+
+add_library(greeting STATIC greeting.c)
+add_executable(hello hello_with_greeting.c)
+target_link_libraries(hello PRIVATE greeting)
@@ -0,0 +1,15 @@
+function(check_expansions expected)
+  set(name "suffix")
+  set(var_suffix "${expected}")
+  set(result "${var_${name}}|$ENV{CHECK_EXPANSIONS}|${CMAKE_CURRENT_LIST_LINE}
+${CMAKE_CURRENT_LIST_LINE}|a\;b|\${literal}|\t|$<X>")
+  message(STATUS "${result}")
+  set(list a ${var_${name}};c)
+  list(LENGTH list n)
+  message(STATUS "${n} ${list}")
+endfunction()
+
+foreach(v IN ITEMS x y)
+  set(ENV{CHECK_EXPANSIONS} "env-${v}")
+  check_expansions(${v})
+endforeach()
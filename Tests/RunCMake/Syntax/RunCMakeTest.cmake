@@ -98,6 +98,7 @@ run_cmake(NameWithCarriageReturnQuoted)
 run_cmake(NameWithEscapedSpacesQuoted)
 run_cmake(NameWithEscapedTabsQuoted)
 run_cmake(Dollar)
+run_cmake(ExpandRepeated)
 
 # Variable special types
 run_cmake(QueryCache)
@@ -3,6 +3,7 @@ include(RunCMake)
 run_cmake(ConfigureLogTransitions)
 run_cmake(ConfigureLogTransitionsSuppressed)
 run_cmake(Created)
+run_cmake(CreatedInSearchedDir)
 run_cmake(BuildTreePrefixNoLeak)
 run_cmake(FromPrefixPath)
 run_cmake(FromPATHEnv)
@@ -0,0 +1,17 @@
+file(READ "${ResolutionCacheOutput}" profile)
+string(JSON n LENGTH "${profile}")
+math(EXPR last "${n} - 1")
+set(hits "")
+foreach(i RANGE ${last})
+  string(JSON ph GET "${profile}" ${i} ph)
+  if(ph STREQUAL "C")
+    string(JSON name GET "${profile}" ${i} name)
+    if(name STREQUAL "find-package-resolution-cache")
+      string(JSON hits GET "${profile}" ${i} args hits)
+    endif()
+  endif()
+endforeach()
+if(NOT hits STREQUAL ResolutionCacheHits)
+  set(RunCMake_TEST_FAILED
+    "Expected ${ResolutionCacheHits} resolution cache hits, got '${hits}'")
+endif()
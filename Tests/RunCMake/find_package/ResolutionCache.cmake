@@ -0,0 +1,3 @@
+set(CMAKE_PREFIX_PATH "${ResolutionCachePrefix}/new;${ResolutionCachePrefix}/old")
+find_package(Resolved 1.0 CONFIG REQUIRED)
+message(STATUS "Resolved ${Resolved_VERSION} in ${Resolved_DIR}")
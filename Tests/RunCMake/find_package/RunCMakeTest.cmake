@@ -51,6 +51,44 @@ run_cmake(RequiredOptionValuesClash)
 run_cmake(RequiredOptionalKeywordsClash)
 run_cmake(RequiredVarOptional)
 run_cmake(RequiredVarNested)
+
+block()
+  set(RunCMake_TEST_BINARY_DIR ${RunCMake_BINARY_DIR}/ResolutionCache-build)
+  set(prefix ${RunCMake_BINARY_DIR}/ResolutionCache-prefix)
+  file(REMOVE_RECURSE "${RunCMake_TEST_BINARY_DIR}" "${prefix}")
+  file(WRITE "${prefix}/old/lib/cmake/Resolved/ResolvedConfig.cmake" "")
+  file(WRITE "${prefix}/old/lib/cmake/Resolved/ResolvedConfigVersion.cmake"
+    "set(PACKAGE_VERSION 1.0)\nset(PACKAGE_VERSION_COMPATIBLE TRUE)\n")
+  file(MAKE_DIRECTORY "${prefix}/new")
+  # Directories modified within a second of the search are not recorded.
+  execute_process(COMMAND ${CMAKE_COMMAND} -E sleep 2.1)
+
+  set(RunCMake_TEST_NO_CLEAN 1)
+  set(ResolutionCacheOutput ${RunCMake_TEST_BINARY_DIR}/output.json)
+  set(RunCMake_TEST_OPTIONS --fresh
+    -DCMAKE_FIND_PACKAGE_RESOLUTION_CACHE=ON
+    -DResolutionCachePrefix=${prefix}
+    --profiling-format=google-trace
+    --profiling-output=${ResolutionCacheOutput})
+  set(RunCMake_TEST_EXPECT_stdout "Resolved 1\\.0 in [^\n]*/old/lib/cmake/Resolved")
+  set(ResolutionCacheHits 0)
+  run_cmake(ResolutionCache)
+
+  # A clean configure uses the recorded candidates.
+  set(RunCMake_TEST_VARIANT_DESCRIPTION "-cached")
+  set(ResolutionCacheHits 1)
+  run_cmake(ResolutionCache)
+
+  # A package in a searched directory that changed is found.
+  file(WRITE "${prefix}/new/lib/cmake/Resolved/ResolvedConfig.cmake" "")
+  file(WRITE "${prefix}/new/lib/cmake/Resolved/ResolvedConfigVersion.cmake"
+    "set(PACKAGE_VERSION 2.0)\nset(PACKAGE_VERSION_COMPATIBLE TRUE)\n")
+  set(RunCMake_TEST_VARIANT_DESCRIPTION "-changed")
+  set(RunCMake_TEST_EXPECT_stdout "Resolved 2\\.0 in [^\n]*/new/lib/cmake/Resolved")
+  set(ResolutionCacheHits 0)
+  run_cmake(ResolutionCache)
+endblock()
+
 run_cmake(FindRootPathAndPrefixPathAreEqual)
 run_cmake(FindRootPathAndPrefixPathWithCommonSubdir)
 run_cmake(SetFoundFALSE)
@@ -0,0 +1,16 @@
+set(dir ${CMAKE_CURRENT_BINARY_DIR}/include)
+file(MAKE_DIRECTORY ${dir})
+find_path(CREATED_DIR NAMES created.h PATHS ${dir} NO_CACHE NO_DEFAULT_PATH)
+message("CREATED_DIR='${CREATED_DIR}'")
+
+# A file written by CMake into a directory searched before is found.
+file(WRITE "${dir}/created.h" "")
+find_path(CREATED_DIR NAMES created.h PATHS ${dir} NO_CACHE NO_DEFAULT_PATH)
+message("CREATED_DIR='${CREATED_DIR}'")
+
+# So is a file written by a child process.
+find_path(TOUCHED_DIR NAMES touched.h PATHS ${dir} NO_CACHE NO_DEFAULT_PATH)
+message("TOUCHED_DIR='${TOUCHED_DIR}'")
+execute_process(COMMAND ${CMAKE_COMMAND} -E touch "${dir}/touched.h")
+find_path(TOUCHED_DIR NAMES touched.h PATHS ${dir} NO_CACHE NO_DEFAULT_PATH)
+message("TOUCHED_DIR='${TOUCHED_DIR}'")
@@ -2,6 +2,7 @@ include(RunCMake)
 
 run_cmake(ConfigureLogTransitions)
 run_cmake(ConfigureLogTransitionsSuppressed)
+run_cmake(Created)
 run_cmake(EmptyOldStyle)
 run_cmake(FromPATHEnv)
 run_cmake(PrefixInPATH)
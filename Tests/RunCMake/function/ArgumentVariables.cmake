@@ -0,0 +1,92 @@
+cmake_policy(SET CMP0140 NEW)
+
+function(check name actual expected)
+  if(NOT "${actual}" STREQUAL "${expected}")
+    message(SEND_ERROR "${name} is \"${actual}\", expected \"${expected}\"")
+  endif()
+endfunction()
+
+function(args a)
+  check(ARGC "${ARGC}" 3)
+  check(ARGV "${ARGV}" "x;y;z")
+  check(ARGN "${ARGN}" "y;z")
+  check(ARGNC "${ARGNC}" 2)
+  check(ARGV0 "${ARGV0}" x)
+  check(ARGV2 "${ARGV2}" z)
+  if(NOT DEFINED ARGV1 OR DEFINED ARGV3 OR DEFINED ARGV01)
+    message(SEND_ERROR "ARGV<n> variables not defined as expected")
+  endif()
+
+  get_cmake_property(vars VARIABLES)
+  list(FILTER vars INCLUDE REGEX "^ARG")
+  check(VARIABLES "${vars}" "ARGC;ARGN;ARGNC;ARGV;ARGV0;ARGV1;ARGV2")
+
+  # Local definitions take precedence.
+  set(ARGN "replaced")
+  unset(ARGV0)
+  check(ARGN "${ARGN}" replaced)
+  if(DEFINED ARGV0)
+    message(SEND_ERROR "ARGV0 is defined after unset()")
+  endif()
+
+  block()
+    check(ARGC "${ARGC}" 3)
+    check(ARGV1 "${ARGV1}" y)
+    set(ARGV2 "from block" PARENT_SCOPE)
+  endblock()
+  check(ARGV2 "${ARGV2}" "from block")
+
+  set(ARGV1 "changed")
+  nested(${ARGV})
+  set(argv_of_args "${ARGV}" PARENT_SCOPE)
+  return(PROPAGATE ARGNC)
+endfunction()
+
+function(nested)
+  check(ARGC "${ARGC}" 3)
+  check(ARGV "${ARGV}" "x;y;z")
+  check(ARGV1 "${ARGV1}" y)
+  check(ARGN "${ARGN}" "x;y;z")
+  check(ARGNC "${ARGNC}" 3)
+endfunction()
+
+args(x y z)
+check(argv_of_args "${argv_of_args}" "x;y;z")
+check(ARGNC "${ARGNC}" 2)
+if(DEFINED ARGC OR DEFINED ARGV0)
+  message(SEND_ERROR "ARG* variables leaked out of the function")
+endif()
+
+# Formal arguments named like the ARG* variables.
+function(shadow ARGC ARGN ARGV1)
+  check(ARGC "${ARGC}" a)
+  check(ARGN "${ARGN}" d)
+  check(ARGV1 "${ARGV1}" c)
+endfunction()
+shadow(a b c d)
+
+# A function called with many arguments.
+function(many)
+  check(ARGC "${ARGC}" 1000)
+  check(ARGV999 "${ARGV999}" 999)
+  list(LENGTH ARGN n)
+  check(n "${n}" 1000)
+endfunction()
+foreach(i RANGE 999)
+  list(APPEND many_args ${i})
+endforeach()
+many(${many_args})
+
+# Watched argument variables are defined on entry.
+function(watch var access value)
+  if(access STREQUAL "MODIFIED_ACCESS")
+    set_property(GLOBAL APPEND PROPERTY watched "${var}=${value}")
+  endif()
+endfunction()
+function(watched a)
+  set(ARGN "replaced")
+endfunction()
+variable_watch(ARGN watch)
+watched(x y z)
+get_property(watched GLOBAL PROPERTY watched)
+check(watched "${watched}" "ARGN=y;z;ARGN=replaced")
@@ -0,0 +1,43 @@
+function(check name actual expected)
+  if(NOT "${actual}" STREQUAL "${expected}")
+    message(SEND_ERROR "${name} is \"${actual}\", expected \"${expected}\"")
+  endif()
+endfunction()
+
+set(prefix_x "px")
+set(y "value of y")
+
+macro(refs a b)
+  set(refs_plain "${a}|${b}|${ARGC}|${ARGN}|${ARGV}|${ARGV0}|${ARGV2}|${ARGV3}")
+  set(refs_nested "${prefix_${a}}|${${b}}|${ARGV${ARGC}}")
+  set(refs_bracket [[${a}|${ARGC}]])
+  set(refs_unchanged "${prefix_x}")
+endmacro()
+
+refs(x y z)
+check(refs_plain "${refs_plain}" "x|y|3|z|x;y;z|x|z|")
+check(refs_nested "${refs_nested}" "px|value of y|")
+check(refs_bracket "${refs_bracket}" [[${a}|${ARGC}]])
+check(refs_unchanged "${refs_unchanged}" "px")
+
+refs(x y)
+check(refs_plain "${refs_plain}" "x|y|2||x;y|x||")
+
+# Values that contain references are substituted one after another.
+refs([[${b}]] y)
+check(refs_plain "${refs_plain}" "y|y|2||;y|||")
+
+# Formal arguments named like the ARG* references take precedence.
+macro(shadow ARGC ARGV1)
+  set(shadow_result "${ARGC}|${ARGV1}|${ARGV0}|${ARGV}")
+endmacro()
+shadow(a b)
+check(shadow_result "${shadow_result}" "a|b|a|a;b")
+
+# Unusual formal argument names.
+macro(unusual [[a}b]] c)
+  set(unusual_result "${a}b}|${c}")
+endmacro()
+set(a "A")
+unusual(1 2)
+check(unusual_result "${unusual_result}" "1|2")
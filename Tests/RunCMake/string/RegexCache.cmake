@@ -0,0 +1,40 @@
+# Compiled patterns are reused across calls.  A nested use of a pattern
+# while it is in use must not disturb the outer match.
+function(nested_match variable access)
+  get_property(nested GLOBAL PROPERTY nested_match)
+  if(nested OR NOT access STREQUAL "MODIFIED_ACCESS")
+    return()
+  endif()
+  set_property(GLOBAL PROPERTY nested_match 1)
+  string(REGEX MATCHALL "([a-z])([0-9])" inner "x9")
+  if(NOT "y8" MATCHES "([a-z])([0-9])")
+    message(SEND_ERROR "Nested if(MATCHES) failed")
+  endif()
+  set_property(GLOBAL PROPERTY nested_match 0)
+endfunction()
+
+foreach(i RANGE 3)
+  string(REGEX MATCHALL "([a-z])([0-9])" matches "a1 b2 c3")
+  if(NOT matches STREQUAL "a1;b2;c3")
+    message(SEND_ERROR "MATCHALL returned \"${matches}\"")
+  endif()
+  string(REGEX REPLACE "([a-z])([0-9])" "\\2\\1" replaced "a1 b2 c3")
+  if(NOT replaced STREQUAL "1a 2b 3c")
+    message(SEND_ERROR "REPLACE returned \"${replaced}\"")
+  endif()
+  set(list a1 b2 cc dd)
+  list(FILTER list INCLUDE REGEX "([a-z])([0-9])")
+  if(NOT list STREQUAL "a1;b2")
+    message(SEND_ERROR "FILTER returned \"${list}\"")
+  endif()
+endforeach()
+
+variable_watch(CMAKE_MATCH_1 nested_match)
+string(REGEX MATCHALL "([a-z])([0-9])" matches "a1 b2 c3")
+if(NOT matches STREQUAL "a1;b2;c3")
+  message(SEND_ERROR "MATCHALL with nested matches returned \"${matches}\"")
+endif()
+string(REGEX REPLACE "([a-z])([0-9])" "\\2\\1" replaced "a1 b2 c3")
+if(NOT replaced STREQUAL "1a 2b 3c")
+  message(SEND_ERROR "REPLACE with nested matches returned \"${replaced}\"")
+endif()
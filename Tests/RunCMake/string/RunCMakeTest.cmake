@@ -46,6 +46,7 @@ run_cmake(RegexMatch)
 run_cmake(RegexClear)
 run_cmake(RegexMultiMatchClear)
 run_cmake(RegexEmptyMatch)
+run_cmake(RegexCache)
 run_cmake(CMP0186)
 
 run_cmake(UTF-16BE)
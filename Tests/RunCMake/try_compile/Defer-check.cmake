@@ -0,0 +1,8 @@
+file(STRINGS ${RunCMake_TEST_BINARY_DIR}/CMakeCache.txt cache
+  REGEX "^(cached|old_second|final):")
+set(expect "cached:INTERNAL=TRUE;final:INTERNAL=TRUE;old_second:INTERNAL=TRUE")
+list(SORT cache)
+if(NOT cache STREQUAL expect)
+  set(RunCMake_TEST_FAILED
+    "Expected cache entries\n  ${expect}\nbut got\n  ${cache}")
+endif()
@@ -0,0 +1,45 @@
+enable_language(C)
+
+try_compile(pass DEFER
+  SOURCE_FROM_CONTENT pass.c "int main(void) { return 0; }\n"
+  OUTPUT_VARIABLE pass_output
+  COPY_FILE ${CMAKE_CURRENT_BINARY_DIR}/pass_copy)
+try_compile(fail DEFER
+  SOURCE_FROM_CONTENT fail.c "int main(void) { return undefined; }\n"
+  NO_CACHE)
+try_compile(cached DEFER
+  SOURCE_FROM_CONTENT cached.c "int main(void) { return 0; }\n")
+
+foreach(result IN ITEMS pass pass_output fail cached)
+  if(DEFINED ${result})
+    message(SEND_ERROR "'${result}' set before the barrier")
+  endif()
+endforeach()
+
+cmake_language(WAIT_FOR_TRY_COMPILE)
+
+if(NOT pass)
+  message(SEND_ERROR "try_compile 'pass' failed:\n${pass_output}")
+endif()
+if(NOT pass_output MATCHES "Run Build Command")
+  message(SEND_ERROR "'pass_output' has no build output:\n${pass_output}")
+endif()
+if(NOT EXISTS ${CMAKE_CURRENT_BINARY_DIR}/pass_copy)
+  message(SEND_ERROR "try_compile 'pass' did not copy its output")
+endif()
+if(NOT DEFINED fail OR fail)
+  message(SEND_ERROR "try_compile 'fail' did not fail")
+endif()
+
+# The old signature shares its binary directory between calls.
+try_compile(old_first ${CMAKE_CURRENT_BINARY_DIR}
+  ${CMAKE_CURRENT_SOURCE_DIR}/src.c DEFER)
+try_compile(old_second ${CMAKE_CURRENT_BINARY_DIR}
+  ${CMAKE_CURRENT_SOURCE_DIR}/src.c DEFER)
+if(NOT old_first)
+  message(SEND_ERROR "try_compile 'old_first' failed")
+endif()
+
+# The remaining deferred test projects are built at the end.
+try_compile(final DEFER
+  SOURCE_FROM_CONTENT final.c "int main(void) { return 0; }\n")
@@ -0,0 +1,19 @@
+file(READ "${ReuseLanguageSetupOutput}" profile)
+string(JSON n LENGTH "${profile}")
+# The counter events are among the last events of the profile.
+math(EXPR first "${n} - 50")
+set(stats "")
+set(i ${n})
+while(i GREATER 0 AND i GREATER first AND stats STREQUAL "")
+  math(EXPR i "${i} - 1")
+  string(JSON name ERROR_VARIABLE error GET "${profile}" ${i} name)
+  if(name STREQUAL "try-compile-language-setup")
+    string(JSON hits GET "${profile}" ${i} args hits)
+    string(JSON misses GET "${profile}" ${i} args misses)
+    set(stats "${hits} hits, ${misses} misses")
+  endif()
+endwhile()
+if(NOT stats STREQUAL "2 hits, 2 misses")
+  set(RunCMake_TEST_FAILED
+    "Expected 2 hits, 2 misses of the language setup, got '${stats}'")
+endif()
@@ -0,0 +1,29 @@
+enable_language(C)
+set(CMAKE_TRY_COMPILE_REUSE_LANGUAGE_SETUP ON)
+
+try_compile(first
+  SOURCE_FROM_CONTENT first.c "int main(void) { return 0; }\n")
+try_compile(defined
+  SOURCE_FROM_CONTENT defined.c [[
+#ifndef DEFINED
+#  error "DEFINED is not defined"
+#endif
+int main(void) { return 0; }
+]]
+  COMPILE_DEFINITIONS -DDEFINED)
+try_compile(broken
+  SOURCE_FROM_CONTENT broken.c "int main(void) { return undefined; }\n")
+
+# A different cache starts the setup from a different state.
+try_compile(other
+  SOURCE_FROM_CONTENT other.c "int main(void) { return 0; }\n"
+  CMAKE_FLAGS -DOTHER_STATE=1)
+
+foreach(result IN ITEMS first defined other)
+  if(NOT ${result})
+    message(SEND_ERROR "try_compile '${result}' failed")
+  endif()
+endforeach()
+if(broken)
+  message(SEND_ERROR "try_compile 'broken' succeeded")
+endif()
@@ -43,6 +43,18 @@ run_cmake(SourceFromBadName)
 run_cmake(SourceFromBadFile)
 
 run_cmake(ProjectCopyFile)
+
+block()
+  set(ReuseLanguageSetupOutput
+    ${RunCMake_BINARY_DIR}/ReuseLanguageSetup-build/output.json)
+  set(RunCMake_TEST_OPTIONS
+    --profiling-format=google-trace
+    --profiling-output=${ReuseLanguageSetupOutput})
+  run_cmake(ReuseLanguageSetup)
+endblock()
+
+run_cmake(Defer)
+
 run_cmake(NonSourceCopyFile)
 run_cmake(NonSourceCompileDefinitions)
 
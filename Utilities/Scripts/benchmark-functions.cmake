@@ -0,0 +1,56 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file LICENSE.rst or https://cmake.org/licensing for details.
+
+# Measure the cost of function-heavy CMake code.  The script calls a
+# chain of nested functions many times.  Each level defines a few local
+# variables and reads variables that are defined only at the top level,
+# so every lookup walks the whole chain of variable scopes.  It also
+# reads variables that are not defined anywhere.
+#
+# Invoke in script mode, optionally defining these variables:
+# ITERATIONS - number of calls to the outermost function (default 2000)
+# DEPTH      - depth of the function call chain (default 16)
+#
+#   cmake -DITERATIONS=5000 -P Utilities/Scripts/benchmark-functions.cmake
+#
+# Compare the reported wall-clock time and, on Linux, the peak resident
+# set size between two builds of CMake.
+
+if(NOT DEFINED ITERATIONS)
+  set(ITERATIONS 2000)
+endif()
+if(NOT DEFINED DEPTH)
+  set(DEPTH 16)
+endif()
+
+foreach(i RANGE 63)
+  set(global_${i} "value_${i}")
+endforeach()
+
+function(level depth)
+  set(local_a "${depth}")
+  set(local_b "${global_0};${global_31};${global_63}")
+  if(DEFINED undefined_${depth} OR global_7 STREQUAL "")
+    message(FATAL_ERROR "unexpected variable state")
+  endif()
+  if(depth GREATER 0)
+    math(EXPR next "${depth} - 1")
+    level(${next} ${local_b} ${ARGN})
+  endif()
+endfunction()
+
+string(TIMESTAMP start "%s%f")
+foreach(i RANGE 1 ${ITERATIONS})
+  level(${DEPTH} a b c)
+endforeach()
+string(TIMESTAMP stop "%s%f")
+
+math(EXPR elapsed_ms "(${stop} - ${start}) / 1000")
+math(EXPR calls "${ITERATIONS} * (${DEPTH} + 1)")
+message(STATUS "${calls} function calls: ${elapsed_ms} ms")
+
+if(EXISTS "/proc/self/status")
+  file(STRINGS "/proc/self/status" peak REGEX "^VmHWM:")
+  string(REGEX REPLACE "^VmHWM:[ \t]*" "" peak "${peak}")
+  message(STATUS "Peak resident set size: ${peak}")
+endif()
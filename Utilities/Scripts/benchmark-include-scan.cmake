@@ -0,0 +1,113 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file LICENSE.rst or https://cmake.org/licensing for details.
+
+# Measure the include dependency scanning of the Makefile generators.
+# The script generates a project in which every source of every target
+# includes the same deep tree of framework headers, configures it with
+# compiler-generated dependencies disabled, and runs the dependency
+# scanning step of every target the way the build does.
+#
+# Invoke in script mode with the directory to work in, optionally
+# defining these variables:
+# HEADERS - number of framework headers (default 3000)
+# TARGETS - number of targets (default 20)
+# SOURCES - number of sources per target (default 10)
+#
+#   cmake -DBENCHMARK_DIR=/tmp/scan \
+#         -P Utilities/Scripts/benchmark-include-scan.cmake
+#
+# The first pass starts without any include caches, as in a new build
+# tree.  The second pass scans again with the caches written by the
+# first pass, as after a header of every target changed.  Compare the
+# reported wall-clock times between two builds of CMake.
+
+if(NOT BENCHMARK_DIR)
+  message(FATAL_ERROR "Define BENCHMARK_DIR to the directory to work in.")
+endif()
+if(NOT DEFINED HEADERS)
+  set(HEADERS 3000)
+endif()
+if(NOT DEFINED TARGETS)
+  set(TARGETS 20)
+endif()
+if(NOT DEFINED SOURCES)
+  set(SOURCES 10)
+endif()
+
+set(src "${BENCHMARK_DIR}/src")
+set(bin "${BENCHMARK_DIR}/build")
+file(REMOVE_RECURSE "${BENCHMARK_DIR}")
+
+# The headers form a tree of fan-out 4 below a single framework header.
+# Each also has some lines that are not include directives.
+set(body "")
+foreach(i RANGE 40)
+  string(APPEND body "int declaration_${i}(int value); /* # x */\n")
+endforeach()
+math(EXPR last "${HEADERS} - 1")
+foreach(i RANGE ${last})
+  set(content "#ifndef H_${i}\n#define H_${i}\n")
+  foreach(k RANGE 1 4)
+    math(EXPR child "${i} * 4 + ${k}")
+    if(child LESS HEADERS)
+      string(APPEND content "#include \"h${child}.h\"\n")
+    endif()
+  endforeach()
+  string(APPEND content "#include <stddef.h>\n${body}#endif\n")
+  file(WRITE "${src}/include/framework/h${i}.h" "${content}")
+endforeach()
+
+set(lists "cmake_minimum_required(VERSION 3.10)\nproject(ScanBenchmark C)\n")
+string(APPEND lists "include_directories(include/framework)\n")
+foreach(t RANGE 1 ${TARGETS})
+  set(target_sources "")
+  foreach(s RANGE 1 ${SOURCES})
+    file(WRITE "${src}/t${t}/s${s}.c"
+      "#include \"h0.h\"\nint s${t}_${s}(void) { return 0; }\n")
+    string(APPEND target_sources " t${t}/s${s}.c")
+  endforeach()
+  string(APPEND lists "add_library(t${t} STATIC${target_sources})\n")
+endforeach()
+file(WRITE "${src}/CMakeLists.txt" "${lists}")
+
+execute_process(
+  COMMAND ${CMAKE_COMMAND} -S ${src} -B ${bin} -G "Unix Makefiles"
+          -DCMAKE_DEPENDS_USE_COMPILER=OFF
+  OUTPUT_QUIET
+  RESULT_VARIABLE result
+  )
+if(result)
+  message(FATAL_ERROR "Configuring the benchmark project failed.")
+endif()
+
+function(scan_all pass)
+  foreach(t RANGE 1 ${TARGETS})
+    file(REMOVE
+      "${bin}/CMakeFiles/t${t}.dir/depend.internal"
+      "${bin}/CMakeFiles/t${t}.dir/depend.make"
+      )
+  endforeach()
+  string(TIMESTAMP start "%s%f")
+  foreach(t RANGE 1 ${TARGETS})
+    execute_process(
+      COMMAND ${CMAKE_COMMAND} -E cmake_depends "Unix Makefiles"
+              ${src} ${src} ${bin} ${bin}
+              ${bin}/CMakeFiles/t${t}.dir/DependInfo.cmake
+      WORKING_DIRECTORY ${bin}
+      OUTPUT_QUIET
+      RESULT_VARIABLE result
+      )
+    if(result)
+      message(FATAL_ERROR "Scanning dependencies of t${t} failed.")
+    endif()
+  endforeach()
+  string(TIMESTAMP stop "%s%f")
+  math(EXPR elapsed_ms "(${stop} - ${start}) / 1000")
+  message(STATUS "${pass}: ${elapsed_ms} ms")
+endfunction()
+
+math(EXPR files "${TARGETS} * ${SOURCES}")
+message(STATUS
+  "Scanning ${files} sources of ${TARGETS} targets with ${HEADERS} headers")
+scan_all("Without include caches")
+scan_all("With include caches")
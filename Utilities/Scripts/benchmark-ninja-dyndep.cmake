@@ -0,0 +1,125 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file LICENSE.rst or https://cmake.org/licensing for details.
+
+# Measure the C++ module dyndep collation steps of the Ninja generators.
+# The script synthesizes the scanner results of a chain of targets in
+# which every target links to the one before it and every module imports
+# a module of the previous target.  As in generated build systems, the
+# step of every target reads the module information of all targets below
+# it.  The script then runs the cmake_ninja_dyndep step of every target
+# in dependency order the way the build does.
+#
+# Invoke in script mode with the directory to work in, optionally
+# defining these variables:
+# DEPTH   - number of targets in the chain (default 50)
+# MODULES - number of modules per target (default 20)
+#
+#   cmake -DBENCHMARK_DIR=/tmp/dyndep \
+#         -P Utilities/Scripts/benchmark-ninja-dyndep.cmake
+#
+# The first pass starts from an empty build tree.  The second pass runs
+# all steps again on unchanged inputs, as after regenerating the build
+# system.  Compare the reported wall-clock times between two builds of
+# CMake.
+
+if(NOT BENCHMARK_DIR)
+  message(FATAL_ERROR "Define BENCHMARK_DIR to the directory to work in.")
+endif()
+if(NOT DEFINED DEPTH)
+  set(DEPTH 50)
+endif()
+if(NOT DEFINED MODULES)
+  set(MODULES 20)
+endif()
+
+set(src "${BENCHMARK_DIR}/src")
+set(bin "${BENCHMARK_DIR}/build")
+file(REMOVE_RECURSE "${BENCHMARK_DIR}")
+file(MAKE_DIRECTORY "${src}")
+
+math(EXPR last_module "${MODULES} - 1")
+foreach(t RANGE 1 ${DEPTH})
+  set(dir "${bin}/CMakeFiles/t${t}.dir")
+  math(EXPR prev "${t} - 1")
+  set(ddis "")
+  set(cxx_modules "")
+  foreach(m RANGE ${last_module})
+    set(requires "")
+    if(prev)
+      set(requires "{\"logical-name\": \"t${prev}_m${m}\"}")
+    endif()
+    file(WRITE "${dir}/m${m}.cxx.o.ddi" "{
+  \"revision\": 0,
+  \"version\": 1,
+  \"rules\": [
+    {
+      \"primary-output\": \"${dir}/m${m}.cxx.o\",
+      \"provides\": [
+        {\"logical-name\": \"t${t}_m${m}\", \"is-interface\": true}
+      ],
+      \"requires\": [${requires}]
+    }
+  ]
+}
+")
+    list(APPEND ddis "${dir}/m${m}.cxx.o.ddi")
+    if(m)
+      string(APPEND cxx_modules ",")
+    endif()
+    string(APPEND cxx_modules "
+    \"${dir}/m${m}.cxx.o\": {
+      \"name\": \"CXX_MODULES\",
+      \"type\": \"CXX_MODULES\",
+      \"visibility\": \"PUBLIC\",
+      \"source\": \"${src}/t${t}/m${m}.cxx\"
+    }")
+  endforeach()
+  set(linked "")
+  if(prev)
+    foreach(l RANGE 1 ${prev})
+      if(l GREATER 1)
+        string(APPEND linked ", ")
+      endif()
+      string(APPEND linked "\"${bin}/CMakeFiles/t${l}.dir\"")
+    endforeach()
+  endif()
+  file(WRITE "${dir}/CXXDependInfo.json" "{
+  \"dir-cur-bld\": \"${bin}\",
+  \"dir-cur-src\": \"${src}\",
+  \"dir-top-bld\": \"${bin}\",
+  \"dir-top-src\": \"${src}\",
+  \"module-dir\": \"${dir}\",
+  \"linked-target-dirs\": [${linked}],
+  \"forward-modules-from-target-dirs\": [],
+  \"exports\": [],
+  \"cxx-modules\": {${cxx_modules}
+  }
+}
+")
+  set(ddis_${t} "${ddis}")
+endforeach()
+
+function(collate_all pass)
+  string(TIMESTAMP start "%s%f")
+  foreach(t RANGE 1 ${DEPTH})
+    set(dir "${bin}/CMakeFiles/t${t}.dir")
+    execute_process(
+      COMMAND ${CMAKE_COMMAND} -E cmake_ninja_dyndep
+              --tdi=${dir}/CXXDependInfo.json --lang=CXX --modmapfmt=gcc
+              --dd=${dir}/CXX.dd ${ddis_${t}}
+      WORKING_DIRECTORY ${bin}
+      RESULT_VARIABLE result
+      )
+    if(result)
+      message(FATAL_ERROR "Collating the dependencies of t${t} failed.")
+    endif()
+  endforeach()
+  string(TIMESTAMP stop "%s%f")
+  math(EXPR elapsed_ms "(${stop} - ${start}) / 1000")
+  message(STATUS "${pass}: ${elapsed_ms} ms")
+endfunction()
+
+message(STATUS
+  "Collating ${DEPTH} targets in a chain with ${MODULES} modules each")
+collate_all("Fresh build tree")
+collate_all("Unchanged inputs")
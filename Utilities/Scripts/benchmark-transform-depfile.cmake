@@ -0,0 +1,88 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file LICENSE.rst or https://cmake.org/licensing for details.
+
+# Measure the throughput of the depfile transformation that custom
+# commands with a DEPFILE run after every invocation.  The script writes
+# a compiler depfile listing many files spread over the source and build
+# trees, then transforms it repeatedly the way the build does and reports
+# the amount of depfile processed per second.
+#
+# Invoke in script mode with the directory to work in, optionally
+# defining these variables:
+# ENTRIES    - number of dependencies in the depfile (default 20000)
+# DIRS       - number of directories they are spread over (default 200)
+# ITERATIONS - number of transformations to time (default 10)
+# FORMAT     - gccdepfile or makedepfile (default gccdepfile)
+#
+#   cmake -DBENCHMARK_DIR=/tmp/depfile \
+#         -P Utilities/Scripts/benchmark-transform-depfile.cmake
+#
+# Compare the reported throughput between two builds of CMake.
+
+if(NOT BENCHMARK_DIR)
+  message(FATAL_ERROR "Define BENCHMARK_DIR to the directory to work in.")
+endif()
+if(NOT DEFINED ENTRIES)
+  set(ENTRIES 20000)
+endif()
+if(NOT DEFINED DIRS)
+  set(DIRS 200)
+endif()
+if(NOT DEFINED ITERATIONS)
+  set(ITERATIONS 10)
+endif()
+if(NOT DEFINED FORMAT)
+  set(FORMAT gccdepfile)
+endif()
+
+set(src "${BENCHMARK_DIR}/src")
+set(bin "${BENCHMARK_DIR}/build")
+file(REMOVE_RECURSE "${BENCHMARK_DIR}")
+file(MAKE_DIRECTORY "${src}" "${bin}/gen")
+
+# Most dependencies are absolute paths in the source and build trees, and
+# some are relative to the build directory as compilers write them for
+# generated headers.  A few need escaping.
+set(content "gen/output.cpp gen/output.h:")
+math(EXPR last "${ENTRIES} - 1")
+foreach(i RANGE ${last})
+  math(EXPR d "${i} % ${DIRS}")
+  math(EXPR kind "${i} % 10")
+  if(kind LESS 6)
+    set(path "${src}/lib${d}/include/header_${i}.h")
+  elseif(kind LESS 9)
+    set(path "${bin}/lib${d}/generated/header_${i}.h")
+  else()
+    set(path "gen/dir\\ ${d}/../dir${d}/header_${i}.h")
+  endif()
+  string(APPEND content " \\\n  ${path}")
+endforeach()
+string(APPEND content "\n")
+file(WRITE "${bin}/gen/output.d" "${content}")
+file(SIZE "${bin}/gen/output.d" size)
+
+string(TIMESTAMP start "%s%f")
+foreach(i RANGE 1 ${ITERATIONS})
+  execute_process(
+    COMMAND ${CMAKE_COMMAND} -E cmake_transform_depfile "Unix Makefiles"
+            ${FORMAT} ${src} ${src} ${bin} ${bin}
+            ${bin}/gen/output.d ${bin}/CMakeFiles/d/output.d
+    RESULT_VARIABLE result
+    )
+  if(result)
+    message(FATAL_ERROR "Transforming the depfile failed.")
+  endif()
+endforeach()
+string(TIMESTAMP stop "%s%f")
+
+math(EXPR elapsed_us "${stop} - ${start}")
+math(EXPR per_run_ms "${elapsed_us} / ${ITERATIONS} / 1000")
+# Bytes per microsecond are MB/s.  Keep two decimals.
+math(EXPR rate "${size} * ${ITERATIONS} * 100 / ${elapsed_us}")
+math(EXPR rate_int "${rate} / 100")
+math(EXPR rate_frac "${rate} % 100")
+if(rate_frac LESS 10)
+  set(rate_frac "0${rate_frac}")
+endif()
+message(STATUS "Transforming a ${size} byte depfile with ${ENTRIES} entries")
+message(STATUS "${per_run_ms} ms per run, ${rate_int}.${rate_frac} MB/s")
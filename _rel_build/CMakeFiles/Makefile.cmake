@@ -0,0 +1,415 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/Auxiliary/CMakeLists.txt"
+  "/root/repo/Auxiliary/bash-completion/CMakeLists.txt"
+  "/root/repo/CMakeCPack.cmake"
+  "/root/repo/CMakeCPackOptions.cmake.in"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/CTestCustom.cmake.in"
+  "/root/repo/CompileFlags.cmake"
+  "/root/repo/Modules/CMakePushCheckState.cmake"
+  "/root/repo/Source/CMakeCopyright.cmake"
+  "/root/repo/Source/CMakeInstallDestinations.cmake"
+  "/root/repo/Source/CMakeLists.txt"
+  "/root/repo/Source/CMakeSourceDir.txt.in"
+  "/root/repo/Source/CMakeVersion.cmake"
+  "/root/repo/Source/CPack/cmCPackConfigure.h.in"
+  "/root/repo/Source/Checks/cm_c11_thread_local.c"
+  "/root/repo/Source/Checks/cm_c11_thread_local.cmake"
+  "/root/repo/Source/Checks/cm_cxx17_check.cmake"
+  "/root/repo/Source/Checks/cm_cxx17_check.cpp"
+  "/root/repo/Source/Checks/cm_cxx_features.cmake"
+  "/root/repo/Source/Checks/cm_cxx_filesystem.cxx"
+  "/root/repo/Source/Checks/cm_cxx_make_unique.cxx"
+  "/root/repo/Source/Checks/cm_message_checks_compat.cmake"
+  "/root/repo/Source/Modules/CMakeBuildUtilities.cmake"
+  "/root/repo/Source/Modules/OverrideC.cmake"
+  "/root/repo/Source/Modules/OverrideCXX.cmake"
+  "/root/repo/Source/cmConfigure.cmake.h.in"
+  "/root/repo/Source/cmVersionConfig.h.in"
+  "/root/repo/Source/kwsys/Base64.h.in"
+  "/root/repo/Source/kwsys/CMakeLists.txt"
+  "/root/repo/Source/kwsys/CommandLineArguments.hxx.in"
+  "/root/repo/Source/kwsys/Configure.h.in"
+  "/root/repo/Source/kwsys/Configure.hxx.in"
+  "/root/repo/Source/kwsys/Directory.hxx.in"
+  "/root/repo/Source/kwsys/DynamicLoader.hxx.in"
+  "/root/repo/Source/kwsys/Encoding.h.in"
+  "/root/repo/Source/kwsys/Encoding.hxx.in"
+  "/root/repo/Source/kwsys/FStream.hxx.in"
+  "/root/repo/Source/kwsys/Glob.hxx.in"
+  "/root/repo/Source/kwsys/MD5.h.in"
+  "/root/repo/Source/kwsys/Process.h.in"
+  "/root/repo/Source/kwsys/RegularExpression.hxx.in"
+  "/root/repo/Source/kwsys/Status.hxx.in"
+  "/root/repo/Source/kwsys/String.h.in"
+  "/root/repo/Source/kwsys/System.h.in"
+  "/root/repo/Source/kwsys/SystemInformation.hxx.in"
+  "/root/repo/Source/kwsys/SystemTools.hxx.in"
+  "/root/repo/Source/kwsys/kwsysPlatformTests.cmake"
+  "/root/repo/Source/kwsys/kwsysPlatformTestsC.c"
+  "/root/repo/Source/kwsys/kwsysPlatformTestsCXX.cxx"
+  "/root/repo/Tests/.NoDartCoverage"
+  "/root/repo/Tests/CMakeLists.txt"
+  "/root/repo/Tests/CheckFortran.cmake"
+  "/root/repo/Tests/CheckSwift.cmake"
+  "/root/repo/Tests/EnforceConfig.cmake.in"
+  "/root/repo/Utilities/CMakeLists.txt"
+  "/root/repo/Utilities/Doxygen/CMakeLists.txt"
+  "/root/repo/Utilities/KWIML/CMakeLists.txt"
+  "/root/repo/Utilities/Sphinx/CMakeLists.txt"
+  "/root/repo/Utilities/cmThirdParty.h.in"
+  "/root/repo/Utilities/cmThirdPartyChecks.cmake"
+  "/root/repo/Utilities/cmbzip2/CMakeLists.txt"
+  "/root/repo/Utilities/cmcppdap/CMakeLists.txt"
+  "/root/repo/Utilities/cmcurl/CMake/CurlTests.c"
+  "/root/repo/Utilities/cmcurl/CMake/FindLibidn2.cmake"
+  "/root/repo/Utilities/cmcurl/CMake/FindNGHTTP2.cmake"
+  "/root/repo/Utilities/cmcurl/CMake/Macros.cmake"
+  "/root/repo/Utilities/cmcurl/CMake/OtherTests.cmake"
+  "/root/repo/Utilities/cmcurl/CMake/Utilities.cmake"
+  "/root/repo/Utilities/cmcurl/CMakeLists.txt"
+  "/root/repo/Utilities/cmcurl/lib/CMakeLists.txt"
+  "/root/repo/Utilities/cmcurl/lib/Makefile.inc"
+  "/root/repo/Utilities/cmcurl/lib/curl_config-cmake.h.in"
+  "/root/repo/Utilities/cmexpat/CMakeLists.txt"
+  "/root/repo/Utilities/cmexpat/ConfigureChecks.cmake"
+  "/root/repo/Utilities/cmexpat/expat_config.h.cmake"
+  "/root/repo/Utilities/cmjsoncpp/CMakeLists.txt"
+  "/root/repo/Utilities/cmlibarchive/CMakeLists.txt"
+  "/root/repo/Utilities/cmlibarchive/build/cmake/CheckFileOffsetBits.c"
+  "/root/repo/Utilities/cmlibarchive/build/cmake/CheckFileOffsetBits.cmake"
+  "/root/repo/Utilities/cmlibarchive/build/cmake/CheckFuncs.cmake"
+  "/root/repo/Utilities/cmlibarchive/build/cmake/CheckFuncs_stub.c.in"
+  "/root/repo/Utilities/cmlibarchive/build/cmake/CheckHeaderDirent.cmake"
+  "/root/repo/Utilities/cmlibarchive/build/cmake/CheckTypeExists.cmake"
+  "/root/repo/Utilities/cmlibarchive/build/cmake/config.h.in"
+  "/root/repo/Utilities/cmlibarchive/libarchive/CMakeLists.txt"
+  "/root/repo/Utilities/cmliblzma/CMakeLists.txt"
+  "/root/repo/Utilities/cmliblzma/config.h.in"
+  "/root/repo/Utilities/cmlibrhash/CMakeLists.txt"
+  "/root/repo/Utilities/cmlibuv/CMakeLists.txt"
+  "/root/repo/Utilities/cmllpkgc/CMakeLists.txt"
+  "/root/repo/Utilities/cmnghttp2/CMakeLists.txt"
+  "/root/repo/Utilities/cmnghttp2/cmakeconfig.h.in"
+  "/root/repo/Utilities/cmrapidhash/CMakeLists.txt"
+  "/root/repo/Utilities/cmzlib/CMakeLists.txt"
+  "/root/repo/Utilities/cmzstd/CMakeLists.txt"
+  "/root/repo/Utilities/std/CMakeLists.txt"
+  "/root/repo/Utilities/std/cmSTL.hxx.in"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "Tests/CMakeFiles/CheckFortran/result.cmake"
+  "Utilities/cmcurl/lib/Makefile.inc.cmake"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "/root/repo/cmake_uninstall.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompilerABI.c"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompilerABI.cpp"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCompilerIdDetection.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompileFeatures.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerABI.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerId.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitIncludeInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseLibraryArchitecture.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystem.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCompilerCommon.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeUnixFindMake.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackIFWConfigureFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckStructHasMember.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ADSP-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMCC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/AppleClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Borland-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Bruce-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompilerInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Comeau-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Cray-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Embarcadero-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Fujitsu-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/FujitsuClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GHS-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-FindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IAR-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-C-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-CXX-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Intel-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IntelLLVM-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/MSVC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVHPC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVIDIA-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/OpenWatcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PGI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PathScale-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SCO-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SDCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Tasking-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TinyCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Watcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBZip2.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLibLZMA.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenSSL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/FeatureTesting.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-Determine-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/TestBigEndian.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "Utilities/cmThirdParty.h"
+  "Utilities/cmSTL.hxx"
+  "cmake_uninstall.cmake"
+  "CMakeCPackOptions.cmake"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "Tests/.NoDartCoverage"
+  "CTestCustom.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/cmsys/Directory.hxx"
+  "Source/cmsys/DynamicLoader.hxx"
+  "Source/cmsys/Encoding.hxx"
+  "Source/cmsys/Glob.hxx"
+  "Source/cmsys/RegularExpression.hxx"
+  "Source/cmsys/SystemTools.hxx"
+  "Source/cmsys/CommandLineArguments.hxx"
+  "Source/cmsys/FStream.hxx"
+  "Source/cmsys/SystemInformation.hxx"
+  "Source/cmsys/Status.hxx"
+  "Source/cmsys/Configure.h"
+  "Source/cmsys/Process.h"
+  "Source/cmsys/Base64.h"
+  "Source/cmsys/Encoding.h"
+  "Source/cmsys/MD5.h"
+  "Source/cmsys/System.h"
+  "Source/cmsys/String.h"
+  "Source/cmsys/Configure.hxx"
+  "Source/kwsys/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/std/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/KWIML/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/cmlibrhash/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/cmrapidhash/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/cmzlib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/cmcurl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/cmcurl/lib/curl_config.h"
+  "Utilities/cmcurl/lib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/cmnghttp2/config.h"
+  "Utilities/cmnghttp2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/cmexpat/expat_config.h"
+  "Utilities/cmexpat/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/cmbzip2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/cmzstd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/cmliblzma/config.h"
+  "Utilities/cmliblzma/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/cmake.tmp/CheckFuncs_stub.c"
+  "Utilities/cmlibarchive/config.h"
+  "Utilities/cmlibarchive/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/cmlibarchive/libarchive/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/cmjsoncpp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/cmlibuv/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/cmcppdap/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/cmllpkgc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/cmConfigure.h"
+  "Source/cmVersionConfig.h"
+  "CMakeFiles/CMakeSourceDir.txt"
+  "Source/CPack/cmCPackConfigure.h"
+  "Source/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/Doxygen/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/Sphinx/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/EnforceConfig.cmake"
+  "Tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Auxiliary/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Auxiliary/bash-completion/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "Source/kwsys/CMakeFiles/cmsys.dir/DependInfo.cmake"
+  "Source/kwsys/CMakeFiles/cmsys_c.dir/DependInfo.cmake"
+  "Utilities/std/CMakeFiles/cmstd.dir/DependInfo.cmake"
+  "Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/DependInfo.cmake"
+  "Utilities/cmzlib/CMakeFiles/cmzlib.dir/DependInfo.cmake"
+  "Utilities/cmcurl/CMakeFiles/curltest.dir/DependInfo.cmake"
+  "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/DependInfo.cmake"
+  "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/DependInfo.cmake"
+  "Utilities/cmexpat/CMakeFiles/cmexpat.dir/DependInfo.cmake"
+  "Utilities/cmbzip2/CMakeFiles/cmbzip2.dir/DependInfo.cmake"
+  "Utilities/cmzstd/CMakeFiles/cmzstd.dir/DependInfo.cmake"
+  "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/DependInfo.cmake"
+  "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/DependInfo.cmake"
+  "Utilities/cmjsoncpp/CMakeFiles/cmjsoncpp.dir/DependInfo.cmake"
+  "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/DependInfo.cmake"
+  "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/DependInfo.cmake"
+  "Utilities/cmllpkgc/CMakeFiles/cmllpkgc.dir/DependInfo.cmake"
+  "Source/CMakeFiles/CMakeLib.dir/DependInfo.cmake"
+  "Source/CMakeFiles/CTestLib.dir/DependInfo.cmake"
+  "Source/CMakeFiles/CPackLib.dir/DependInfo.cmake"
+  "Source/CMakeFiles/cmake.dir/DependInfo.cmake"
+  "Source/CMakeFiles/cmcmdhelper.dir/DependInfo.cmake"
+  "Source/CMakeFiles/ctest.dir/DependInfo.cmake"
+  "Source/CMakeFiles/cpack.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,454 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/LexerParser/cmListFileLexer.c" "Source/CMakeFiles/CMakeLib.dir/LexerParser/cmListFileLexer.c.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/LexerParser/cmListFileLexer.c.o.d"
+  "/root/repo/Source/cm_parse_date.c" "Source/CMakeFiles/CMakeLib.dir/cm_parse_date.c.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cm_parse_date.c.o.d"
+  "/root/repo/Source/cm_utf8.c" "Source/CMakeFiles/CMakeLib.dir/cm_utf8.c.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cm_utf8.c.o.d"
+  "/root/repo/Source/LexerParser/cmDependsJavaLexer.cxx" "Source/CMakeFiles/CMakeLib.dir/LexerParser/cmDependsJavaLexer.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/LexerParser/cmDependsJavaLexer.cxx.o.d"
+  "/root/repo/Source/LexerParser/cmDependsJavaParser.cxx" "Source/CMakeFiles/CMakeLib.dir/LexerParser/cmDependsJavaParser.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/LexerParser/cmDependsJavaParser.cxx.o.d"
+  "/root/repo/Source/LexerParser/cmExprLexer.cxx" "Source/CMakeFiles/CMakeLib.dir/LexerParser/cmExprLexer.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/LexerParser/cmExprLexer.cxx.o.d"
+  "/root/repo/Source/LexerParser/cmExprParser.cxx" "Source/CMakeFiles/CMakeLib.dir/LexerParser/cmExprParser.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/LexerParser/cmExprParser.cxx.o.d"
+  "/root/repo/Source/LexerParser/cmFortranLexer.cxx" "Source/CMakeFiles/CMakeLib.dir/LexerParser/cmFortranLexer.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/LexerParser/cmFortranLexer.cxx.o.d"
+  "/root/repo/Source/LexerParser/cmFortranParser.cxx" "Source/CMakeFiles/CMakeLib.dir/LexerParser/cmFortranParser.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/LexerParser/cmFortranParser.cxx.o.d"
+  "/root/repo/Source/bindexplib.cxx" "Source/CMakeFiles/CMakeLib.dir/bindexplib.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/bindexplib.cxx.o.d"
+  "/root/repo/Source/cmAddCompileDefinitionsCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmAddCompileDefinitionsCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmAddCompileDefinitionsCommand.cxx.o.d"
+  "/root/repo/Source/cmAddCompileOptionsCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmAddCompileOptionsCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmAddCompileOptionsCommand.cxx.o.d"
+  "/root/repo/Source/cmAddCustomCommandCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmAddCustomCommandCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmAddCustomCommandCommand.cxx.o.d"
+  "/root/repo/Source/cmAddCustomTargetCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmAddCustomTargetCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmAddCustomTargetCommand.cxx.o.d"
+  "/root/repo/Source/cmAddDefinitionsCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmAddDefinitionsCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmAddDefinitionsCommand.cxx.o.d"
+  "/root/repo/Source/cmAddDependenciesCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmAddDependenciesCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmAddDependenciesCommand.cxx.o.d"
+  "/root/repo/Source/cmAddExecutableCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmAddExecutableCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmAddExecutableCommand.cxx.o.d"
+  "/root/repo/Source/cmAddLibraryCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmAddLibraryCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmAddLibraryCommand.cxx.o.d"
+  "/root/repo/Source/cmAddLinkOptionsCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmAddLinkOptionsCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmAddLinkOptionsCommand.cxx.o.d"
+  "/root/repo/Source/cmAddSubDirectoryCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmAddSubDirectoryCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmAddSubDirectoryCommand.cxx.o.d"
+  "/root/repo/Source/cmAddTestCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmAddTestCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmAddTestCommand.cxx.o.d"
+  "/root/repo/Source/cmAffinity.cxx" "Source/CMakeFiles/CMakeLib.dir/cmAffinity.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmAffinity.cxx.o.d"
+  "/root/repo/Source/cmArchiveWrite.cxx" "Source/CMakeFiles/CMakeLib.dir/cmArchiveWrite.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmArchiveWrite.cxx.o.d"
+  "/root/repo/Source/cmArgumentParser.cxx" "Source/CMakeFiles/CMakeLib.dir/cmArgumentParser.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmArgumentParser.cxx.o.d"
+  "/root/repo/Source/cmAuxSourceDirectoryCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmAuxSourceDirectoryCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmAuxSourceDirectoryCommand.cxx.o.d"
+  "/root/repo/Source/cmBase32.cxx" "Source/CMakeFiles/CMakeLib.dir/cmBase32.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmBase32.cxx.o.d"
+  "/root/repo/Source/cmBinUtilsLinker.cxx" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsLinker.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsLinker.cxx.o.d"
+  "/root/repo/Source/cmBinUtilsLinuxELFGetRuntimeDependenciesTool.cxx" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsLinuxELFGetRuntimeDependenciesTool.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsLinuxELFGetRuntimeDependenciesTool.cxx.o.d"
+  "/root/repo/Source/cmBinUtilsLinuxELFLinker.cxx" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsLinuxELFLinker.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsLinuxELFLinker.cxx.o.d"
+  "/root/repo/Source/cmBinUtilsLinuxELFObjdumpGetRuntimeDependenciesTool.cxx" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsLinuxELFObjdumpGetRuntimeDependenciesTool.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsLinuxELFObjdumpGetRuntimeDependenciesTool.cxx.o.d"
+  "/root/repo/Source/cmBinUtilsMacOSMachOGetRuntimeDependenciesTool.cxx" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsMacOSMachOGetRuntimeDependenciesTool.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsMacOSMachOGetRuntimeDependenciesTool.cxx.o.d"
+  "/root/repo/Source/cmBinUtilsMacOSMachOLinker.cxx" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsMacOSMachOLinker.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsMacOSMachOLinker.cxx.o.d"
+  "/root/repo/Source/cmBinUtilsMacOSMachOOToolGetRuntimeDependenciesTool.cxx" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsMacOSMachOOToolGetRuntimeDependenciesTool.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsMacOSMachOOToolGetRuntimeDependenciesTool.cxx.o.d"
+  "/root/repo/Source/cmBinUtilsWindowsPEDumpbinGetRuntimeDependenciesTool.cxx" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsWindowsPEDumpbinGetRuntimeDependenciesTool.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsWindowsPEDumpbinGetRuntimeDependenciesTool.cxx.o.d"
+  "/root/repo/Source/cmBinUtilsWindowsPEGetRuntimeDependenciesTool.cxx" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsWindowsPEGetRuntimeDependenciesTool.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsWindowsPEGetRuntimeDependenciesTool.cxx.o.d"
+  "/root/repo/Source/cmBinUtilsWindowsPELinker.cxx" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsWindowsPELinker.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsWindowsPELinker.cxx.o.d"
+  "/root/repo/Source/cmBinUtilsWindowsPEObjdumpGetRuntimeDependenciesTool.cxx" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsWindowsPEObjdumpGetRuntimeDependenciesTool.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmBinUtilsWindowsPEObjdumpGetRuntimeDependenciesTool.cxx.o.d"
+  "/root/repo/Source/cmBlockCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmBlockCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmBlockCommand.cxx.o.d"
+  "/root/repo/Source/cmBreakCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmBreakCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmBreakCommand.cxx.o.d"
+  "/root/repo/Source/cmBuildCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmBuildCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmBuildCommand.cxx.o.d"
+  "/root/repo/Source/cmBuildDatabase.cxx" "Source/CMakeFiles/CMakeLib.dir/cmBuildDatabase.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmBuildDatabase.cxx.o.d"
+  "/root/repo/Source/cmBuildSbomBuilder.cxx" "Source/CMakeFiles/CMakeLib.dir/cmBuildSbomBuilder.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmBuildSbomBuilder.cxx.o.d"
+  "/root/repo/Source/cmBuildSbomGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmBuildSbomGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmBuildSbomGenerator.cxx.o.d"
+  "/root/repo/Source/cmCLocaleEnvironmentScope.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCLocaleEnvironmentScope.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCLocaleEnvironmentScope.cxx.o.d"
+  "/root/repo/Source/cmCMakeDiagnosticCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCMakeDiagnosticCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCMakeDiagnosticCommand.cxx.o.d"
+  "/root/repo/Source/cmCMakeHostSystemInformationCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCMakeHostSystemInformationCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCMakeHostSystemInformationCommand.cxx.o.d"
+  "/root/repo/Source/cmCMakeLanguageCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCMakeLanguageCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCMakeLanguageCommand.cxx.o.d"
+  "/root/repo/Source/cmCMakeMinimumRequired.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCMakeMinimumRequired.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCMakeMinimumRequired.cxx.o.d"
+  "/root/repo/Source/cmCMakePath.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCMakePath.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCMakePath.cxx.o.d"
+  "/root/repo/Source/cmCMakePathCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCMakePathCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCMakePathCommand.cxx.o.d"
+  "/root/repo/Source/cmCMakePkgConfigCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCMakePkgConfigCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCMakePkgConfigCommand.cxx.o.d"
+  "/root/repo/Source/cmCMakePolicyCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCMakePolicyCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCMakePolicyCommand.cxx.o.d"
+  "/root/repo/Source/cmCMakePresetsErrors.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCMakePresetsErrors.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCMakePresetsErrors.cxx.o.d"
+  "/root/repo/Source/cmCMakePresetsGraph.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCMakePresetsGraph.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCMakePresetsGraph.cxx.o.d"
+  "/root/repo/Source/cmCMakePresetsGraphReadJSON.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSON.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSON.cxx.o.d"
+  "/root/repo/Source/cmCMakePresetsGraphReadJSONBuildPresets.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSONBuildPresets.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSONBuildPresets.cxx.o.d"
+  "/root/repo/Source/cmCMakePresetsGraphReadJSONConfigurePresets.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSONConfigurePresets.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSONConfigurePresets.cxx.o.d"
+  "/root/repo/Source/cmCMakePresetsGraphReadJSONPackagePresets.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSONPackagePresets.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSONPackagePresets.cxx.o.d"
+  "/root/repo/Source/cmCMakePresetsGraphReadJSONTestPresets.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSONTestPresets.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSONTestPresets.cxx.o.d"
+  "/root/repo/Source/cmCMakePresetsGraphReadJSONWorkflowPresets.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSONWorkflowPresets.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSONWorkflowPresets.cxx.o.d"
+  "/root/repo/Source/cmCMakePresetsGraphResolve.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphResolve.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphResolve.cxx.o.d"
+  "/root/repo/Source/cmCMakeSarifLogger.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCMakeSarifLogger.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCMakeSarifLogger.cxx.o.d"
+  "/root/repo/Source/cmCMakeString.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCMakeString.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCMakeString.cxx.o.d"
+  "/root/repo/Source/cmCPackPropertiesGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCPackPropertiesGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCPackPropertiesGenerator.cxx.o.d"
+  "/root/repo/Source/cmCacheDocumentationTable.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCacheDocumentationTable.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCacheDocumentationTable.cxx.o.d"
+  "/root/repo/Source/cmCacheManager.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCacheManager.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCacheManager.cxx.o.d"
+  "/root/repo/Source/cmCachePatternTable.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCachePatternTable.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCachePatternTable.cxx.o.d"
+  "/root/repo/Source/cmCommands.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCommands.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCommands.cxx.o.d"
+  "/root/repo/Source/cmCommonTargetGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCommonTargetGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCommonTargetGenerator.cxx.o.d"
+  "/root/repo/Source/cmCompiledArgument.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCompiledArgument.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCompiledArgument.cxx.o.d"
+  "/root/repo/Source/cmComputeComponentGraph.cxx" "Source/CMakeFiles/CMakeLib.dir/cmComputeComponentGraph.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmComputeComponentGraph.cxx.o.d"
+  "/root/repo/Source/cmComputeLinkDepends.cxx" "Source/CMakeFiles/CMakeLib.dir/cmComputeLinkDepends.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmComputeLinkDepends.cxx.o.d"
+  "/root/repo/Source/cmComputeLinkInformation.cxx" "Source/CMakeFiles/CMakeLib.dir/cmComputeLinkInformation.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmComputeLinkInformation.cxx.o.d"
+  "/root/repo/Source/cmComputeTargetDepends.cxx" "Source/CMakeFiles/CMakeLib.dir/cmComputeTargetDepends.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmComputeTargetDepends.cxx.o.d"
+  "/root/repo/Source/cmConditionEvaluator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmConditionEvaluator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmConditionEvaluator.cxx.o.d"
+  "/root/repo/Source/cmConfigureFileCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmConfigureFileCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmConfigureFileCommand.cxx.o.d"
+  "/root/repo/Source/cmConfigureLog.cxx" "Source/CMakeFiles/CMakeLib.dir/cmConfigureLog.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmConfigureLog.cxx.o.d"
+  "/root/repo/Source/cmContinueCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmContinueCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmContinueCommand.cxx.o.d"
+  "/root/repo/Source/cmCoreTryCompile.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCoreTryCompile.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCoreTryCompile.cxx.o.d"
+  "/root/repo/Source/cmCreateTestSourceList.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCreateTestSourceList.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCreateTestSourceList.cxx.o.d"
+  "/root/repo/Source/cmCryptoHash.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCryptoHash.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCryptoHash.cxx.o.d"
+  "/root/repo/Source/cmCurl.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCurl.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCurl.cxx.o.d"
+  "/root/repo/Source/cmCustomCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCustomCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCustomCommand.cxx.o.d"
+  "/root/repo/Source/cmCustomCommandGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCustomCommandGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCustomCommandGenerator.cxx.o.d"
+  "/root/repo/Source/cmCustomCommandLines.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCustomCommandLines.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCustomCommandLines.cxx.o.d"
+  "/root/repo/Source/cmCxxModuleMapper.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCxxModuleMapper.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCxxModuleMapper.cxx.o.d"
+  "/root/repo/Source/cmCxxModuleMetadata.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCxxModuleMetadata.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCxxModuleMetadata.cxx.o.d"
+  "/root/repo/Source/cmCxxModuleUsageEffects.cxx" "Source/CMakeFiles/CMakeLib.dir/cmCxxModuleUsageEffects.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmCxxModuleUsageEffects.cxx.o.d"
+  "/root/repo/Source/cmDebuggerAdapter.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerAdapter.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerAdapter.cxx.o.d"
+  "/root/repo/Source/cmDebuggerBreakpointManager.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerBreakpointManager.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerBreakpointManager.cxx.o.d"
+  "/root/repo/Source/cmDebuggerExceptionManager.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerExceptionManager.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerExceptionManager.cxx.o.d"
+  "/root/repo/Source/cmDebuggerPosixPipeConnection.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerPosixPipeConnection.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerPosixPipeConnection.cxx.o.d"
+  "/root/repo/Source/cmDebuggerProtocol.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerProtocol.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerProtocol.cxx.o.d"
+  "/root/repo/Source/cmDebuggerSourceBreakpoint.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerSourceBreakpoint.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerSourceBreakpoint.cxx.o.d"
+  "/root/repo/Source/cmDebuggerStackFrame.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerStackFrame.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerStackFrame.cxx.o.d"
+  "/root/repo/Source/cmDebuggerThread.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerThread.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerThread.cxx.o.d"
+  "/root/repo/Source/cmDebuggerThreadManager.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerThreadManager.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerThreadManager.cxx.o.d"
+  "/root/repo/Source/cmDebuggerVariables.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerVariables.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerVariables.cxx.o.d"
+  "/root/repo/Source/cmDebuggerVariablesHelper.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerVariablesHelper.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerVariablesHelper.cxx.o.d"
+  "/root/repo/Source/cmDebuggerVariablesManager.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerVariablesManager.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDebuggerVariablesManager.cxx.o.d"
+  "/root/repo/Source/cmDefinePropertyCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDefinePropertyCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDefinePropertyCommand.cxx.o.d"
+  "/root/repo/Source/cmDefinitions.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDefinitions.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDefinitions.cxx.o.d"
+  "/root/repo/Source/cmDepends.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDepends.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDepends.cxx.o.d"
+  "/root/repo/Source/cmDependsC.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDependsC.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDependsC.cxx.o.d"
+  "/root/repo/Source/cmDependsCompiler.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDependsCompiler.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDependsCompiler.cxx.o.d"
+  "/root/repo/Source/cmDependsFortran.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDependsFortran.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDependsFortran.cxx.o.d"
+  "/root/repo/Source/cmDependsJava.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDependsJava.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDependsJava.cxx.o.d"
+  "/root/repo/Source/cmDependsJavaParserHelper.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDependsJavaParserHelper.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDependsJavaParserHelper.cxx.o.d"
+  "/root/repo/Source/cmDiagnosticContext.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDiagnosticContext.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDiagnosticContext.cxx.o.d"
+  "/root/repo/Source/cmDiagnostics.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDiagnostics.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDiagnostics.cxx.o.d"
+  "/root/repo/Source/cmDiscoverTestsCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDiscoverTestsCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDiscoverTestsCommand.cxx.o.d"
+  "/root/repo/Source/cmDocumentation.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDocumentation.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDocumentation.cxx.o.d"
+  "/root/repo/Source/cmDocumentationFormatter.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDocumentationFormatter.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDocumentationFormatter.cxx.o.d"
+  "/root/repo/Source/cmDuration.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDuration.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDuration.cxx.o.d"
+  "/root/repo/Source/cmDyndepCache.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDyndepCache.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDyndepCache.cxx.o.d"
+  "/root/repo/Source/cmDyndepCollation.cxx" "Source/CMakeFiles/CMakeLib.dir/cmDyndepCollation.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmDyndepCollation.cxx.o.d"
+  "/root/repo/Source/cmELF.cxx" "Source/CMakeFiles/CMakeLib.dir/cmELF.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmELF.cxx.o.d"
+  "/root/repo/Source/cmEnableLanguageCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmEnableLanguageCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmEnableLanguageCommand.cxx.o.d"
+  "/root/repo/Source/cmEnableTestingCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmEnableTestingCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmEnableTestingCommand.cxx.o.d"
+  "/root/repo/Source/cmEnvironment.cxx" "Source/CMakeFiles/CMakeLib.dir/cmEnvironment.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmEnvironment.cxx.o.d"
+  "/root/repo/Source/cmEvaluatedTargetProperty.cxx" "Source/CMakeFiles/CMakeLib.dir/cmEvaluatedTargetProperty.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmEvaluatedTargetProperty.cxx.o.d"
+  "/root/repo/Source/cmExecProgramCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExecProgramCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExecProgramCommand.cxx.o.d"
+  "/root/repo/Source/cmExecuteProcessCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExecuteProcessCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExecuteProcessCommand.cxx.o.d"
+  "/root/repo/Source/cmExpandedCommandArgument.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExpandedCommandArgument.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExpandedCommandArgument.cxx.o.d"
+  "/root/repo/Source/cmExperimental.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExperimental.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExperimental.cxx.o.d"
+  "/root/repo/Source/cmExportAndroidMKGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExportAndroidMKGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExportAndroidMKGenerator.cxx.o.d"
+  "/root/repo/Source/cmExportBuildAndroidMKGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExportBuildAndroidMKGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExportBuildAndroidMKGenerator.cxx.o.d"
+  "/root/repo/Source/cmExportBuildCMakeConfigGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExportBuildCMakeConfigGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExportBuildCMakeConfigGenerator.cxx.o.d"
+  "/root/repo/Source/cmExportBuildFileGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExportBuildFileGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExportBuildFileGenerator.cxx.o.d"
+  "/root/repo/Source/cmExportBuildPackageInfoGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExportBuildPackageInfoGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExportBuildPackageInfoGenerator.cxx.o.d"
+  "/root/repo/Source/cmExportCMakeConfigGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExportCMakeConfigGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExportCMakeConfigGenerator.cxx.o.d"
+  "/root/repo/Source/cmExportCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExportCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExportCommand.cxx.o.d"
+  "/root/repo/Source/cmExportFileGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExportFileGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExportFileGenerator.cxx.o.d"
+  "/root/repo/Source/cmExportInstallAndroidMKGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExportInstallAndroidMKGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExportInstallAndroidMKGenerator.cxx.o.d"
+  "/root/repo/Source/cmExportInstallCMakeConfigGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExportInstallCMakeConfigGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExportInstallCMakeConfigGenerator.cxx.o.d"
+  "/root/repo/Source/cmExportInstallFileGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExportInstallFileGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExportInstallFileGenerator.cxx.o.d"
+  "/root/repo/Source/cmExportInstallPackageInfoGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExportInstallPackageInfoGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExportInstallPackageInfoGenerator.cxx.o.d"
+  "/root/repo/Source/cmExportPackageInfoGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExportPackageInfoGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExportPackageInfoGenerator.cxx.o.d"
+  "/root/repo/Source/cmExportSet.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExportSet.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExportSet.cxx.o.d"
+  "/root/repo/Source/cmExportTryCompileFileGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExportTryCompileFileGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExportTryCompileFileGenerator.cxx.o.d"
+  "/root/repo/Source/cmExprParserHelper.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExprParserHelper.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExprParserHelper.cxx.o.d"
+  "/root/repo/Source/cmExternalMakefileProjectGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExternalMakefileProjectGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExternalMakefileProjectGenerator.cxx.o.d"
+  "/root/repo/Source/cmExtraCodeBlocksGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExtraCodeBlocksGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExtraCodeBlocksGenerator.cxx.o.d"
+  "/root/repo/Source/cmExtraCodeLiteGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExtraCodeLiteGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExtraCodeLiteGenerator.cxx.o.d"
+  "/root/repo/Source/cmExtraEclipseCDT4Generator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExtraEclipseCDT4Generator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExtraEclipseCDT4Generator.cxx.o.d"
+  "/root/repo/Source/cmExtraKateGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExtraKateGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExtraKateGenerator.cxx.o.d"
+  "/root/repo/Source/cmExtraSublimeTextGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmExtraSublimeTextGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmExtraSublimeTextGenerator.cxx.o.d"
+  "/root/repo/Source/cmFLTKWrapUICommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFLTKWrapUICommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFLTKWrapUICommand.cxx.o.d"
+  "/root/repo/Source/cmFSPermissions.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFSPermissions.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFSPermissions.cxx.o.d"
+  "/root/repo/Source/cmFastbuildLinkLineComputer.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFastbuildLinkLineComputer.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFastbuildLinkLineComputer.cxx.o.d"
+  "/root/repo/Source/cmFastbuildNormalTargetGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFastbuildNormalTargetGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFastbuildNormalTargetGenerator.cxx.o.d"
+  "/root/repo/Source/cmFastbuildTargetGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFastbuildTargetGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFastbuildTargetGenerator.cxx.o.d"
+  "/root/repo/Source/cmFastbuildUtilityTargetGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFastbuildUtilityTargetGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFastbuildUtilityTargetGenerator.cxx.o.d"
+  "/root/repo/Source/cmFileAPI.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFileAPI.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFileAPI.cxx.o.d"
+  "/root/repo/Source/cmFileAPICMakeFiles.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFileAPICMakeFiles.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFileAPICMakeFiles.cxx.o.d"
+  "/root/repo/Source/cmFileAPICache.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFileAPICache.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFileAPICache.cxx.o.d"
+  "/root/repo/Source/cmFileAPICodemodel.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFileAPICodemodel.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFileAPICodemodel.cxx.o.d"
+  "/root/repo/Source/cmFileAPICommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFileAPICommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFileAPICommand.cxx.o.d"
+  "/root/repo/Source/cmFileAPIConfigureLog.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFileAPIConfigureLog.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFileAPIConfigureLog.cxx.o.d"
+  "/root/repo/Source/cmFileAPIToolchains.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFileAPIToolchains.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFileAPIToolchains.cxx.o.d"
+  "/root/repo/Source/cmFileCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFileCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFileCommand.cxx.o.d"
+  "/root/repo/Source/cmFileCommand_ReadMacho.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFileCommand_ReadMacho.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFileCommand_ReadMacho.cxx.o.d"
+  "/root/repo/Source/cmFileCopier.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFileCopier.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFileCopier.cxx.o.d"
+  "/root/repo/Source/cmFileInstaller.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFileInstaller.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFileInstaller.cxx.o.d"
+  "/root/repo/Source/cmFileLock.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFileLock.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFileLock.cxx.o.d"
+  "/root/repo/Source/cmFileLockPool.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFileLockPool.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFileLockPool.cxx.o.d"
+  "/root/repo/Source/cmFileLockResult.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFileLockResult.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFileLockResult.cxx.o.d"
+  "/root/repo/Source/cmFilePathChecksum.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFilePathChecksum.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFilePathChecksum.cxx.o.d"
+  "/root/repo/Source/cmFileSet.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFileSet.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFileSet.cxx.o.d"
+  "/root/repo/Source/cmFileSetMetadata.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFileSetMetadata.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFileSetMetadata.cxx.o.d"
+  "/root/repo/Source/cmFileTime.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFileTime.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFileTime.cxx.o.d"
+  "/root/repo/Source/cmFileTimeCache.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFileTimeCache.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFileTimeCache.cxx.o.d"
+  "/root/repo/Source/cmFileTimes.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFileTimes.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFileTimes.cxx.o.d"
+  "/root/repo/Source/cmFindBase.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFindBase.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFindBase.cxx.o.d"
+  "/root/repo/Source/cmFindCommon.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFindCommon.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFindCommon.cxx.o.d"
+  "/root/repo/Source/cmFindFileCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFindFileCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFindFileCommand.cxx.o.d"
+  "/root/repo/Source/cmFindLibraryCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFindLibraryCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFindLibraryCommand.cxx.o.d"
+  "/root/repo/Source/cmFindPackageCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFindPackageCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFindPackageCommand.cxx.o.d"
+  "/root/repo/Source/cmFindPackageStack.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFindPackageStack.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFindPackageStack.cxx.o.d"
+  "/root/repo/Source/cmFindPathCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFindPathCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFindPathCommand.cxx.o.d"
+  "/root/repo/Source/cmFindProgramCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFindProgramCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFindProgramCommand.cxx.o.d"
+  "/root/repo/Source/cmForEachCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmForEachCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmForEachCommand.cxx.o.d"
+  "/root/repo/Source/cmFortranParserImpl.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFortranParserImpl.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFortranParserImpl.cxx.o.d"
+  "/root/repo/Source/cmFunctionBlocker.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFunctionBlocker.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFunctionBlocker.cxx.o.d"
+  "/root/repo/Source/cmFunctionCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmFunctionCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmFunctionCommand.cxx.o.d"
+  "/root/repo/Source/cmGccDepfileLexerHelper.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGccDepfileLexerHelper.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGccDepfileLexerHelper.cxx.o.d"
+  "/root/repo/Source/cmGccDepfileReader.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGccDepfileReader.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGccDepfileReader.cxx.o.d"
+  "/root/repo/Source/cmGenExContext.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGenExContext.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGenExContext.cxx.o.d"
+  "/root/repo/Source/cmGenExEvaluation.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGenExEvaluation.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGenExEvaluation.cxx.o.d"
+  "/root/repo/Source/cmGenExMemo.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGenExMemo.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGenExMemo.cxx.o.d"
+  "/root/repo/Source/cmGeneratedFileStream.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGeneratedFileStream.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGeneratedFileStream.cxx.o.d"
+  "/root/repo/Source/cmGeneratorExpression.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorExpression.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorExpression.cxx.o.d"
+  "/root/repo/Source/cmGeneratorExpressionDAGChecker.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorExpressionDAGChecker.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorExpressionDAGChecker.cxx.o.d"
+  "/root/repo/Source/cmGeneratorExpressionEvaluationFile.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorExpressionEvaluationFile.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorExpressionEvaluationFile.cxx.o.d"
+  "/root/repo/Source/cmGeneratorExpressionEvaluator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorExpressionEvaluator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorExpressionEvaluator.cxx.o.d"
+  "/root/repo/Source/cmGeneratorExpressionLexer.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorExpressionLexer.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorExpressionLexer.cxx.o.d"
+  "/root/repo/Source/cmGeneratorExpressionNode.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorExpressionNode.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorExpressionNode.cxx.o.d"
+  "/root/repo/Source/cmGeneratorExpressionParser.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorExpressionParser.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorExpressionParser.cxx.o.d"
+  "/root/repo/Source/cmGeneratorFileSet.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorFileSet.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorFileSet.cxx.o.d"
+  "/root/repo/Source/cmGeneratorFileSets.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorFileSets.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorFileSets.cxx.o.d"
+  "/root/repo/Source/cmGeneratorTarget.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorTarget.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorTarget.cxx.o.d"
+  "/root/repo/Source/cmGeneratorTarget_CompatibleInterface.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorTarget_CompatibleInterface.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorTarget_CompatibleInterface.cxx.o.d"
+  "/root/repo/Source/cmGeneratorTarget_HeaderSetVerification.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorTarget_HeaderSetVerification.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorTarget_HeaderSetVerification.cxx.o.d"
+  "/root/repo/Source/cmGeneratorTarget_IncludeDirectories.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorTarget_IncludeDirectories.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorTarget_IncludeDirectories.cxx.o.d"
+  "/root/repo/Source/cmGeneratorTarget_Link.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorTarget_Link.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorTarget_Link.cxx.o.d"
+  "/root/repo/Source/cmGeneratorTarget_LinkDirectories.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorTarget_LinkDirectories.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorTarget_LinkDirectories.cxx.o.d"
+  "/root/repo/Source/cmGeneratorTarget_Options.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorTarget_Options.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorTarget_Options.cxx.o.d"
+  "/root/repo/Source/cmGeneratorTarget_Sources.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorTarget_Sources.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorTarget_Sources.cxx.o.d"
+  "/root/repo/Source/cmGeneratorTarget_TransitiveProperty.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorTarget_TransitiveProperty.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGeneratorTarget_TransitiveProperty.cxx.o.d"
+  "/root/repo/Source/cmGetCMakePropertyCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGetCMakePropertyCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGetCMakePropertyCommand.cxx.o.d"
+  "/root/repo/Source/cmGetDirectoryPropertyCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGetDirectoryPropertyCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGetDirectoryPropertyCommand.cxx.o.d"
+  "/root/repo/Source/cmGetFilenameComponentCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGetFilenameComponentCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGetFilenameComponentCommand.cxx.o.d"
+  "/root/repo/Source/cmGetPipes.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGetPipes.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGetPipes.cxx.o.d"
+  "/root/repo/Source/cmGetPropertyCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGetPropertyCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGetPropertyCommand.cxx.o.d"
+  "/root/repo/Source/cmGetSourceFilePropertyCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGetSourceFilePropertyCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGetSourceFilePropertyCommand.cxx.o.d"
+  "/root/repo/Source/cmGetTargetPropertyCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGetTargetPropertyCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGetTargetPropertyCommand.cxx.o.d"
+  "/root/repo/Source/cmGetTestPropertyCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGetTestPropertyCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGetTestPropertyCommand.cxx.o.d"
+  "/root/repo/Source/cmGhsMultiGpj.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGhsMultiGpj.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGhsMultiGpj.cxx.o.d"
+  "/root/repo/Source/cmGhsMultiTargetGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGhsMultiTargetGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGhsMultiTargetGenerator.cxx.o.d"
+  "/root/repo/Source/cmGlobVerificationManager.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGlobVerificationManager.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGlobVerificationManager.cxx.o.d"
+  "/root/repo/Source/cmGlobalCommonGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGlobalCommonGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGlobalCommonGenerator.cxx.o.d"
+  "/root/repo/Source/cmGlobalFastbuildGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGlobalFastbuildGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGlobalFastbuildGenerator.cxx.o.d"
+  "/root/repo/Source/cmGlobalGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGlobalGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGlobalGenerator.cxx.o.d"
+  "/root/repo/Source/cmGlobalGhsMultiGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGlobalGhsMultiGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGlobalGhsMultiGenerator.cxx.o.d"
+  "/root/repo/Source/cmGlobalNinjaGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGlobalNinjaGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGlobalNinjaGenerator.cxx.o.d"
+  "/root/repo/Source/cmGlobalUnixMakefileGenerator3.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGlobalUnixMakefileGenerator3.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGlobalUnixMakefileGenerator3.cxx.o.d"
+  "/root/repo/Source/cmGlobalWatcomWMakeGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGlobalWatcomWMakeGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGlobalWatcomWMakeGenerator.cxx.o.d"
+  "/root/repo/Source/cmGraphVizWriter.cxx" "Source/CMakeFiles/CMakeLib.dir/cmGraphVizWriter.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmGraphVizWriter.cxx.o.d"
+  "/root/repo/Source/cmHexFileConverter.cxx" "Source/CMakeFiles/CMakeLib.dir/cmHexFileConverter.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmHexFileConverter.cxx.o.d"
+  "/root/repo/Source/cmIfCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmIfCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmIfCommand.cxx.o.d"
+  "/root/repo/Source/cmImportedCxxModuleInfo.cxx" "Source/CMakeFiles/CMakeLib.dir/cmImportedCxxModuleInfo.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmImportedCxxModuleInfo.cxx.o.d"
+  "/root/repo/Source/cmIncludeCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmIncludeCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmIncludeCommand.cxx.o.d"
+  "/root/repo/Source/cmIncludeDirectoryCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmIncludeDirectoryCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmIncludeDirectoryCommand.cxx.o.d"
+  "/root/repo/Source/cmIncludeExternalMSProjectCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmIncludeExternalMSProjectCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmIncludeExternalMSProjectCommand.cxx.o.d"
+  "/root/repo/Source/cmIncludeGuardCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmIncludeGuardCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmIncludeGuardCommand.cxx.o.d"
+  "/root/repo/Source/cmIncludeRegularExpressionCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmIncludeRegularExpressionCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmIncludeRegularExpressionCommand.cxx.o.d"
+  "/root/repo/Source/cmInstallAndroidMKExportGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallAndroidMKExportGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallAndroidMKExportGenerator.cxx.o.d"
+  "/root/repo/Source/cmInstallCMakeConfigExportGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallCMakeConfigExportGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallCMakeConfigExportGenerator.cxx.o.d"
+  "/root/repo/Source/cmInstallCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallCommand.cxx.o.d"
+  "/root/repo/Source/cmInstallCommandArguments.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallCommandArguments.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallCommandArguments.cxx.o.d"
+  "/root/repo/Source/cmInstallCxxModuleBmiGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallCxxModuleBmiGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallCxxModuleBmiGenerator.cxx.o.d"
+  "/root/repo/Source/cmInstallDirectoryGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallDirectoryGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallDirectoryGenerator.cxx.o.d"
+  "/root/repo/Source/cmInstallDirs.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallDirs.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallDirs.cxx.o.d"
+  "/root/repo/Source/cmInstallExportGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallExportGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallExportGenerator.cxx.o.d"
+  "/root/repo/Source/cmInstallFileSetGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallFileSetGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallFileSetGenerator.cxx.o.d"
+  "/root/repo/Source/cmInstallFilesCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallFilesCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallFilesCommand.cxx.o.d"
+  "/root/repo/Source/cmInstallFilesGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallFilesGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallFilesGenerator.cxx.o.d"
+  "/root/repo/Source/cmInstallGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallGenerator.cxx.o.d"
+  "/root/repo/Source/cmInstallGetRuntimeDependenciesGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallGetRuntimeDependenciesGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallGetRuntimeDependenciesGenerator.cxx.o.d"
+  "/root/repo/Source/cmInstallImportedRuntimeArtifactsGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallImportedRuntimeArtifactsGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallImportedRuntimeArtifactsGenerator.cxx.o.d"
+  "/root/repo/Source/cmInstallPackageInfoExportGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallPackageInfoExportGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallPackageInfoExportGenerator.cxx.o.d"
+  "/root/repo/Source/cmInstallProgramsCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallProgramsCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallProgramsCommand.cxx.o.d"
+  "/root/repo/Source/cmInstallRuntimeDependencySet.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallRuntimeDependencySet.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallRuntimeDependencySet.cxx.o.d"
+  "/root/repo/Source/cmInstallRuntimeDependencySetGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallRuntimeDependencySetGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallRuntimeDependencySetGenerator.cxx.o.d"
+  "/root/repo/Source/cmInstallSbomBuilder.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallSbomBuilder.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallSbomBuilder.cxx.o.d"
+  "/root/repo/Source/cmInstallSbomGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallSbomGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallSbomGenerator.cxx.o.d"
+  "/root/repo/Source/cmInstallScriptGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallScriptGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallScriptGenerator.cxx.o.d"
+  "/root/repo/Source/cmInstallScriptHandler.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallScriptHandler.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallScriptHandler.cxx.o.d"
+  "/root/repo/Source/cmInstallSubdirectoryGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallSubdirectoryGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallSubdirectoryGenerator.cxx.o.d"
+  "/root/repo/Source/cmInstallTargetGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallTargetGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallTargetGenerator.cxx.o.d"
+  "/root/repo/Source/cmInstallTargetsCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstallTargetsCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstallTargetsCommand.cxx.o.d"
+  "/root/repo/Source/cmInstalledFile.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstalledFile.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstalledFile.cxx.o.d"
+  "/root/repo/Source/cmInstrumentation.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstrumentation.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstrumentation.cxx.o.d"
+  "/root/repo/Source/cmInstrumentationCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstrumentationCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstrumentationCommand.cxx.o.d"
+  "/root/repo/Source/cmInstrumentationInterrupt.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstrumentationInterrupt.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstrumentationInterrupt.cxx.o.d"
+  "/root/repo/Source/cmInstrumentationQuery.cxx" "Source/CMakeFiles/CMakeLib.dir/cmInstrumentationQuery.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmInstrumentationQuery.cxx.o.d"
+  "/root/repo/Source/cmJSONHelpers.cxx" "Source/CMakeFiles/CMakeLib.dir/cmJSONHelpers.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmJSONHelpers.cxx.o.d"
+  "/root/repo/Source/cmJSONState.cxx" "Source/CMakeFiles/CMakeLib.dir/cmJSONState.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmJSONState.cxx.o.d"
+  "/root/repo/Source/cmLDConfigLDConfigTool.cxx" "Source/CMakeFiles/CMakeLib.dir/cmLDConfigLDConfigTool.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmLDConfigLDConfigTool.cxx.o.d"
+  "/root/repo/Source/cmLDConfigTool.cxx" "Source/CMakeFiles/CMakeLib.dir/cmLDConfigTool.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmLDConfigTool.cxx.o.d"
+  "/root/repo/Source/cmLinkDirectoriesCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmLinkDirectoriesCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmLinkDirectoriesCommand.cxx.o.d"
+  "/root/repo/Source/cmLinkItem.cxx" "Source/CMakeFiles/CMakeLib.dir/cmLinkItem.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmLinkItem.cxx.o.d"
+  "/root/repo/Source/cmLinkItemGraphVisitor.cxx" "Source/CMakeFiles/CMakeLib.dir/cmLinkItemGraphVisitor.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmLinkItemGraphVisitor.cxx.o.d"
+  "/root/repo/Source/cmLinkLibrariesCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmLinkLibrariesCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmLinkLibrariesCommand.cxx.o.d"
+  "/root/repo/Source/cmLinkLineComputer.cxx" "Source/CMakeFiles/CMakeLib.dir/cmLinkLineComputer.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmLinkLineComputer.cxx.o.d"
+  "/root/repo/Source/cmLinkLineDeviceComputer.cxx" "Source/CMakeFiles/CMakeLib.dir/cmLinkLineDeviceComputer.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmLinkLineDeviceComputer.cxx.o.d"
+  "/root/repo/Source/cmList.cxx" "Source/CMakeFiles/CMakeLib.dir/cmList.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmList.cxx.o.d"
+  "/root/repo/Source/cmListCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmListCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmListCommand.cxx.o.d"
+  "/root/repo/Source/cmListFileCache.cxx" "Source/CMakeFiles/CMakeLib.dir/cmListFileCache.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmListFileCache.cxx.o.d"
+  "/root/repo/Source/cmListFileParseCache.cxx" "Source/CMakeFiles/CMakeLib.dir/cmListFileParseCache.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmListFileParseCache.cxx.o.d"
+  "/root/repo/Source/cmListFilePrefetcher.cxx" "Source/CMakeFiles/CMakeLib.dir/cmListFilePrefetcher.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmListFilePrefetcher.cxx.o.d"
+  "/root/repo/Source/cmLoadCacheCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmLoadCacheCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmLoadCacheCommand.cxx.o.d"
+  "/root/repo/Source/cmLocalCommonGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmLocalCommonGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmLocalCommonGenerator.cxx.o.d"
+  "/root/repo/Source/cmLocalFastbuildGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmLocalFastbuildGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmLocalFastbuildGenerator.cxx.o.d"
+  "/root/repo/Source/cmLocalGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmLocalGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmLocalGenerator.cxx.o.d"
+  "/root/repo/Source/cmLocalGhsMultiGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmLocalGhsMultiGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmLocalGhsMultiGenerator.cxx.o.d"
+  "/root/repo/Source/cmLocalNinjaGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmLocalNinjaGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmLocalNinjaGenerator.cxx.o.d"
+  "/root/repo/Source/cmLocalUnixMakefileGenerator3.cxx" "Source/CMakeFiles/CMakeLib.dir/cmLocalUnixMakefileGenerator3.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmLocalUnixMakefileGenerator3.cxx.o.d"
+  "/root/repo/Source/cmMSVC60LinkLineComputer.cxx" "Source/CMakeFiles/CMakeLib.dir/cmMSVC60LinkLineComputer.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmMSVC60LinkLineComputer.cxx.o.d"
+  "/root/repo/Source/cmMacroCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmMacroCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmMacroCommand.cxx.o.d"
+  "/root/repo/Source/cmMakeDirectoryCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmMakeDirectoryCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmMakeDirectoryCommand.cxx.o.d"
+  "/root/repo/Source/cmMakefile.cxx" "Source/CMakeFiles/CMakeLib.dir/cmMakefile.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmMakefile.cxx.o.d"
+  "/root/repo/Source/cmMakefileExecutableTargetGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmMakefileExecutableTargetGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmMakefileExecutableTargetGenerator.cxx.o.d"
+  "/root/repo/Source/cmMakefileLibraryTargetGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmMakefileLibraryTargetGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmMakefileLibraryTargetGenerator.cxx.o.d"
+  "/root/repo/Source/cmMakefileProfilingData.cxx" "Source/CMakeFiles/CMakeLib.dir/cmMakefileProfilingData.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmMakefileProfilingData.cxx.o.d"
+  "/root/repo/Source/cmMakefileTargetGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmMakefileTargetGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmMakefileTargetGenerator.cxx.o.d"
+  "/root/repo/Source/cmMakefileUtilityTargetGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmMakefileUtilityTargetGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmMakefileUtilityTargetGenerator.cxx.o.d"
+  "/root/repo/Source/cmMappedFile.cxx" "Source/CMakeFiles/CMakeLib.dir/cmMappedFile.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmMappedFile.cxx.o.d"
+  "/root/repo/Source/cmMarkAsAdvancedCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmMarkAsAdvancedCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmMarkAsAdvancedCommand.cxx.o.d"
+  "/root/repo/Source/cmMathCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmMathCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmMathCommand.cxx.o.d"
+  "/root/repo/Source/cmMessageCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmMessageCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmMessageCommand.cxx.o.d"
+  "/root/repo/Source/cmMessenger.cxx" "Source/CMakeFiles/CMakeLib.dir/cmMessenger.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmMessenger.cxx.o.d"
+  "/root/repo/Source/cmNewLineStyle.cxx" "Source/CMakeFiles/CMakeLib.dir/cmNewLineStyle.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmNewLineStyle.cxx.o.d"
+  "/root/repo/Source/cmNinjaLinkLineComputer.cxx" "Source/CMakeFiles/CMakeLib.dir/cmNinjaLinkLineComputer.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmNinjaLinkLineComputer.cxx.o.d"
+  "/root/repo/Source/cmNinjaLinkLineDeviceComputer.cxx" "Source/CMakeFiles/CMakeLib.dir/cmNinjaLinkLineDeviceComputer.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmNinjaLinkLineDeviceComputer.cxx.o.d"
+  "/root/repo/Source/cmNinjaNormalTargetGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmNinjaNormalTargetGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmNinjaNormalTargetGenerator.cxx.o.d"
+  "/root/repo/Source/cmNinjaOutputQueue.cxx" "Source/CMakeFiles/CMakeLib.dir/cmNinjaOutputQueue.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmNinjaOutputQueue.cxx.o.d"
+  "/root/repo/Source/cmNinjaTargetGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmNinjaTargetGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmNinjaTargetGenerator.cxx.o.d"
+  "/root/repo/Source/cmNinjaUtilityTargetGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmNinjaUtilityTargetGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmNinjaUtilityTargetGenerator.cxx.o.d"
+  "/root/repo/Source/cmOSXBundleGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmOSXBundleGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmOSXBundleGenerator.cxx.o.d"
+  "/root/repo/Source/cmObjectLocation.cxx" "Source/CMakeFiles/CMakeLib.dir/cmObjectLocation.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmObjectLocation.cxx.o.d"
+  "/root/repo/Source/cmOptionCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmOptionCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmOptionCommand.cxx.o.d"
+  "/root/repo/Source/cmOrderDirectories.cxx" "Source/CMakeFiles/CMakeLib.dir/cmOrderDirectories.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmOrderDirectories.cxx.o.d"
+  "/root/repo/Source/cmOutputConverter.cxx" "Source/CMakeFiles/CMakeLib.dir/cmOutputConverter.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmOutputConverter.cxx.o.d"
+  "/root/repo/Source/cmPackageInfoArguments.cxx" "Source/CMakeFiles/CMakeLib.dir/cmPackageInfoArguments.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmPackageInfoArguments.cxx.o.d"
+  "/root/repo/Source/cmPackageInfoReader.cxx" "Source/CMakeFiles/CMakeLib.dir/cmPackageInfoReader.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmPackageInfoReader.cxx.o.d"
+  "/root/repo/Source/cmParseArgumentsCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmParseArgumentsCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmParseArgumentsCommand.cxx.o.d"
+  "/root/repo/Source/cmPathLabel.cxx" "Source/CMakeFiles/CMakeLib.dir/cmPathLabel.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmPathLabel.cxx.o.d"
+  "/root/repo/Source/cmPathResolver.cxx" "Source/CMakeFiles/CMakeLib.dir/cmPathResolver.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmPathResolver.cxx.o.d"
+  "/root/repo/Source/cmPkgConfigParser.cxx" "Source/CMakeFiles/CMakeLib.dir/cmPkgConfigParser.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmPkgConfigParser.cxx.o.d"
+  "/root/repo/Source/cmPkgConfigResolver.cxx" "Source/CMakeFiles/CMakeLib.dir/cmPkgConfigResolver.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmPkgConfigResolver.cxx.o.d"
+  "/root/repo/Source/cmPlaceholderExpander.cxx" "Source/CMakeFiles/CMakeLib.dir/cmPlaceholderExpander.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmPlaceholderExpander.cxx.o.d"
+  "/root/repo/Source/cmPlistParser.cxx" "Source/CMakeFiles/CMakeLib.dir/cmPlistParser.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmPlistParser.cxx.o.d"
+  "/root/repo/Source/cmPolicies.cxx" "Source/CMakeFiles/CMakeLib.dir/cmPolicies.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmPolicies.cxx.o.d"
+  "/root/repo/Source/cmProcessOutput.cxx" "Source/CMakeFiles/CMakeLib.dir/cmProcessOutput.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmProcessOutput.cxx.o.d"
+  "/root/repo/Source/cmProcessTools.cxx" "Source/CMakeFiles/CMakeLib.dir/cmProcessTools.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmProcessTools.cxx.o.d"
+  "/root/repo/Source/cmProjectCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmProjectCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmProjectCommand.cxx.o.d"
+  "/root/repo/Source/cmProjectInfoArguments.cxx" "Source/CMakeFiles/CMakeLib.dir/cmProjectInfoArguments.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmProjectInfoArguments.cxx.o.d"
+  "/root/repo/Source/cmPropertyDefinition.cxx" "Source/CMakeFiles/CMakeLib.dir/cmPropertyDefinition.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmPropertyDefinition.cxx.o.d"
+  "/root/repo/Source/cmPropertyMap.cxx" "Source/CMakeFiles/CMakeLib.dir/cmPropertyMap.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmPropertyMap.cxx.o.d"
+  "/root/repo/Source/cmQTWrapCPPCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmQTWrapCPPCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmQTWrapCPPCommand.cxx.o.d"
+  "/root/repo/Source/cmQTWrapUICommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmQTWrapUICommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmQTWrapUICommand.cxx.o.d"
+  "/root/repo/Source/cmQtAutoGen.cxx" "Source/CMakeFiles/CMakeLib.dir/cmQtAutoGen.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmQtAutoGen.cxx.o.d"
+  "/root/repo/Source/cmQtAutoGenGlobalInitializer.cxx" "Source/CMakeFiles/CMakeLib.dir/cmQtAutoGenGlobalInitializer.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmQtAutoGenGlobalInitializer.cxx.o.d"
+  "/root/repo/Source/cmQtAutoGenInitializer.cxx" "Source/CMakeFiles/CMakeLib.dir/cmQtAutoGenInitializer.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmQtAutoGenInitializer.cxx.o.d"
+  "/root/repo/Source/cmQtAutoGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmQtAutoGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmQtAutoGenerator.cxx.o.d"
+  "/root/repo/Source/cmQtAutoMocUic.cxx" "Source/CMakeFiles/CMakeLib.dir/cmQtAutoMocUic.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmQtAutoMocUic.cxx.o.d"
+  "/root/repo/Source/cmQtAutoRcc.cxx" "Source/CMakeFiles/CMakeLib.dir/cmQtAutoRcc.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmQtAutoRcc.cxx.o.d"
+  "/root/repo/Source/cmRST.cxx" "Source/CMakeFiles/CMakeLib.dir/cmRST.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmRST.cxx.o.d"
+  "/root/repo/Source/cmRegularExpressionCache.cxx" "Source/CMakeFiles/CMakeLib.dir/cmRegularExpressionCache.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmRegularExpressionCache.cxx.o.d"
+  "/root/repo/Source/cmRemoveCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmRemoveCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmRemoveCommand.cxx.o.d"
+  "/root/repo/Source/cmRemoveDefinitionsCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmRemoveDefinitionsCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmRemoveDefinitionsCommand.cxx.o.d"
+  "/root/repo/Source/cmReturnCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmReturnCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmReturnCommand.cxx.o.d"
+  "/root/repo/Source/cmRulePlaceholderExpander.cxx" "Source/CMakeFiles/CMakeLib.dir/cmRulePlaceholderExpander.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmRulePlaceholderExpander.cxx.o.d"
+  "/root/repo/Source/cmRuntimeDependencyArchive.cxx" "Source/CMakeFiles/CMakeLib.dir/cmRuntimeDependencyArchive.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmRuntimeDependencyArchive.cxx.o.d"
+  "/root/repo/Source/cmSarif.cxx" "Source/CMakeFiles/CMakeLib.dir/cmSarif.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmSarif.cxx.o.d"
+  "/root/repo/Source/cmSbomArguments.cxx" "Source/CMakeFiles/CMakeLib.dir/cmSbomArguments.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmSbomArguments.cxx.o.d"
+  "/root/repo/Source/cmSbomBuilder.cxx" "Source/CMakeFiles/CMakeLib.dir/cmSbomBuilder.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmSbomBuilder.cxx.o.d"
+  "/root/repo/Source/cmScanDepFormat.cxx" "Source/CMakeFiles/CMakeLib.dir/cmScanDepFormat.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmScanDepFormat.cxx.o.d"
+  "/root/repo/Source/cmScriptGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmScriptGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmScriptGenerator.cxx.o.d"
+  "/root/repo/Source/cmSearchPath.cxx" "Source/CMakeFiles/CMakeLib.dir/cmSearchPath.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmSearchPath.cxx.o.d"
+  "/root/repo/Source/cmSeparateArgumentsCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmSeparateArgumentsCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmSeparateArgumentsCommand.cxx.o.d"
+  "/root/repo/Source/cmSetCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmSetCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmSetCommand.cxx.o.d"
+  "/root/repo/Source/cmSetDirectoryPropertiesCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmSetDirectoryPropertiesCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmSetDirectoryPropertiesCommand.cxx.o.d"
+  "/root/repo/Source/cmSetPropertyCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmSetPropertyCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmSetPropertyCommand.cxx.o.d"
+  "/root/repo/Source/cmSetSourceFilesPropertiesCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmSetSourceFilesPropertiesCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmSetSourceFilesPropertiesCommand.cxx.o.d"
+  "/root/repo/Source/cmSetTargetPropertiesCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmSetTargetPropertiesCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmSetTargetPropertiesCommand.cxx.o.d"
+  "/root/repo/Source/cmSetTestsPropertiesCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmSetTestsPropertiesCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmSetTestsPropertiesCommand.cxx.o.d"
+  "/root/repo/Source/cmSiteNameCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmSiteNameCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmSiteNameCommand.cxx.o.d"
+  "/root/repo/Source/cmSourceFile.cxx" "Source/CMakeFiles/CMakeLib.dir/cmSourceFile.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmSourceFile.cxx.o.d"
+  "/root/repo/Source/cmSourceFileLocation.cxx" "Source/CMakeFiles/CMakeLib.dir/cmSourceFileLocation.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmSourceFileLocation.cxx.o.d"
+  "/root/repo/Source/cmSourceGroup.cxx" "Source/CMakeFiles/CMakeLib.dir/cmSourceGroup.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmSourceGroup.cxx.o.d"
+  "/root/repo/Source/cmSourceGroupCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmSourceGroupCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmSourceGroupCommand.cxx.o.d"
+  "/root/repo/Source/cmSpdx.cxx" "Source/CMakeFiles/CMakeLib.dir/cmSpdx.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmSpdx.cxx.o.d"
+  "/root/repo/Source/cmSpdxSerializer.cxx" "Source/CMakeFiles/CMakeLib.dir/cmSpdxSerializer.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmSpdxSerializer.cxx.o.d"
+  "/root/repo/Source/cmStandardLevelResolver.cxx" "Source/CMakeFiles/CMakeLib.dir/cmStandardLevelResolver.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmStandardLevelResolver.cxx.o.d"
+  "/root/repo/Source/cmState.cxx" "Source/CMakeFiles/CMakeLib.dir/cmState.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmState.cxx.o.d"
+  "/root/repo/Source/cmStateDirectory.cxx" "Source/CMakeFiles/CMakeLib.dir/cmStateDirectory.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmStateDirectory.cxx.o.d"
+  "/root/repo/Source/cmStateSnapshot.cxx" "Source/CMakeFiles/CMakeLib.dir/cmStateSnapshot.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmStateSnapshot.cxx.o.d"
+  "/root/repo/Source/cmStdIoConsole.cxx" "Source/CMakeFiles/CMakeLib.dir/cmStdIoConsole.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmStdIoConsole.cxx.o.d"
+  "/root/repo/Source/cmStdIoInit.cxx" "Source/CMakeFiles/CMakeLib.dir/cmStdIoInit.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmStdIoInit.cxx.o.d"
+  "/root/repo/Source/cmStdIoStream.cxx" "Source/CMakeFiles/CMakeLib.dir/cmStdIoStream.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmStdIoStream.cxx.o.d"
+  "/root/repo/Source/cmStdIoTerminal.cxx" "Source/CMakeFiles/CMakeLib.dir/cmStdIoTerminal.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmStdIoTerminal.cxx.o.d"
+  "/root/repo/Source/cmString.cxx" "Source/CMakeFiles/CMakeLib.dir/cmString.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmString.cxx.o.d"
+  "/root/repo/Source/cmStringAlgorithms.cxx" "Source/CMakeFiles/CMakeLib.dir/cmStringAlgorithms.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmStringAlgorithms.cxx.o.d"
+  "/root/repo/Source/cmStringCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmStringCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmStringCommand.cxx.o.d"
+  "/root/repo/Source/cmStringReplaceHelper.cxx" "Source/CMakeFiles/CMakeLib.dir/cmStringReplaceHelper.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmStringReplaceHelper.cxx.o.d"
+  "/root/repo/Source/cmSubcommandTable.cxx" "Source/CMakeFiles/CMakeLib.dir/cmSubcommandTable.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmSubcommandTable.cxx.o.d"
+  "/root/repo/Source/cmSubdirCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmSubdirCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmSubdirCommand.cxx.o.d"
+  "/root/repo/Source/cmSystemTools.cxx" "Source/CMakeFiles/CMakeLib.dir/cmSystemTools.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmSystemTools.cxx.o.d"
+  "/root/repo/Source/cmTarget.cxx" "Source/CMakeFiles/CMakeLib.dir/cmTarget.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmTarget.cxx.o.d"
+  "/root/repo/Source/cmTargetCompileDefinitionsCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmTargetCompileDefinitionsCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmTargetCompileDefinitionsCommand.cxx.o.d"
+  "/root/repo/Source/cmTargetCompileFeaturesCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmTargetCompileFeaturesCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmTargetCompileFeaturesCommand.cxx.o.d"
+  "/root/repo/Source/cmTargetCompileOptionsCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmTargetCompileOptionsCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmTargetCompileOptionsCommand.cxx.o.d"
+  "/root/repo/Source/cmTargetIncludeDirectoriesCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmTargetIncludeDirectoriesCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmTargetIncludeDirectoriesCommand.cxx.o.d"
+  "/root/repo/Source/cmTargetLinkDirectoriesCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmTargetLinkDirectoriesCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmTargetLinkDirectoriesCommand.cxx.o.d"
+  "/root/repo/Source/cmTargetLinkLibrariesCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmTargetLinkLibrariesCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmTargetLinkLibrariesCommand.cxx.o.d"
+  "/root/repo/Source/cmTargetLinkOptionsCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmTargetLinkOptionsCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmTargetLinkOptionsCommand.cxx.o.d"
+  "/root/repo/Source/cmTargetPrecompileHeadersCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmTargetPrecompileHeadersCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmTargetPrecompileHeadersCommand.cxx.o.d"
+  "/root/repo/Source/cmTargetPropCommandBase.cxx" "Source/CMakeFiles/CMakeLib.dir/cmTargetPropCommandBase.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmTargetPropCommandBase.cxx.o.d"
+  "/root/repo/Source/cmTargetPropertyComputer.cxx" "Source/CMakeFiles/CMakeLib.dir/cmTargetPropertyComputer.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmTargetPropertyComputer.cxx.o.d"
+  "/root/repo/Source/cmTargetPropertyEntry.cxx" "Source/CMakeFiles/CMakeLib.dir/cmTargetPropertyEntry.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmTargetPropertyEntry.cxx.o.d"
+  "/root/repo/Source/cmTargetSourcesCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmTargetSourcesCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmTargetSourcesCommand.cxx.o.d"
+  "/root/repo/Source/cmTargetTraceDependencies.cxx" "Source/CMakeFiles/CMakeLib.dir/cmTargetTraceDependencies.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmTargetTraceDependencies.cxx.o.d"
+  "/root/repo/Source/cmTest.cxx" "Source/CMakeFiles/CMakeLib.dir/cmTest.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmTest.cxx.o.d"
+  "/root/repo/Source/cmTestGenerator.cxx" "Source/CMakeFiles/CMakeLib.dir/cmTestGenerator.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmTestGenerator.cxx.o.d"
+  "/root/repo/Source/cmTimestamp.cxx" "Source/CMakeFiles/CMakeLib.dir/cmTimestamp.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmTimestamp.cxx.o.d"
+  "/root/repo/Source/cmTransformDepfile.cxx" "Source/CMakeFiles/CMakeLib.dir/cmTransformDepfile.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmTransformDepfile.cxx.o.d"
+  "/root/repo/Source/cmTryCompileCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmTryCompileCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmTryCompileCommand.cxx.o.d"
+  "/root/repo/Source/cmTryRunCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmTryRunCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmTryRunCommand.cxx.o.d"
+  "/root/repo/Source/cmUVHandlePtr.cxx" "Source/CMakeFiles/CMakeLib.dir/cmUVHandlePtr.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmUVHandlePtr.cxx.o.d"
+  "/root/repo/Source/cmUVProcessChain.cxx" "Source/CMakeFiles/CMakeLib.dir/cmUVProcessChain.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmUVProcessChain.cxx.o.d"
+  "/root/repo/Source/cmUnsetCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmUnsetCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmUnsetCommand.cxx.o.d"
+  "/root/repo/Source/cmUuid.cxx" "Source/CMakeFiles/CMakeLib.dir/cmUuid.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmUuid.cxx.o.d"
+  "/root/repo/Source/cmValue.cxx" "Source/CMakeFiles/CMakeLib.dir/cmValue.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmValue.cxx.o.d"
+  "/root/repo/Source/cmVariableWatch.cxx" "Source/CMakeFiles/CMakeLib.dir/cmVariableWatch.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmVariableWatch.cxx.o.d"
+  "/root/repo/Source/cmVariableWatchCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmVariableWatchCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmVariableWatchCommand.cxx.o.d"
+  "/root/repo/Source/cmVersion.cxx" "Source/CMakeFiles/CMakeLib.dir/cmVersion.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmVersion.cxx.o.d"
+  "/root/repo/Source/cmVersion_Dependencies.cxx" "Source/CMakeFiles/CMakeLib.dir/cmVersion_Dependencies.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmVersion_Dependencies.cxx.o.d"
+  "/root/repo/Source/cmWhileCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmWhileCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmWhileCommand.cxx.o.d"
+  "/root/repo/Source/cmWindowsRegistry.cxx" "Source/CMakeFiles/CMakeLib.dir/cmWindowsRegistry.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmWindowsRegistry.cxx.o.d"
+  "/root/repo/Source/cmWorkerPool.cxx" "Source/CMakeFiles/CMakeLib.dir/cmWorkerPool.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmWorkerPool.cxx.o.d"
+  "/root/repo/Source/cmWorkingDirectory.cxx" "Source/CMakeFiles/CMakeLib.dir/cmWorkingDirectory.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmWorkingDirectory.cxx.o.d"
+  "/root/repo/Source/cmWriteFileCommand.cxx" "Source/CMakeFiles/CMakeLib.dir/cmWriteFileCommand.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmWriteFileCommand.cxx.o.d"
+  "/root/repo/Source/cmXMLParser.cxx" "Source/CMakeFiles/CMakeLib.dir/cmXMLParser.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmXMLParser.cxx.o.d"
+  "/root/repo/Source/cmXMLSafe.cxx" "Source/CMakeFiles/CMakeLib.dir/cmXMLSafe.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmXMLSafe.cxx.o.d"
+  "/root/repo/Source/cmXMLWriter.cxx" "Source/CMakeFiles/CMakeLib.dir/cmXMLWriter.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmXMLWriter.cxx.o.d"
+  "/root/repo/Source/cmXcFramework.cxx" "Source/CMakeFiles/CMakeLib.dir/cmXcFramework.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmXcFramework.cxx.o.d"
+  "/root/repo/Source/cm_codecvt.cxx" "Source/CMakeFiles/CMakeLib.dir/cm_codecvt.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cm_codecvt.cxx.o.d"
+  "/root/repo/Source/cm_fileno.cxx" "Source/CMakeFiles/CMakeLib.dir/cm_fileno.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cm_fileno.cxx.o.d"
+  "/root/repo/Source/cmake.cxx" "Source/CMakeFiles/CMakeLib.dir/cmake.cxx.o" "gcc" "Source/CMakeFiles/CMakeLib.dir/cmake.cxx.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/Utilities/std/CMakeFiles/cmstd.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Source/kwsys/CMakeFiles/cmsys.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmexpat/CMakeFiles/cmexpat.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmjsoncpp/CMakeFiles/cmjsoncpp.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmzlib/CMakeFiles/cmzlib.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmllpkgc/CMakeFiles/cmllpkgc.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmbzip2/CMakeFiles/cmbzip2.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmzstd/CMakeFiles/cmzstd.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,851 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CMakeLib.dir/LexerParser/cmDependsJavaLexer.cxx.o"
+  "CMakeFiles/CMakeLib.dir/LexerParser/cmDependsJavaLexer.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/LexerParser/cmDependsJavaParser.cxx.o"
+  "CMakeFiles/CMakeLib.dir/LexerParser/cmDependsJavaParser.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/LexerParser/cmExprLexer.cxx.o"
+  "CMakeFiles/CMakeLib.dir/LexerParser/cmExprLexer.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/LexerParser/cmExprParser.cxx.o"
+  "CMakeFiles/CMakeLib.dir/LexerParser/cmExprParser.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/LexerParser/cmFortranLexer.cxx.o"
+  "CMakeFiles/CMakeLib.dir/LexerParser/cmFortranLexer.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/LexerParser/cmFortranParser.cxx.o"
+  "CMakeFiles/CMakeLib.dir/LexerParser/cmFortranParser.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/LexerParser/cmListFileLexer.c.o"
+  "CMakeFiles/CMakeLib.dir/LexerParser/cmListFileLexer.c.o.d"
+  "CMakeFiles/CMakeLib.dir/bindexplib.cxx.o"
+  "CMakeFiles/CMakeLib.dir/bindexplib.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmAddCompileDefinitionsCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmAddCompileDefinitionsCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmAddCompileOptionsCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmAddCompileOptionsCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmAddCustomCommandCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmAddCustomCommandCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmAddCustomTargetCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmAddCustomTargetCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmAddDefinitionsCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmAddDefinitionsCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmAddDependenciesCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmAddDependenciesCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmAddExecutableCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmAddExecutableCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmAddLibraryCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmAddLibraryCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmAddLinkOptionsCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmAddLinkOptionsCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmAddSubDirectoryCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmAddSubDirectoryCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmAddTestCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmAddTestCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmAffinity.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmAffinity.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmArchiveWrite.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmArchiveWrite.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmArgumentParser.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmArgumentParser.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmAuxSourceDirectoryCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmAuxSourceDirectoryCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmBase32.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmBase32.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsLinker.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsLinker.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsLinuxELFGetRuntimeDependenciesTool.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsLinuxELFGetRuntimeDependenciesTool.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsLinuxELFLinker.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsLinuxELFLinker.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsLinuxELFObjdumpGetRuntimeDependenciesTool.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsLinuxELFObjdumpGetRuntimeDependenciesTool.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsMacOSMachOGetRuntimeDependenciesTool.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsMacOSMachOGetRuntimeDependenciesTool.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsMacOSMachOLinker.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsMacOSMachOLinker.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsMacOSMachOOToolGetRuntimeDependenciesTool.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsMacOSMachOOToolGetRuntimeDependenciesTool.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsWindowsPEDumpbinGetRuntimeDependenciesTool.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsWindowsPEDumpbinGetRuntimeDependenciesTool.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsWindowsPEGetRuntimeDependenciesTool.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsWindowsPEGetRuntimeDependenciesTool.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsWindowsPELinker.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsWindowsPELinker.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsWindowsPEObjdumpGetRuntimeDependenciesTool.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmBinUtilsWindowsPEObjdumpGetRuntimeDependenciesTool.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmBlockCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmBlockCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmBreakCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmBreakCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmBuildCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmBuildCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmBuildDatabase.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmBuildDatabase.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmBuildSbomBuilder.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmBuildSbomBuilder.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmBuildSbomGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmBuildSbomGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCLocaleEnvironmentScope.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCLocaleEnvironmentScope.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCMakeDiagnosticCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCMakeDiagnosticCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCMakeHostSystemInformationCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCMakeHostSystemInformationCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCMakeLanguageCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCMakeLanguageCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCMakeMinimumRequired.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCMakeMinimumRequired.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCMakePath.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCMakePath.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCMakePathCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCMakePathCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCMakePkgConfigCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCMakePkgConfigCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCMakePolicyCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCMakePolicyCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCMakePresetsErrors.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCMakePresetsErrors.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCMakePresetsGraph.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCMakePresetsGraph.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSON.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSON.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSONBuildPresets.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSONBuildPresets.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSONConfigurePresets.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSONConfigurePresets.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSONPackagePresets.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSONPackagePresets.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSONTestPresets.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSONTestPresets.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSONWorkflowPresets.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphReadJSONWorkflowPresets.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphResolve.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCMakePresetsGraphResolve.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCMakeSarifLogger.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCMakeSarifLogger.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCMakeString.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCMakeString.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCPackPropertiesGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCPackPropertiesGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCacheDocumentationTable.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCacheDocumentationTable.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCacheManager.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCacheManager.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCachePatternTable.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCachePatternTable.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCommands.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCommands.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCommonTargetGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCommonTargetGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCompiledArgument.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCompiledArgument.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmComputeComponentGraph.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmComputeComponentGraph.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmComputeLinkDepends.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmComputeLinkDepends.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmComputeLinkInformation.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmComputeLinkInformation.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmComputeTargetDepends.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmComputeTargetDepends.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmConditionEvaluator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmConditionEvaluator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmConfigureFileCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmConfigureFileCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmConfigureLog.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmConfigureLog.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmContinueCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmContinueCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCoreTryCompile.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCoreTryCompile.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCreateTestSourceList.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCreateTestSourceList.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCryptoHash.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCryptoHash.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCurl.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCurl.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCustomCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCustomCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCustomCommandGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCustomCommandGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCustomCommandLines.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCustomCommandLines.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCxxModuleMapper.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCxxModuleMapper.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCxxModuleMetadata.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCxxModuleMetadata.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmCxxModuleUsageEffects.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmCxxModuleUsageEffects.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerAdapter.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerAdapter.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerBreakpointManager.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerBreakpointManager.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerExceptionManager.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerExceptionManager.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerPosixPipeConnection.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerPosixPipeConnection.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerProtocol.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerProtocol.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerSourceBreakpoint.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerSourceBreakpoint.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerStackFrame.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerStackFrame.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerThread.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerThread.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerThreadManager.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerThreadManager.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerVariables.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerVariables.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerVariablesHelper.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerVariablesHelper.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerVariablesManager.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDebuggerVariablesManager.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDefinePropertyCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDefinePropertyCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDefinitions.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDefinitions.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDepends.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDepends.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDependsC.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDependsC.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDependsCompiler.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDependsCompiler.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDependsFortran.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDependsFortran.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDependsJava.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDependsJava.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDependsJavaParserHelper.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDependsJavaParserHelper.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDiagnosticContext.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDiagnosticContext.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDiagnostics.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDiagnostics.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDiscoverTestsCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDiscoverTestsCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDocumentation.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDocumentation.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDocumentationFormatter.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDocumentationFormatter.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDuration.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDuration.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDyndepCache.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDyndepCache.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmDyndepCollation.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmDyndepCollation.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmELF.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmELF.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmEnableLanguageCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmEnableLanguageCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmEnableTestingCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmEnableTestingCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmEnvironment.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmEnvironment.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmEvaluatedTargetProperty.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmEvaluatedTargetProperty.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExecProgramCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExecProgramCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExecuteProcessCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExecuteProcessCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExpandedCommandArgument.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExpandedCommandArgument.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExperimental.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExperimental.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExportAndroidMKGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExportAndroidMKGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExportBuildAndroidMKGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExportBuildAndroidMKGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExportBuildCMakeConfigGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExportBuildCMakeConfigGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExportBuildFileGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExportBuildFileGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExportBuildPackageInfoGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExportBuildPackageInfoGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExportCMakeConfigGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExportCMakeConfigGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExportCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExportCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExportFileGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExportFileGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExportInstallAndroidMKGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExportInstallAndroidMKGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExportInstallCMakeConfigGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExportInstallCMakeConfigGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExportInstallFileGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExportInstallFileGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExportInstallPackageInfoGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExportInstallPackageInfoGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExportPackageInfoGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExportPackageInfoGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExportSet.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExportSet.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExportTryCompileFileGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExportTryCompileFileGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExprParserHelper.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExprParserHelper.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExternalMakefileProjectGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExternalMakefileProjectGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExtraCodeBlocksGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExtraCodeBlocksGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExtraCodeLiteGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExtraCodeLiteGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExtraEclipseCDT4Generator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExtraEclipseCDT4Generator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExtraKateGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExtraKateGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmExtraSublimeTextGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmExtraSublimeTextGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFLTKWrapUICommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFLTKWrapUICommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFSPermissions.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFSPermissions.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFastbuildLinkLineComputer.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFastbuildLinkLineComputer.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFastbuildNormalTargetGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFastbuildNormalTargetGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFastbuildTargetGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFastbuildTargetGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFastbuildUtilityTargetGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFastbuildUtilityTargetGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFileAPI.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFileAPI.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFileAPICMakeFiles.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFileAPICMakeFiles.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFileAPICache.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFileAPICache.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFileAPICodemodel.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFileAPICodemodel.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFileAPICommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFileAPICommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFileAPIConfigureLog.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFileAPIConfigureLog.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFileAPIToolchains.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFileAPIToolchains.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFileCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFileCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFileCommand_ReadMacho.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFileCommand_ReadMacho.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFileCopier.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFileCopier.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFileInstaller.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFileInstaller.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFileLock.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFileLock.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFileLockPool.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFileLockPool.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFileLockResult.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFileLockResult.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFilePathChecksum.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFilePathChecksum.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFileSet.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFileSet.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFileSetMetadata.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFileSetMetadata.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFileTime.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFileTime.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFileTimeCache.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFileTimeCache.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFileTimes.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFileTimes.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFindBase.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFindBase.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFindCommon.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFindCommon.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFindFileCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFindFileCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFindLibraryCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFindLibraryCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFindPackageCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFindPackageCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFindPackageStack.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFindPackageStack.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFindPathCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFindPathCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFindProgramCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFindProgramCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmForEachCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmForEachCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFortranParserImpl.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFortranParserImpl.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFunctionBlocker.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFunctionBlocker.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmFunctionCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmFunctionCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGccDepfileLexerHelper.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGccDepfileLexerHelper.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGccDepfileReader.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGccDepfileReader.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGenExContext.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGenExContext.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGenExEvaluation.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGenExEvaluation.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGenExMemo.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGenExMemo.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGeneratedFileStream.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGeneratedFileStream.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorExpression.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorExpression.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorExpressionDAGChecker.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorExpressionDAGChecker.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorExpressionEvaluationFile.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorExpressionEvaluationFile.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorExpressionEvaluator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorExpressionEvaluator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorExpressionLexer.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorExpressionLexer.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorExpressionNode.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorExpressionNode.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorExpressionParser.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorExpressionParser.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorFileSet.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorFileSet.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorFileSets.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorFileSets.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorTarget.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorTarget.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorTarget_CompatibleInterface.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorTarget_CompatibleInterface.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorTarget_HeaderSetVerification.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorTarget_HeaderSetVerification.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorTarget_IncludeDirectories.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorTarget_IncludeDirectories.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorTarget_Link.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorTarget_Link.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorTarget_LinkDirectories.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorTarget_LinkDirectories.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorTarget_Options.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorTarget_Options.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorTarget_Sources.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorTarget_Sources.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorTarget_TransitiveProperty.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGeneratorTarget_TransitiveProperty.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGetCMakePropertyCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGetCMakePropertyCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGetDirectoryPropertyCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGetDirectoryPropertyCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGetFilenameComponentCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGetFilenameComponentCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGetPipes.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGetPipes.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGetPropertyCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGetPropertyCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGetSourceFilePropertyCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGetSourceFilePropertyCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGetTargetPropertyCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGetTargetPropertyCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGetTestPropertyCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGetTestPropertyCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGhsMultiGpj.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGhsMultiGpj.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGhsMultiTargetGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGhsMultiTargetGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGlobVerificationManager.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGlobVerificationManager.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGlobalCommonGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGlobalCommonGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGlobalFastbuildGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGlobalFastbuildGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGlobalGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGlobalGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGlobalGhsMultiGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGlobalGhsMultiGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGlobalNinjaGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGlobalNinjaGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGlobalUnixMakefileGenerator3.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGlobalUnixMakefileGenerator3.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGlobalWatcomWMakeGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGlobalWatcomWMakeGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmGraphVizWriter.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmGraphVizWriter.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmHexFileConverter.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmHexFileConverter.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmIfCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmIfCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmImportedCxxModuleInfo.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmImportedCxxModuleInfo.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmIncludeCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmIncludeCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmIncludeDirectoryCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmIncludeDirectoryCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmIncludeExternalMSProjectCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmIncludeExternalMSProjectCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmIncludeGuardCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmIncludeGuardCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmIncludeRegularExpressionCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmIncludeRegularExpressionCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallAndroidMKExportGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallAndroidMKExportGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallCMakeConfigExportGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallCMakeConfigExportGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallCommandArguments.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallCommandArguments.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallCxxModuleBmiGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallCxxModuleBmiGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallDirectoryGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallDirectoryGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallDirs.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallDirs.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallExportGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallExportGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallFileSetGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallFileSetGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallFilesCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallFilesCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallFilesGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallFilesGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallGetRuntimeDependenciesGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallGetRuntimeDependenciesGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallImportedRuntimeArtifactsGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallImportedRuntimeArtifactsGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallPackageInfoExportGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallPackageInfoExportGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallProgramsCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallProgramsCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallRuntimeDependencySet.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallRuntimeDependencySet.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallRuntimeDependencySetGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallRuntimeDependencySetGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallSbomBuilder.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallSbomBuilder.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallSbomGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallSbomGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallScriptGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallScriptGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallScriptHandler.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallScriptHandler.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallSubdirectoryGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallSubdirectoryGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallTargetGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallTargetGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstallTargetsCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstallTargetsCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstalledFile.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstalledFile.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstrumentation.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstrumentation.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstrumentationCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstrumentationCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstrumentationInterrupt.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstrumentationInterrupt.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmInstrumentationQuery.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmInstrumentationQuery.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmJSONHelpers.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmJSONHelpers.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmJSONState.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmJSONState.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmLDConfigLDConfigTool.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmLDConfigLDConfigTool.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmLDConfigTool.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmLDConfigTool.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmLinkDirectoriesCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmLinkDirectoriesCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmLinkItem.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmLinkItem.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmLinkItemGraphVisitor.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmLinkItemGraphVisitor.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmLinkLibrariesCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmLinkLibrariesCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmLinkLineComputer.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmLinkLineComputer.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmLinkLineDeviceComputer.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmLinkLineDeviceComputer.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmList.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmList.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmListCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmListCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmListFileCache.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmListFileCache.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmListFileParseCache.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmListFileParseCache.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmListFilePrefetcher.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmListFilePrefetcher.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmLoadCacheCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmLoadCacheCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmLocalCommonGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmLocalCommonGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmLocalFastbuildGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmLocalFastbuildGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmLocalGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmLocalGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmLocalGhsMultiGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmLocalGhsMultiGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmLocalNinjaGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmLocalNinjaGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmLocalUnixMakefileGenerator3.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmLocalUnixMakefileGenerator3.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmMSVC60LinkLineComputer.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmMSVC60LinkLineComputer.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmMacroCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmMacroCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmMakeDirectoryCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmMakeDirectoryCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmMakefile.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmMakefile.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmMakefileExecutableTargetGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmMakefileExecutableTargetGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmMakefileLibraryTargetGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmMakefileLibraryTargetGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmMakefileProfilingData.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmMakefileProfilingData.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmMakefileTargetGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmMakefileTargetGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmMakefileUtilityTargetGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmMakefileUtilityTargetGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmMappedFile.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmMappedFile.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmMarkAsAdvancedCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmMarkAsAdvancedCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmMathCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmMathCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmMessageCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmMessageCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmMessenger.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmMessenger.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmNewLineStyle.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmNewLineStyle.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmNinjaLinkLineComputer.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmNinjaLinkLineComputer.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmNinjaLinkLineDeviceComputer.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmNinjaLinkLineDeviceComputer.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmNinjaNormalTargetGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmNinjaNormalTargetGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmNinjaOutputQueue.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmNinjaOutputQueue.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmNinjaTargetGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmNinjaTargetGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmNinjaUtilityTargetGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmNinjaUtilityTargetGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmOSXBundleGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmOSXBundleGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmObjectLocation.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmObjectLocation.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmOptionCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmOptionCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmOrderDirectories.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmOrderDirectories.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmOutputConverter.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmOutputConverter.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmPackageInfoArguments.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmPackageInfoArguments.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmPackageInfoReader.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmPackageInfoReader.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmParseArgumentsCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmParseArgumentsCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmPathLabel.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmPathLabel.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmPathResolver.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmPathResolver.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmPkgConfigParser.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmPkgConfigParser.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmPkgConfigResolver.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmPkgConfigResolver.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmPlaceholderExpander.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmPlaceholderExpander.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmPlistParser.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmPlistParser.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmPolicies.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmPolicies.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmProcessOutput.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmProcessOutput.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmProcessTools.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmProcessTools.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmProjectCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmProjectCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmProjectInfoArguments.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmProjectInfoArguments.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmPropertyDefinition.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmPropertyDefinition.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmPropertyMap.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmPropertyMap.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmQTWrapCPPCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmQTWrapCPPCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmQTWrapUICommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmQTWrapUICommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmQtAutoGen.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmQtAutoGen.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmQtAutoGenGlobalInitializer.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmQtAutoGenGlobalInitializer.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmQtAutoGenInitializer.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmQtAutoGenInitializer.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmQtAutoGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmQtAutoGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmQtAutoMocUic.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmQtAutoMocUic.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmQtAutoRcc.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmQtAutoRcc.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmRST.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmRST.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmRegularExpressionCache.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmRegularExpressionCache.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmRemoveCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmRemoveCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmRemoveDefinitionsCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmRemoveDefinitionsCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmReturnCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmReturnCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmRulePlaceholderExpander.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmRulePlaceholderExpander.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmRuntimeDependencyArchive.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmRuntimeDependencyArchive.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmSarif.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmSarif.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmSbomArguments.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmSbomArguments.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmSbomBuilder.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmSbomBuilder.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmScanDepFormat.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmScanDepFormat.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmScriptGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmScriptGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmSearchPath.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmSearchPath.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmSeparateArgumentsCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmSeparateArgumentsCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmSetCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmSetCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmSetDirectoryPropertiesCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmSetDirectoryPropertiesCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmSetPropertyCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmSetPropertyCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmSetSourceFilesPropertiesCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmSetSourceFilesPropertiesCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmSetTargetPropertiesCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmSetTargetPropertiesCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmSetTestsPropertiesCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmSetTestsPropertiesCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmSiteNameCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmSiteNameCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmSourceFile.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmSourceFile.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmSourceFileLocation.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmSourceFileLocation.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmSourceGroup.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmSourceGroup.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmSourceGroupCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmSourceGroupCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmSpdx.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmSpdx.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmSpdxSerializer.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmSpdxSerializer.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmStandardLevelResolver.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmStandardLevelResolver.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmState.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmState.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmStateDirectory.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmStateDirectory.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmStateSnapshot.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmStateSnapshot.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmStdIoConsole.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmStdIoConsole.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmStdIoInit.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmStdIoInit.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmStdIoStream.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmStdIoStream.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmStdIoTerminal.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmStdIoTerminal.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmString.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmString.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmStringAlgorithms.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmStringAlgorithms.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmStringCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmStringCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmStringReplaceHelper.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmStringReplaceHelper.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmSubcommandTable.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmSubcommandTable.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmSubdirCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmSubdirCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmSystemTools.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmSystemTools.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmTarget.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmTarget.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmTargetCompileDefinitionsCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmTargetCompileDefinitionsCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmTargetCompileFeaturesCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmTargetCompileFeaturesCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmTargetCompileOptionsCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmTargetCompileOptionsCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmTargetIncludeDirectoriesCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmTargetIncludeDirectoriesCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmTargetLinkDirectoriesCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmTargetLinkDirectoriesCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmTargetLinkLibrariesCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmTargetLinkLibrariesCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmTargetLinkOptionsCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmTargetLinkOptionsCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmTargetPrecompileHeadersCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmTargetPrecompileHeadersCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmTargetPropCommandBase.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmTargetPropCommandBase.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmTargetPropertyComputer.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmTargetPropertyComputer.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmTargetPropertyEntry.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmTargetPropertyEntry.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmTargetSourcesCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmTargetSourcesCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmTargetTraceDependencies.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmTargetTraceDependencies.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmTest.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmTest.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmTestGenerator.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmTestGenerator.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmTimestamp.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmTimestamp.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmTransformDepfile.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmTransformDepfile.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmTryCompileCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmTryCompileCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmTryRunCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmTryRunCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmUVHandlePtr.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmUVHandlePtr.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmUVProcessChain.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmUVProcessChain.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmUnsetCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmUnsetCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmUuid.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmUuid.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmValue.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmValue.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmVariableWatch.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmVariableWatch.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmVariableWatchCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmVariableWatchCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmVersion.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmVersion.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmVersion_Dependencies.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmVersion_Dependencies.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmWhileCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmWhileCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmWindowsRegistry.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmWindowsRegistry.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmWorkerPool.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmWorkerPool.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmWorkingDirectory.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmWorkingDirectory.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmWriteFileCommand.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmWriteFileCommand.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmXMLParser.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmXMLParser.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmXMLSafe.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmXMLSafe.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmXMLWriter.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmXMLWriter.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cmXcFramework.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmXcFramework.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cm_codecvt.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cm_codecvt.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cm_fileno.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cm_fileno.cxx.o.d"
+  "CMakeFiles/CMakeLib.dir/cm_parse_date.c.o"
+  "CMakeFiles/CMakeLib.dir/cm_parse_date.c.o.d"
+  "CMakeFiles/CMakeLib.dir/cm_utf8.c.o"
+  "CMakeFiles/CMakeLib.dir/cm_utf8.c.o.d"
+  "CMakeFiles/CMakeLib.dir/cmake.cxx.o"
+  "CMakeFiles/CMakeLib.dir/cmake.cxx.o.d"
+  "libCMakeLib.a"
+  "libCMakeLib.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/CMakeLib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
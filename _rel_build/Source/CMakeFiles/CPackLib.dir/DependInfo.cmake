@@ -0,0 +1,52 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/CPack/IFW/cmCPackIFWCommon.cxx" "Source/CMakeFiles/CPackLib.dir/CPack/IFW/cmCPackIFWCommon.cxx.o" "gcc" "Source/CMakeFiles/CPackLib.dir/CPack/IFW/cmCPackIFWCommon.cxx.o.d"
+  "/root/repo/Source/CPack/IFW/cmCPackIFWGenerator.cxx" "Source/CMakeFiles/CPackLib.dir/CPack/IFW/cmCPackIFWGenerator.cxx.o" "gcc" "Source/CMakeFiles/CPackLib.dir/CPack/IFW/cmCPackIFWGenerator.cxx.o.d"
+  "/root/repo/Source/CPack/IFW/cmCPackIFWInstaller.cxx" "Source/CMakeFiles/CPackLib.dir/CPack/IFW/cmCPackIFWInstaller.cxx.o" "gcc" "Source/CMakeFiles/CPackLib.dir/CPack/IFW/cmCPackIFWInstaller.cxx.o.d"
+  "/root/repo/Source/CPack/IFW/cmCPackIFWPackage.cxx" "Source/CMakeFiles/CPackLib.dir/CPack/IFW/cmCPackIFWPackage.cxx.o" "gcc" "Source/CMakeFiles/CPackLib.dir/CPack/IFW/cmCPackIFWPackage.cxx.o.d"
+  "/root/repo/Source/CPack/IFW/cmCPackIFWRepository.cxx" "Source/CMakeFiles/CPackLib.dir/CPack/IFW/cmCPackIFWRepository.cxx.o" "gcc" "Source/CMakeFiles/CPackLib.dir/CPack/IFW/cmCPackIFWRepository.cxx.o.d"
+  "/root/repo/Source/CPack/cmCPackAppImageGenerator.cxx" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackAppImageGenerator.cxx.o" "gcc" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackAppImageGenerator.cxx.o.d"
+  "/root/repo/Source/CPack/cmCPackArchiveGenerator.cxx" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackArchiveGenerator.cxx.o" "gcc" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackArchiveGenerator.cxx.o.d"
+  "/root/repo/Source/CPack/cmCPackComponentGroup.cxx" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackComponentGroup.cxx.o" "gcc" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackComponentGroup.cxx.o.d"
+  "/root/repo/Source/CPack/cmCPackDebGenerator.cxx" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackDebGenerator.cxx.o" "gcc" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackDebGenerator.cxx.o.d"
+  "/root/repo/Source/CPack/cmCPackExternalGenerator.cxx" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackExternalGenerator.cxx.o" "gcc" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackExternalGenerator.cxx.o.d"
+  "/root/repo/Source/CPack/cmCPackGenerator.cxx" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackGenerator.cxx.o" "gcc" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackGenerator.cxx.o.d"
+  "/root/repo/Source/CPack/cmCPackGeneratorFactory.cxx" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackGeneratorFactory.cxx.o" "gcc" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackGeneratorFactory.cxx.o.d"
+  "/root/repo/Source/CPack/cmCPackInnoSetupGenerator.cxx" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackInnoSetupGenerator.cxx.o" "gcc" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackInnoSetupGenerator.cxx.o.d"
+  "/root/repo/Source/CPack/cmCPackLog.cxx" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackLog.cxx.o" "gcc" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackLog.cxx.o.d"
+  "/root/repo/Source/CPack/cmCPackNSISGenerator.cxx" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackNSISGenerator.cxx.o" "gcc" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackNSISGenerator.cxx.o.d"
+  "/root/repo/Source/CPack/cmCPackNuGetGenerator.cxx" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackNuGetGenerator.cxx.o" "gcc" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackNuGetGenerator.cxx.o.d"
+  "/root/repo/Source/CPack/cmCPackRPMGenerator.cxx" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackRPMGenerator.cxx.o" "gcc" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackRPMGenerator.cxx.o.d"
+  "/root/repo/Source/CPack/cmCPackSTGZGenerator.cxx" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackSTGZGenerator.cxx.o" "gcc" "Source/CMakeFiles/CPackLib.dir/CPack/cmCPackSTGZGenerator.cxx.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/Source/CMakeFiles/CMakeLib.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/std/CMakeFiles/cmstd.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Source/kwsys/CMakeFiles/cmsys.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmexpat/CMakeFiles/cmexpat.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmbzip2/CMakeFiles/cmbzip2.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmzstd/CMakeFiles/cmzstd.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmzlib/CMakeFiles/cmzlib.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmllpkgc/CMakeFiles/cmllpkgc.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmjsoncpp/CMakeFiles/cmjsoncpp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
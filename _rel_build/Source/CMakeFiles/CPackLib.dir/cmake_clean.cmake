@@ -0,0 +1,45 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CPackLib.dir/CPack/IFW/cmCPackIFWCommon.cxx.o"
+  "CMakeFiles/CPackLib.dir/CPack/IFW/cmCPackIFWCommon.cxx.o.d"
+  "CMakeFiles/CPackLib.dir/CPack/IFW/cmCPackIFWGenerator.cxx.o"
+  "CMakeFiles/CPackLib.dir/CPack/IFW/cmCPackIFWGenerator.cxx.o.d"
+  "CMakeFiles/CPackLib.dir/CPack/IFW/cmCPackIFWInstaller.cxx.o"
+  "CMakeFiles/CPackLib.dir/CPack/IFW/cmCPackIFWInstaller.cxx.o.d"
+  "CMakeFiles/CPackLib.dir/CPack/IFW/cmCPackIFWPackage.cxx.o"
+  "CMakeFiles/CPackLib.dir/CPack/IFW/cmCPackIFWPackage.cxx.o.d"
+  "CMakeFiles/CPackLib.dir/CPack/IFW/cmCPackIFWRepository.cxx.o"
+  "CMakeFiles/CPackLib.dir/CPack/IFW/cmCPackIFWRepository.cxx.o.d"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackAppImageGenerator.cxx.o"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackAppImageGenerator.cxx.o.d"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackArchiveGenerator.cxx.o"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackArchiveGenerator.cxx.o.d"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackComponentGroup.cxx.o"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackComponentGroup.cxx.o.d"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackDebGenerator.cxx.o"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackDebGenerator.cxx.o.d"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackExternalGenerator.cxx.o"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackExternalGenerator.cxx.o.d"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackGenerator.cxx.o"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackGenerator.cxx.o.d"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackGeneratorFactory.cxx.o"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackGeneratorFactory.cxx.o.d"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackInnoSetupGenerator.cxx.o"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackInnoSetupGenerator.cxx.o.d"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackLog.cxx.o"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackLog.cxx.o.d"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackNSISGenerator.cxx.o"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackNSISGenerator.cxx.o.d"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackNuGetGenerator.cxx.o"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackNuGetGenerator.cxx.o.d"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackRPMGenerator.cxx.o"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackRPMGenerator.cxx.o.d"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackSTGZGenerator.cxx.o"
+  "CMakeFiles/CPackLib.dir/CPack/cmCPackSTGZGenerator.cxx.o.d"
+  "libCPackLib.a"
+  "libCPackLib.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CPackLib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
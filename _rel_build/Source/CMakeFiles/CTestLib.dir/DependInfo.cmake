@@ -0,0 +1,89 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/CTest/cmCTestBZR.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestBZR.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestBZR.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestBinPacker.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestBinPacker.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestBinPacker.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestBuildAndTest.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestBuildAndTest.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestBuildAndTest.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestBuildCommand.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestBuildCommand.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestBuildCommand.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestBuildHandler.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestBuildHandler.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestBuildHandler.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestCVS.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestCVS.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestCVS.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestCommand.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestCommand.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestCommand.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestConfigureCommand.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestConfigureCommand.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestConfigureCommand.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestCoverageCommand.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestCoverageCommand.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestCoverageCommand.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestCoverageHandler.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestCoverageHandler.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestCoverageHandler.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestCurl.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestCurl.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestCurl.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestDiscoverTests.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestDiscoverTests.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestDiscoverTests.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestEmptyBinaryDirectoryCommand.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestEmptyBinaryDirectoryCommand.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestEmptyBinaryDirectoryCommand.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestGIT.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestGIT.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestGIT.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestGenericHandler.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestGenericHandler.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestGenericHandler.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestGlobalVC.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestGlobalVC.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestGlobalVC.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestHG.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestHG.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestHG.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestHandlerCommand.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestHandlerCommand.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestHandlerCommand.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestLaunch.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestLaunch.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestLaunch.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestLaunchReporter.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestLaunchReporter.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestLaunchReporter.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestMemCheckCommand.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestMemCheckCommand.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestMemCheckCommand.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestMemCheckHandler.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestMemCheckHandler.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestMemCheckHandler.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestMultiProcessHandler.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestMultiProcessHandler.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestMultiProcessHandler.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestP4.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestP4.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestP4.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestReadCustomFilesCommand.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestReadCustomFilesCommand.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestReadCustomFilesCommand.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestResourceAllocator.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestResourceAllocator.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestResourceAllocator.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestResourceGroupsLexerHelper.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestResourceGroupsLexerHelper.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestResourceGroupsLexerHelper.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestResourceSpec.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestResourceSpec.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestResourceSpec.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestRunScriptCommand.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestRunScriptCommand.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestRunScriptCommand.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestRunTest.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestRunTest.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestRunTest.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestSVN.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestSVN.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestSVN.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestScriptHandler.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestScriptHandler.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestScriptHandler.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestSleepCommand.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestSleepCommand.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestSleepCommand.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestStartCommand.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestStartCommand.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestStartCommand.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestSubmitCommand.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestSubmitCommand.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestSubmitCommand.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestSubmitHandler.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestSubmitHandler.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestSubmitHandler.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestTestCommand.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestTestCommand.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestTestCommand.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestTestHandler.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestTestHandler.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestTestHandler.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestTestMeasurementXMLParser.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestTestMeasurementXMLParser.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestTestMeasurementXMLParser.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestTypes.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestTypes.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestTypes.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestUpdateCommand.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestUpdateCommand.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestUpdateCommand.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestUploadCommand.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestUploadCommand.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestUploadCommand.cxx.o.d"
+  "/root/repo/Source/CTest/cmCTestVC.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestVC.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmCTestVC.cxx.o.d"
+  "/root/repo/Source/CTest/cmParseBlanketJSCoverage.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmParseBlanketJSCoverage.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmParseBlanketJSCoverage.cxx.o.d"
+  "/root/repo/Source/CTest/cmParseCacheCoverage.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmParseCacheCoverage.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmParseCacheCoverage.cxx.o.d"
+  "/root/repo/Source/CTest/cmParseCoberturaCoverage.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmParseCoberturaCoverage.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmParseCoberturaCoverage.cxx.o.d"
+  "/root/repo/Source/CTest/cmParseDelphiCoverage.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmParseDelphiCoverage.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmParseDelphiCoverage.cxx.o.d"
+  "/root/repo/Source/CTest/cmParseGTMCoverage.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmParseGTMCoverage.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmParseGTMCoverage.cxx.o.d"
+  "/root/repo/Source/CTest/cmParseJacocoCoverage.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmParseJacocoCoverage.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmParseJacocoCoverage.cxx.o.d"
+  "/root/repo/Source/CTest/cmParseMumpsCoverage.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmParseMumpsCoverage.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmParseMumpsCoverage.cxx.o.d"
+  "/root/repo/Source/CTest/cmParsePHPCoverage.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmParsePHPCoverage.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmParsePHPCoverage.cxx.o.d"
+  "/root/repo/Source/CTest/cmProcess.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmProcess.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmProcess.cxx.o.d"
+  "/root/repo/Source/CTest/cmUVJobServerClient.cxx" "Source/CMakeFiles/CTestLib.dir/CTest/cmUVJobServerClient.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/CTest/cmUVJobServerClient.cxx.o.d"
+  "/root/repo/Source/LexerParser/cmCTestResourceGroupsLexer.cxx" "Source/CMakeFiles/CTestLib.dir/LexerParser/cmCTestResourceGroupsLexer.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/LexerParser/cmCTestResourceGroupsLexer.cxx.o.d"
+  "/root/repo/Source/cmCTest.cxx" "Source/CMakeFiles/CTestLib.dir/cmCTest.cxx.o" "gcc" "Source/CMakeFiles/CTestLib.dir/cmCTest.cxx.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/Source/CMakeFiles/CMakeLib.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/std/CMakeFiles/cmstd.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Source/kwsys/CMakeFiles/cmsys.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmexpat/CMakeFiles/cmexpat.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmbzip2/CMakeFiles/cmbzip2.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmzstd/CMakeFiles/cmzstd.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmzlib/CMakeFiles/cmzlib.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmllpkgc/CMakeFiles/cmllpkgc.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmjsoncpp/CMakeFiles/cmjsoncpp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
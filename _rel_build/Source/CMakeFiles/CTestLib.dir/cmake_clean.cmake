@@ -0,0 +1,119 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestBZR.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestBZR.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestBinPacker.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestBinPacker.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestBuildAndTest.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestBuildAndTest.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestBuildCommand.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestBuildCommand.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestBuildHandler.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestBuildHandler.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestCVS.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestCVS.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestCommand.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestCommand.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestConfigureCommand.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestConfigureCommand.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestCoverageCommand.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestCoverageCommand.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestCoverageHandler.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestCoverageHandler.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestCurl.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestCurl.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestDiscoverTests.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestDiscoverTests.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestEmptyBinaryDirectoryCommand.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestEmptyBinaryDirectoryCommand.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestGIT.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestGIT.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestGenericHandler.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestGenericHandler.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestGlobalVC.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestGlobalVC.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestHG.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestHG.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestHandlerCommand.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestHandlerCommand.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestLaunch.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestLaunch.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestLaunchReporter.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestLaunchReporter.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestMemCheckCommand.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestMemCheckCommand.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestMemCheckHandler.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestMemCheckHandler.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestMultiProcessHandler.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestMultiProcessHandler.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestP4.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestP4.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestReadCustomFilesCommand.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestReadCustomFilesCommand.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestResourceAllocator.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestResourceAllocator.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestResourceGroupsLexerHelper.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestResourceGroupsLexerHelper.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestResourceSpec.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestResourceSpec.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestRunScriptCommand.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestRunScriptCommand.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestRunTest.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestRunTest.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestSVN.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestSVN.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestScriptHandler.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestScriptHandler.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestSleepCommand.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestSleepCommand.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestStartCommand.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestStartCommand.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestSubmitCommand.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestSubmitCommand.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestSubmitHandler.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestSubmitHandler.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestTestCommand.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestTestCommand.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestTestHandler.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestTestHandler.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestTestMeasurementXMLParser.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestTestMeasurementXMLParser.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestTypes.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestTypes.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestUpdateCommand.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestUpdateCommand.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestUploadCommand.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestUploadCommand.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestVC.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmCTestVC.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmParseBlanketJSCoverage.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmParseBlanketJSCoverage.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmParseCacheCoverage.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmParseCacheCoverage.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmParseCoberturaCoverage.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmParseCoberturaCoverage.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmParseDelphiCoverage.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmParseDelphiCoverage.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmParseGTMCoverage.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmParseGTMCoverage.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmParseJacocoCoverage.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmParseJacocoCoverage.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmParseMumpsCoverage.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmParseMumpsCoverage.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmParsePHPCoverage.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmParsePHPCoverage.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmProcess.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmProcess.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/CTest/cmUVJobServerClient.cxx.o"
+  "CMakeFiles/CTestLib.dir/CTest/cmUVJobServerClient.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/LexerParser/cmCTestResourceGroupsLexer.cxx.o"
+  "CMakeFiles/CTestLib.dir/LexerParser/cmCTestResourceGroupsLexer.cxx.o.d"
+  "CMakeFiles/CTestLib.dir/cmCTest.cxx.o"
+  "CMakeFiles/CTestLib.dir/cmCTest.cxx.o.d"
+  "libCTestLib.a"
+  "libCTestLib.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CTestLib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/cmCommandHelperServer.cxx" "Source/CMakeFiles/cmake.dir/cmCommandHelperServer.cxx.o" "gcc" "Source/CMakeFiles/cmake.dir/cmCommandHelperServer.cxx.o.d"
+  "/root/repo/Source/cmakemain.cxx" "Source/CMakeFiles/cmake.dir/cmakemain.cxx.o" "gcc" "Source/CMakeFiles/cmake.dir/cmakemain.cxx.o.d"
+  "/root/repo/Source/cmcmd.cxx" "Source/CMakeFiles/cmake.dir/cmcmd.cxx.o" "gcc" "Source/CMakeFiles/cmake.dir/cmcmd.cxx.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/Source/CMakeFiles/CMakeLib.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/std/CMakeFiles/cmstd.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Source/kwsys/CMakeFiles/cmsys.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmexpat/CMakeFiles/cmexpat.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmbzip2/CMakeFiles/cmbzip2.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmzstd/CMakeFiles/cmzstd.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmzlib/CMakeFiles/cmzlib.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmllpkgc/CMakeFiles/cmllpkgc.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmjsoncpp/CMakeFiles/cmjsoncpp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../bin/cmake"
+  "../bin/cmake.pdb"
+  "CMakeFiles/cmake.dir/cmCommandHelperServer.cxx.o"
+  "CMakeFiles/cmake.dir/cmCommandHelperServer.cxx.o.d"
+  "CMakeFiles/cmake.dir/cmakemain.cxx.o"
+  "CMakeFiles/cmake.dir/cmakemain.cxx.o.d"
+  "CMakeFiles/cmake.dir/cmcmd.cxx.o"
+  "CMakeFiles/cmake.dir/cmcmd.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmake.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/cmcmdhelper"
+  "../bin/cmcmdhelper.pdb"
+  "CMakeFiles/cmcmdhelper.dir/cmcmdhelper.cxx.o"
+  "CMakeFiles/cmcmdhelper.dir/cmcmdhelper.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmcmdhelper.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/cpack"
+  "../bin/cpack.pdb"
+  "CMakeFiles/cpack.dir/CPack/cpack.cxx.o"
+  "CMakeFiles/cpack.dir/CPack/cpack.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/ctest"
+  "../bin/ctest.pdb"
+  "CMakeFiles/ctest.dir/ctest.cxx.o"
+  "CMakeFiles/ctest.dir/ctest.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,7 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#pragma once
+
+#define ENABLE_BUILD_WIX_GENERATOR 0
+#define ENABLE_BUILD_FREEBSD_PKG 0
+#define HAVE_CoreServices 0
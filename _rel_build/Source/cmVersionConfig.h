@@ -0,0 +1,10 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#pragma once
+
+#define CMake_VERSION_MAJOR 4
+#define CMake_VERSION_MINOR 4
+#define CMake_VERSION_PATCH 20260807
+#define CMake_VERSION_SUFFIX "g12177bd"
+#define CMake_VERSION_IS_DIRTY 1
+#define CMake_VERSION "4.4.20260807-g12177bd-dirty"
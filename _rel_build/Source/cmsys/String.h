@@ -0,0 +1,132 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file Copyright.txt or https://cmake.org/licensing#kwsys for details.  */
+#ifndef cmsys_String_h
+#define cmsys_String_h
+
+#include <cmsys/Configure.h>
+
+#include <stddef.h> /* size_t */
+
+/* Redefine all public interface symbol names to be in the proper
+   namespace.  These macros are used internally to kwsys only, and are
+   not visible to user code.  Use kwsysHeaderDump.pl to reproduce
+   these macros after making changes to the interface.  */
+#if !defined(KWSYS_NAMESPACE)
+#  define kwsys_ns(x) cmsys##x
+#  define kwsysEXPORT cmsys_EXPORT
+#endif
+#if !cmsys_NAME_IS_KWSYS
+#  define kwsysString_isalnum kwsys_ns(String_isalnum)
+#  define kwsysString_isalpha kwsys_ns(String_isalpha)
+#  define kwsysString_isascii kwsys_ns(String_isascii)
+#  define kwsysString_isblank kwsys_ns(String_isblank)
+#  define kwsysString_iscntrl kwsys_ns(String_iscntrl)
+#  define kwsysString_isdigit kwsys_ns(String_isdigit)
+#  define kwsysString_isgraph kwsys_ns(String_isgraph)
+#  define kwsysString_islower kwsys_ns(String_islower)
+#  define kwsysString_isprint kwsys_ns(String_isprint)
+#  define kwsysString_ispunct kwsys_ns(String_ispunct)
+#  define kwsysString_isspace kwsys_ns(String_isspace)
+#  define kwsysString_isupper kwsys_ns(String_isupper)
+#  define kwsysString_isxdigit kwsys_ns(String_isxdigit)
+#  define kwsysString_tolower kwsys_ns(String_tolower)
+#  define kwsysString_toupper kwsys_ns(String_toupper)
+#  define kwsysString_strcasecmp kwsys_ns(String_strcasecmp)
+#  define kwsysString_strncasecmp kwsys_ns(String_strncasecmp)
+#endif
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/** Locale-independent ASCII isalnum.  */
+kwsysEXPORT int kwsysString_isalnum(char c);
+
+/** Locale-independent ASCII isalpha.  */
+kwsysEXPORT int kwsysString_isalpha(char c);
+
+/** Locale-independent ASCII isascii.  */
+kwsysEXPORT int kwsysString_isascii(char c);
+
+/** Locale-independent ASCII isblank.  */
+kwsysEXPORT int kwsysString_isblank(char c);
+
+/** Locale-independent ASCII iscntrl.  */
+kwsysEXPORT int kwsysString_iscntrl(char c);
+
+/** Locale-independent ASCII isdigit.  */
+kwsysEXPORT int kwsysString_isdigit(char c);
+
+/** Locale-independent ASCII isgraph.  */
+kwsysEXPORT int kwsysString_isgraph(char c);
+
+/** Locale-independent ASCII islower.  */
+kwsysEXPORT int kwsysString_islower(char c);
+
+/** Locale-independent ASCII isprint.  */
+kwsysEXPORT int kwsysString_isprint(char c);
+
+/** Locale-independent ASCII ispunct.  */
+kwsysEXPORT int kwsysString_ispunct(char c);
+
+/** Locale-independent ASCII isspace.  */
+kwsysEXPORT int kwsysString_isspace(char c);
+
+/** Locale-independent ASCII isupper.  */
+kwsysEXPORT int kwsysString_isupper(char c);
+
+/** Locale-independent ASCII isxdigit.  */
+kwsysEXPORT int kwsysString_isxdigit(char c);
+
+/** Locale-independent ASCII tolower.  */
+kwsysEXPORT unsigned char kwsysString_tolower(char c);
+
+/** Locale-independent ASCII toupper.  */
+kwsysEXPORT unsigned char kwsysString_toupper(char c);
+
+/**
+ * Compare two strings ignoring the case of the characters.  The
+ * integer returned is negative, zero, or positive if the first string
+ * is found to be less than, equal to, or greater than the second
+ * string, respectively.
+ */
+kwsysEXPORT int kwsysString_strcasecmp(char const* lhs, char const* rhs);
+
+/**
+ * Identical to String_strcasecmp except that only the first n
+ * characters are considered.
+ */
+kwsysEXPORT int kwsysString_strncasecmp(char const* lhs, char const* rhs,
+                                        size_t n);
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif
+
+/* If we are building a kwsys .c or .cxx file, let it use these macros.
+   Otherwise, undefine them to keep the namespace clean.  */
+#if !defined(KWSYS_NAMESPACE)
+#  undef kwsys_ns
+#  undef kwsysEXPORT
+#  if !cmsys_NAME_IS_KWSYS
+#    undef kwsysString_isalnum
+#    undef kwsysString_isalpha
+#    undef kwsysString_isascii
+#    undef kwsysString_isblank
+#    undef kwsysString_iscntrl
+#    undef kwsysString_isdigit
+#    undef kwsysString_isgraph
+#    undef kwsysString_islower
+#    undef kwsysString_isprint
+#    undef kwsysString_ispunct
+#    undef kwsysString_isspace
+#    undef kwsysString_isupper
+#    undef kwsysString_isxdigit
+#    undef kwsysString_tolower
+#    undef kwsysString_toupper
+#    undef kwsysString_strcasecmp
+#    undef kwsysString_strncasecmp
+#  endif
+#endif
+
+#endif
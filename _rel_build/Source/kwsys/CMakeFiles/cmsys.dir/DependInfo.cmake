@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/kwsys/Base64.c" "Source/kwsys/CMakeFiles/cmsys.dir/Base64.c.o" "gcc" "Source/kwsys/CMakeFiles/cmsys.dir/Base64.c.o.d"
+  "/root/repo/Source/kwsys/EncodingC.c" "Source/kwsys/CMakeFiles/cmsys.dir/EncodingC.c.o" "gcc" "Source/kwsys/CMakeFiles/cmsys.dir/EncodingC.c.o.d"
+  "/root/repo/Source/kwsys/MD5.c" "Source/kwsys/CMakeFiles/cmsys.dir/MD5.c.o" "gcc" "Source/kwsys/CMakeFiles/cmsys.dir/MD5.c.o.d"
+  "/root/repo/Source/kwsys/ProcessUNIX.c" "Source/kwsys/CMakeFiles/cmsys.dir/ProcessUNIX.c.o" "gcc" "Source/kwsys/CMakeFiles/cmsys.dir/ProcessUNIX.c.o.d"
+  "/root/repo/Source/kwsys/String.c" "Source/kwsys/CMakeFiles/cmsys.dir/String.c.o" "gcc" "Source/kwsys/CMakeFiles/cmsys.dir/String.c.o.d"
+  "/root/repo/Source/kwsys/System.c" "Source/kwsys/CMakeFiles/cmsys.dir/System.c.o" "gcc" "Source/kwsys/CMakeFiles/cmsys.dir/System.c.o.d"
+  "/root/repo/Source/kwsys/CommandLineArguments.cxx" "Source/kwsys/CMakeFiles/cmsys.dir/CommandLineArguments.cxx.o" "gcc" "Source/kwsys/CMakeFiles/cmsys.dir/CommandLineArguments.cxx.o.d"
+  "/root/repo/Source/kwsys/Directory.cxx" "Source/kwsys/CMakeFiles/cmsys.dir/Directory.cxx.o" "gcc" "Source/kwsys/CMakeFiles/cmsys.dir/Directory.cxx.o.d"
+  "/root/repo/Source/kwsys/DynamicLoader.cxx" "Source/kwsys/CMakeFiles/cmsys.dir/DynamicLoader.cxx.o" "gcc" "Source/kwsys/CMakeFiles/cmsys.dir/DynamicLoader.cxx.o.d"
+  "/root/repo/Source/kwsys/EncodingCXX.cxx" "Source/kwsys/CMakeFiles/cmsys.dir/EncodingCXX.cxx.o" "gcc" "Source/kwsys/CMakeFiles/cmsys.dir/EncodingCXX.cxx.o.d"
+  "/root/repo/Source/kwsys/FStream.cxx" "Source/kwsys/CMakeFiles/cmsys.dir/FStream.cxx.o" "gcc" "Source/kwsys/CMakeFiles/cmsys.dir/FStream.cxx.o.d"
+  "/root/repo/Source/kwsys/Glob.cxx" "Source/kwsys/CMakeFiles/cmsys.dir/Glob.cxx.o" "gcc" "Source/kwsys/CMakeFiles/cmsys.dir/Glob.cxx.o.d"
+  "/root/repo/Source/kwsys/RegularExpression.cxx" "Source/kwsys/CMakeFiles/cmsys.dir/RegularExpression.cxx.o" "gcc" "Source/kwsys/CMakeFiles/cmsys.dir/RegularExpression.cxx.o.d"
+  "/root/repo/Source/kwsys/Status.cxx" "Source/kwsys/CMakeFiles/cmsys.dir/Status.cxx.o" "gcc" "Source/kwsys/CMakeFiles/cmsys.dir/Status.cxx.o.d"
+  "/root/repo/Source/kwsys/SystemInformation.cxx" "Source/kwsys/CMakeFiles/cmsys.dir/SystemInformation.cxx.o" "gcc" "Source/kwsys/CMakeFiles/cmsys.dir/SystemInformation.cxx.o.d"
+  "/root/repo/Source/kwsys/SystemTools.cxx" "Source/kwsys/CMakeFiles/cmsys.dir/SystemTools.cxx.o" "gcc" "Source/kwsys/CMakeFiles/cmsys.dir/SystemTools.cxx.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,41 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmsys.dir/Base64.c.o"
+  "CMakeFiles/cmsys.dir/Base64.c.o.d"
+  "CMakeFiles/cmsys.dir/CommandLineArguments.cxx.o"
+  "CMakeFiles/cmsys.dir/CommandLineArguments.cxx.o.d"
+  "CMakeFiles/cmsys.dir/Directory.cxx.o"
+  "CMakeFiles/cmsys.dir/Directory.cxx.o.d"
+  "CMakeFiles/cmsys.dir/DynamicLoader.cxx.o"
+  "CMakeFiles/cmsys.dir/DynamicLoader.cxx.o.d"
+  "CMakeFiles/cmsys.dir/EncodingC.c.o"
+  "CMakeFiles/cmsys.dir/EncodingC.c.o.d"
+  "CMakeFiles/cmsys.dir/EncodingCXX.cxx.o"
+  "CMakeFiles/cmsys.dir/EncodingCXX.cxx.o.d"
+  "CMakeFiles/cmsys.dir/FStream.cxx.o"
+  "CMakeFiles/cmsys.dir/FStream.cxx.o.d"
+  "CMakeFiles/cmsys.dir/Glob.cxx.o"
+  "CMakeFiles/cmsys.dir/Glob.cxx.o.d"
+  "CMakeFiles/cmsys.dir/MD5.c.o"
+  "CMakeFiles/cmsys.dir/MD5.c.o.d"
+  "CMakeFiles/cmsys.dir/ProcessUNIX.c.o"
+  "CMakeFiles/cmsys.dir/ProcessUNIX.c.o.d"
+  "CMakeFiles/cmsys.dir/RegularExpression.cxx.o"
+  "CMakeFiles/cmsys.dir/RegularExpression.cxx.o.d"
+  "CMakeFiles/cmsys.dir/Status.cxx.o"
+  "CMakeFiles/cmsys.dir/Status.cxx.o.d"
+  "CMakeFiles/cmsys.dir/String.c.o"
+  "CMakeFiles/cmsys.dir/String.c.o.d"
+  "CMakeFiles/cmsys.dir/System.c.o"
+  "CMakeFiles/cmsys.dir/System.c.o.d"
+  "CMakeFiles/cmsys.dir/SystemInformation.cxx.o"
+  "CMakeFiles/cmsys.dir/SystemInformation.cxx.o.d"
+  "CMakeFiles/cmsys.dir/SystemTools.cxx.o"
+  "CMakeFiles/cmsys.dir/SystemTools.cxx.o.d"
+  "libcmsys.a"
+  "libcmsys.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/cmsys.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
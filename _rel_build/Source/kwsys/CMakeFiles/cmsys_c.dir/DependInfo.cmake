@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/kwsys/Base64.c" "Source/kwsys/CMakeFiles/cmsys_c.dir/Base64.c.o" "gcc" "Source/kwsys/CMakeFiles/cmsys_c.dir/Base64.c.o.d"
+  "/root/repo/Source/kwsys/EncodingC.c" "Source/kwsys/CMakeFiles/cmsys_c.dir/EncodingC.c.o" "gcc" "Source/kwsys/CMakeFiles/cmsys_c.dir/EncodingC.c.o.d"
+  "/root/repo/Source/kwsys/MD5.c" "Source/kwsys/CMakeFiles/cmsys_c.dir/MD5.c.o" "gcc" "Source/kwsys/CMakeFiles/cmsys_c.dir/MD5.c.o.d"
+  "/root/repo/Source/kwsys/ProcessUNIX.c" "Source/kwsys/CMakeFiles/cmsys_c.dir/ProcessUNIX.c.o" "gcc" "Source/kwsys/CMakeFiles/cmsys_c.dir/ProcessUNIX.c.o.d"
+  "/root/repo/Source/kwsys/String.c" "Source/kwsys/CMakeFiles/cmsys_c.dir/String.c.o" "gcc" "Source/kwsys/CMakeFiles/cmsys_c.dir/String.c.o.d"
+  "/root/repo/Source/kwsys/System.c" "Source/kwsys/CMakeFiles/cmsys_c.dir/System.c.o" "gcc" "Source/kwsys/CMakeFiles/cmsys_c.dir/System.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
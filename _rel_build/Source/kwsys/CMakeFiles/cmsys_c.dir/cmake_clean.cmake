@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmsys_c.dir/Base64.c.o"
+  "CMakeFiles/cmsys_c.dir/Base64.c.o.d"
+  "CMakeFiles/cmsys_c.dir/EncodingC.c.o"
+  "CMakeFiles/cmsys_c.dir/EncodingC.c.o.d"
+  "CMakeFiles/cmsys_c.dir/MD5.c.o"
+  "CMakeFiles/cmsys_c.dir/MD5.c.o.d"
+  "CMakeFiles/cmsys_c.dir/ProcessUNIX.c.o"
+  "CMakeFiles/cmsys_c.dir/ProcessUNIX.c.o.d"
+  "CMakeFiles/cmsys_c.dir/String.c.o"
+  "CMakeFiles/cmsys_c.dir/String.c.o.d"
+  "CMakeFiles/cmsys_c.dir/System.c.o"
+  "CMakeFiles/cmsys_c.dir/System.c.o.d"
+  "libcmsys_c.a"
+  "libcmsys_c.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cmsys_c.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
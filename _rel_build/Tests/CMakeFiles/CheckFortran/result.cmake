@@ -0,0 +1,4 @@
+set(CMAKE_Fortran_COMPILER "/usr/bin/f95")
+set(CMAKE_Fortran_COMPILER_ID "GNU")
+set(CMAKE_Fortran_FLAGS "")
+set(CMAKE_Fortran_COMPILER_SUPPORTS_F90 "1")
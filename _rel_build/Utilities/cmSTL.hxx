@@ -0,0 +1,7 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#pragma once
+
+/* Whether CMake is using its own STL implementation.  */
+#define CMake_HAVE_CXX_MAKE_UNIQUE
+#define CMake_HAVE_CXX_FILESYSTEM
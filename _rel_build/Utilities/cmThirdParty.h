@@ -0,0 +1,22 @@
+/* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+   file LICENSE.rst or https://cmake.org/licensing for details.  */
+#pragma once
+
+/* Whether CMake is using its own utility libraries.  */
+/* #undef CMAKE_USE_SYSTEM_CPPDAP */
+/* #undef CMAKE_USE_SYSTEM_CURL */
+/* #undef CMAKE_USE_SYSTEM_EXPAT */
+/* #undef CMAKE_USE_SYSTEM_KWIML */
+/* #undef CMAKE_USE_SYSTEM_ZLIB */
+/* #undef CMAKE_USE_SYSTEM_BZIP2 */
+/* #undef CMAKE_USE_SYSTEM_LIBARCHIVE */
+/* #undef CMAKE_USE_SYSTEM_LIBLZMA */
+/* #undef CMAKE_USE_SYSTEM_FORM */
+/* #undef CMAKE_USE_SYSTEM_JSONCPP */
+/* #undef CMAKE_USE_SYSTEM_LIBRHASH */
+/* #undef CMAKE_USE_SYSTEM_LIBUV */
+/* #undef CMAKE_USE_SYSTEM_ZSTD */
+/* #undef CMAKE_USE_SYSTEM_NGHTTP2 */
+
+/* Whether CMake is using OpenSSL library.  */
+/* #undef CMAKE_USE_OPENSSL */
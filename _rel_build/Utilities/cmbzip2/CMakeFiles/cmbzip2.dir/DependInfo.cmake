@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Utilities/cmbzip2/blocksort.c" "Utilities/cmbzip2/CMakeFiles/cmbzip2.dir/blocksort.c.o" "gcc" "Utilities/cmbzip2/CMakeFiles/cmbzip2.dir/blocksort.c.o.d"
+  "/root/repo/Utilities/cmbzip2/bzlib.c" "Utilities/cmbzip2/CMakeFiles/cmbzip2.dir/bzlib.c.o" "gcc" "Utilities/cmbzip2/CMakeFiles/cmbzip2.dir/bzlib.c.o.d"
+  "/root/repo/Utilities/cmbzip2/compress.c" "Utilities/cmbzip2/CMakeFiles/cmbzip2.dir/compress.c.o" "gcc" "Utilities/cmbzip2/CMakeFiles/cmbzip2.dir/compress.c.o.d"
+  "/root/repo/Utilities/cmbzip2/crctable.c" "Utilities/cmbzip2/CMakeFiles/cmbzip2.dir/crctable.c.o" "gcc" "Utilities/cmbzip2/CMakeFiles/cmbzip2.dir/crctable.c.o.d"
+  "/root/repo/Utilities/cmbzip2/decompress.c" "Utilities/cmbzip2/CMakeFiles/cmbzip2.dir/decompress.c.o" "gcc" "Utilities/cmbzip2/CMakeFiles/cmbzip2.dir/decompress.c.o.d"
+  "/root/repo/Utilities/cmbzip2/huffman.c" "Utilities/cmbzip2/CMakeFiles/cmbzip2.dir/huffman.c.o" "gcc" "Utilities/cmbzip2/CMakeFiles/cmbzip2.dir/huffman.c.o.d"
+  "/root/repo/Utilities/cmbzip2/randtable.c" "Utilities/cmbzip2/CMakeFiles/cmbzip2.dir/randtable.c.o" "gcc" "Utilities/cmbzip2/CMakeFiles/cmbzip2.dir/randtable.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmbzip2.dir/blocksort.c.o"
+  "CMakeFiles/cmbzip2.dir/blocksort.c.o.d"
+  "CMakeFiles/cmbzip2.dir/bzlib.c.o"
+  "CMakeFiles/cmbzip2.dir/bzlib.c.o.d"
+  "CMakeFiles/cmbzip2.dir/compress.c.o"
+  "CMakeFiles/cmbzip2.dir/compress.c.o.d"
+  "CMakeFiles/cmbzip2.dir/crctable.c.o"
+  "CMakeFiles/cmbzip2.dir/crctable.c.o.d"
+  "CMakeFiles/cmbzip2.dir/decompress.c.o"
+  "CMakeFiles/cmbzip2.dir/decompress.c.o.d"
+  "CMakeFiles/cmbzip2.dir/huffman.c.o"
+  "CMakeFiles/cmbzip2.dir/huffman.c.o.d"
+  "CMakeFiles/cmbzip2.dir/randtable.c.o"
+  "CMakeFiles/cmbzip2.dir/randtable.c.o.d"
+  "libcmbzip2.a"
+  "libcmbzip2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cmbzip2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Utilities/cmcppdap/src/content_stream.cpp" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/content_stream.cpp.o" "gcc" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/content_stream.cpp.o.d"
+  "/root/repo/Utilities/cmcppdap/src/io.cpp" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/io.cpp.o" "gcc" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/io.cpp.o.d"
+  "/root/repo/Utilities/cmcppdap/src/jsoncpp_json_serializer.cpp" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/jsoncpp_json_serializer.cpp.o" "gcc" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/jsoncpp_json_serializer.cpp.o.d"
+  "/root/repo/Utilities/cmcppdap/src/network.cpp" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/network.cpp.o" "gcc" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/network.cpp.o.d"
+  "/root/repo/Utilities/cmcppdap/src/null_json_serializer.cpp" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/null_json_serializer.cpp.o" "gcc" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/null_json_serializer.cpp.o.d"
+  "/root/repo/Utilities/cmcppdap/src/protocol_events.cpp" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/protocol_events.cpp.o" "gcc" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/protocol_events.cpp.o.d"
+  "/root/repo/Utilities/cmcppdap/src/protocol_requests.cpp" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/protocol_requests.cpp.o" "gcc" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/protocol_requests.cpp.o.d"
+  "/root/repo/Utilities/cmcppdap/src/protocol_response.cpp" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/protocol_response.cpp.o" "gcc" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/protocol_response.cpp.o.d"
+  "/root/repo/Utilities/cmcppdap/src/protocol_types.cpp" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/protocol_types.cpp.o" "gcc" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/protocol_types.cpp.o.d"
+  "/root/repo/Utilities/cmcppdap/src/session.cpp" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/session.cpp.o" "gcc" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/session.cpp.o.d"
+  "/root/repo/Utilities/cmcppdap/src/socket.cpp" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/socket.cpp.o" "gcc" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/socket.cpp.o.d"
+  "/root/repo/Utilities/cmcppdap/src/typeinfo.cpp" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/typeinfo.cpp.o" "gcc" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/typeinfo.cpp.o.d"
+  "/root/repo/Utilities/cmcppdap/src/typeof.cpp" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/typeof.cpp.o" "gcc" "Utilities/cmcppdap/CMakeFiles/cmcppdap.dir/src/typeof.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/Utilities/cmjsoncpp/CMakeFiles/cmjsoncpp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
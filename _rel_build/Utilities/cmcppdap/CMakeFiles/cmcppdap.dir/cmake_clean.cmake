@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmcppdap.dir/src/content_stream.cpp.o"
+  "CMakeFiles/cmcppdap.dir/src/content_stream.cpp.o.d"
+  "CMakeFiles/cmcppdap.dir/src/io.cpp.o"
+  "CMakeFiles/cmcppdap.dir/src/io.cpp.o.d"
+  "CMakeFiles/cmcppdap.dir/src/jsoncpp_json_serializer.cpp.o"
+  "CMakeFiles/cmcppdap.dir/src/jsoncpp_json_serializer.cpp.o.d"
+  "CMakeFiles/cmcppdap.dir/src/network.cpp.o"
+  "CMakeFiles/cmcppdap.dir/src/network.cpp.o.d"
+  "CMakeFiles/cmcppdap.dir/src/null_json_serializer.cpp.o"
+  "CMakeFiles/cmcppdap.dir/src/null_json_serializer.cpp.o.d"
+  "CMakeFiles/cmcppdap.dir/src/protocol_events.cpp.o"
+  "CMakeFiles/cmcppdap.dir/src/protocol_events.cpp.o.d"
+  "CMakeFiles/cmcppdap.dir/src/protocol_requests.cpp.o"
+  "CMakeFiles/cmcppdap.dir/src/protocol_requests.cpp.o.d"
+  "CMakeFiles/cmcppdap.dir/src/protocol_response.cpp.o"
+  "CMakeFiles/cmcppdap.dir/src/protocol_response.cpp.o.d"
+  "CMakeFiles/cmcppdap.dir/src/protocol_types.cpp.o"
+  "CMakeFiles/cmcppdap.dir/src/protocol_types.cpp.o.d"
+  "CMakeFiles/cmcppdap.dir/src/session.cpp.o"
+  "CMakeFiles/cmcppdap.dir/src/session.cpp.o.d"
+  "CMakeFiles/cmcppdap.dir/src/socket.cpp.o"
+  "CMakeFiles/cmcppdap.dir/src/socket.cpp.o.d"
+  "CMakeFiles/cmcppdap.dir/src/typeinfo.cpp.o"
+  "CMakeFiles/cmcppdap.dir/src/typeinfo.cpp.o.d"
+  "CMakeFiles/cmcppdap.dir/src/typeof.cpp.o"
+  "CMakeFiles/cmcppdap.dir/src/typeof.cpp.o.d"
+  "libcmcppdap.a"
+  "libcmcppdap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmcppdap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curltest.dir/curltest.c.o"
+  "CMakeFiles/curltest.dir/curltest.c.o.d"
+  "curltest"
+  "curltest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curltest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
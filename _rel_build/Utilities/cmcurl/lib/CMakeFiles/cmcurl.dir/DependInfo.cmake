@@ -0,0 +1,212 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Utilities/cmcurl/lib/altsvc.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/altsvc.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/altsvc.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/amigaos.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/amigaos.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/amigaos.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/asyn-ares.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/asyn-ares.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/asyn-ares.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/asyn-base.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/asyn-base.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/asyn-base.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/asyn-thrdd.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/asyn-thrdd.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/asyn-thrdd.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/bufq.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/bufq.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/bufq.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/bufref.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/bufref.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/bufref.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/cf-dns.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cf-dns.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cf-dns.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/cf-h1-proxy.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cf-h1-proxy.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cf-h1-proxy.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/cf-h2-proxy.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cf-h2-proxy.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cf-h2-proxy.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/cf-haproxy.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cf-haproxy.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cf-haproxy.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/cf-https-connect.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cf-https-connect.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cf-https-connect.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/cf-ip-happy.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cf-ip-happy.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cf-ip-happy.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/cf-recvbuf.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cf-recvbuf.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cf-recvbuf.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/cf-setup.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cf-setup.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cf-setup.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/cf-socket.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cf-socket.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cf-socket.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/cfilters.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cfilters.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cfilters.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/conncache.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/conncache.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/conncache.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/connect.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/connect.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/connect.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/content_encoding.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/content_encoding.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/content_encoding.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/cookie.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cookie.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cookie.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/creds.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/creds.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/creds.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/cshutdn.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cshutdn.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cshutdn.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curl_addrinfo.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_addrinfo.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_addrinfo.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curl_endian.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_endian.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_endian.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curl_fnmatch.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_fnmatch.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_fnmatch.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curl_fopen.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_fopen.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_fopen.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curl_get_line.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_get_line.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_get_line.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curl_gethostname.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_gethostname.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_gethostname.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curl_gssapi.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_gssapi.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_gssapi.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curl_memrchr.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_memrchr.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_memrchr.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curl_ntlm_core.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_ntlm_core.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_ntlm_core.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curl_range.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_range.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_range.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curl_sasl.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_sasl.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_sasl.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curl_sha512_256.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_sha512_256.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_sha512_256.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curl_share.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_share.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_share.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curl_sspi.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_sspi.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_sspi.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curl_threads.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_threads.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_threads.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curl_trc.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_trc.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curl_trc.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curlx/base64.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/base64.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/base64.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curlx/basename.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/basename.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/basename.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curlx/dynbuf.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/dynbuf.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/dynbuf.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curlx/fopen.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/fopen.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/fopen.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curlx/inet_ntop.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/inet_ntop.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/inet_ntop.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curlx/inet_pton.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/inet_pton.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/inet_pton.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curlx/multibyte.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/multibyte.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/multibyte.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curlx/nonblock.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/nonblock.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/nonblock.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curlx/snprintf.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/snprintf.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/snprintf.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curlx/strcopy.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/strcopy.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/strcopy.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curlx/strdup.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/strdup.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/strdup.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curlx/strerr.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/strerr.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/strerr.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curlx/strparse.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/strparse.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/strparse.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curlx/timediff.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/timediff.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/timediff.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curlx/timeval.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/timeval.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/timeval.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curlx/version_win32.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/version_win32.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/version_win32.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curlx/wait.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/wait.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/wait.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curlx/warnless.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/warnless.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/warnless.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/curlx/winapi.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/winapi.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/curlx/winapi.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/cw-out.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cw-out.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cw-out.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/cw-pause.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cw-pause.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/cw-pause.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/dict.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/dict.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/dict.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/dnscache.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/dnscache.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/dnscache.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/doh.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/doh.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/doh.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/dynhds.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/dynhds.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/dynhds.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/easy.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/easy.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/easy.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/easygetopt.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/easygetopt.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/easygetopt.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/easyoptions.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/easyoptions.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/easyoptions.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/escape.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/escape.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/escape.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/fake_addrinfo.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/fake_addrinfo.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/fake_addrinfo.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/file.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/file.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/file.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/fileinfo.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/fileinfo.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/fileinfo.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/formdata.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/formdata.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/formdata.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/ftp.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/ftp.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/ftp.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/ftplistparser.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/ftplistparser.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/ftplistparser.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/getenv.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/getenv.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/getenv.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/getinfo.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/getinfo.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/getinfo.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/gopher.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/gopher.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/gopher.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/hash.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/hash.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/hash.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/headers.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/headers.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/headers.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/hmac.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/hmac.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/hmac.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/hostip.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/hostip.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/hostip.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/hostip4.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/hostip4.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/hostip4.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/hostip6.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/hostip6.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/hostip6.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/hsts.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/hsts.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/hsts.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/http.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/http.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/http.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/http1.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/http1.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/http1.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/http2.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/http2.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/http2.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/http_aws_sigv4.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/http_aws_sigv4.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/http_aws_sigv4.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/http_chunks.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/http_chunks.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/http_chunks.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/http_digest.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/http_digest.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/http_digest.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/http_negotiate.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/http_negotiate.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/http_negotiate.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/http_ntlm.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/http_ntlm.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/http_ntlm.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/http_proxy.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/http_proxy.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/http_proxy.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/httpsrr.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/httpsrr.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/httpsrr.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/idn.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/idn.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/idn.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/if2ip.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/if2ip.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/if2ip.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/imap.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/imap.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/imap.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/ldap.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/ldap.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/ldap.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/llist.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/llist.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/llist.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/macos.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/macos.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/macos.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/md4.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/md4.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/md4.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/md5.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/md5.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/md5.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/memdebug.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/memdebug.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/memdebug.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/mime.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/mime.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/mime.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/mprintf.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/mprintf.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/mprintf.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/mqtt.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/mqtt.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/mqtt.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/multi.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/multi.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/multi.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/multi_ev.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/multi_ev.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/multi_ev.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/multi_ntfy.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/multi_ntfy.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/multi_ntfy.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/netrc.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/netrc.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/netrc.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/openldap.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/openldap.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/openldap.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/parsedate.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/parsedate.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/parsedate.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/peer.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/peer.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/peer.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/pingpong.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/pingpong.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/pingpong.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/pop3.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/pop3.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/pop3.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/progress.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/progress.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/progress.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/protocol.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/protocol.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/protocol.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/proxy.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/proxy.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/proxy.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/psl.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/psl.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/psl.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/rand.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/rand.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/rand.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/ratelimit.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/ratelimit.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/ratelimit.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/request.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/request.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/request.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/rtsp.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/rtsp.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/rtsp.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/select.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/select.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/select.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/sendf.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/sendf.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/sendf.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/setopt.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/setopt.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/setopt.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/sha256.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/sha256.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/sha256.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/slist.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/slist.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/slist.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/smb.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/smb.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/smb.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/smtp.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/smtp.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/smtp.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/socketpair.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/socketpair.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/socketpair.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/socks.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/socks.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/socks.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/socks_gssapi.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/socks_gssapi.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/socks_gssapi.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/socks_sspi.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/socks_sspi.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/socks_sspi.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/splay.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/splay.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/splay.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/strcase.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/strcase.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/strcase.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/strequal.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/strequal.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/strequal.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/strerror.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/strerror.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/strerror.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/system_win32.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/system_win32.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/system_win32.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/telnet.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/telnet.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/telnet.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/tftp.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/tftp.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/tftp.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/thrdpool.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/thrdpool.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/thrdpool.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/thrdqueue.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/thrdqueue.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/thrdqueue.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/transfer.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/transfer.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/transfer.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/uint-bset.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/uint-bset.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/uint-bset.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/uint-hash.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/uint-hash.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/uint-hash.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/uint-spbset.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/uint-spbset.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/uint-spbset.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/uint-table.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/uint-table.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/uint-table.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/url.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/url.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/url.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/urlapi.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/urlapi.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/urlapi.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vauth/cleartext.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/cleartext.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/cleartext.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vauth/cram.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/cram.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/cram.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vauth/digest.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/digest.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/digest.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vauth/digest_sspi.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/digest_sspi.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/digest_sspi.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vauth/gsasl.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/gsasl.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/gsasl.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vauth/krb5_gssapi.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/krb5_gssapi.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/krb5_gssapi.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vauth/krb5_sspi.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/krb5_sspi.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/krb5_sspi.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vauth/ntlm.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/ntlm.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/ntlm.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vauth/ntlm_sspi.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/ntlm_sspi.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/ntlm_sspi.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vauth/oauth2.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/oauth2.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/oauth2.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vauth/spnego_gssapi.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/spnego_gssapi.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/spnego_gssapi.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vauth/spnego_sspi.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/spnego_sspi.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/spnego_sspi.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vauth/vauth.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/vauth.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vauth/vauth.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/version.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/version.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/version.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vquic/capsule.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vquic/capsule.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vquic/capsule.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vquic/cf-capsule.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vquic/cf-capsule.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vquic/cf-capsule.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vquic/cf-ngtcp2-cmn.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vquic/cf-ngtcp2-cmn.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vquic/cf-ngtcp2-cmn.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vquic/cf-ngtcp2-proxy.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vquic/cf-ngtcp2-proxy.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vquic/cf-ngtcp2-proxy.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vquic/cf-ngtcp2.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vquic/cf-ngtcp2.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vquic/cf-ngtcp2.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vquic/cf-quiche.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vquic/cf-quiche.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vquic/cf-quiche.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vquic/vquic-tls.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vquic/vquic-tls.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vquic/vquic-tls.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vquic/vquic.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vquic/vquic.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vquic/vquic.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vssh/libssh.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vssh/libssh.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vssh/libssh.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vssh/libssh2.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vssh/libssh2.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vssh/libssh2.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vssh/vssh.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vssh/vssh.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vssh/vssh.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vtls/apple.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/apple.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/apple.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vtls/cipher_suite.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/cipher_suite.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/cipher_suite.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vtls/gtls.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/gtls.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/gtls.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vtls/hostcheck.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/hostcheck.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/hostcheck.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vtls/keylog.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/keylog.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/keylog.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vtls/mbedtls.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/mbedtls.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/mbedtls.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vtls/openssl.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/openssl.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/openssl.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vtls/rustls.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/rustls.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/rustls.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vtls/schannel.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/schannel.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/schannel.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vtls/schannel_verify.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/schannel_verify.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/schannel_verify.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vtls/vtls.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/vtls.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/vtls.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vtls/vtls_config.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/vtls_config.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/vtls_config.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vtls/vtls_scache.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/vtls_scache.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/vtls_scache.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vtls/vtls_spack.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/vtls_spack.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/vtls_spack.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vtls/wolfssl.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/wolfssl.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/wolfssl.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/vtls/x509asn1.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/x509asn1.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/vtls/x509asn1.c.o.d"
+  "/root/repo/Utilities/cmcurl/lib/ws.c" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/ws.c.o" "gcc" "Utilities/cmcurl/lib/CMakeFiles/cmcurl.dir/ws.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/Utilities/cmzlib/CMakeFiles/cmzlib.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,393 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmcurl.dir/altsvc.c.o"
+  "CMakeFiles/cmcurl.dir/altsvc.c.o.d"
+  "CMakeFiles/cmcurl.dir/amigaos.c.o"
+  "CMakeFiles/cmcurl.dir/amigaos.c.o.d"
+  "CMakeFiles/cmcurl.dir/asyn-ares.c.o"
+  "CMakeFiles/cmcurl.dir/asyn-ares.c.o.d"
+  "CMakeFiles/cmcurl.dir/asyn-base.c.o"
+  "CMakeFiles/cmcurl.dir/asyn-base.c.o.d"
+  "CMakeFiles/cmcurl.dir/asyn-thrdd.c.o"
+  "CMakeFiles/cmcurl.dir/asyn-thrdd.c.o.d"
+  "CMakeFiles/cmcurl.dir/bufq.c.o"
+  "CMakeFiles/cmcurl.dir/bufq.c.o.d"
+  "CMakeFiles/cmcurl.dir/bufref.c.o"
+  "CMakeFiles/cmcurl.dir/bufref.c.o.d"
+  "CMakeFiles/cmcurl.dir/cf-dns.c.o"
+  "CMakeFiles/cmcurl.dir/cf-dns.c.o.d"
+  "CMakeFiles/cmcurl.dir/cf-h1-proxy.c.o"
+  "CMakeFiles/cmcurl.dir/cf-h1-proxy.c.o.d"
+  "CMakeFiles/cmcurl.dir/cf-h2-proxy.c.o"
+  "CMakeFiles/cmcurl.dir/cf-h2-proxy.c.o.d"
+  "CMakeFiles/cmcurl.dir/cf-haproxy.c.o"
+  "CMakeFiles/cmcurl.dir/cf-haproxy.c.o.d"
+  "CMakeFiles/cmcurl.dir/cf-https-connect.c.o"
+  "CMakeFiles/cmcurl.dir/cf-https-connect.c.o.d"
+  "CMakeFiles/cmcurl.dir/cf-ip-happy.c.o"
+  "CMakeFiles/cmcurl.dir/cf-ip-happy.c.o.d"
+  "CMakeFiles/cmcurl.dir/cf-recvbuf.c.o"
+  "CMakeFiles/cmcurl.dir/cf-recvbuf.c.o.d"
+  "CMakeFiles/cmcurl.dir/cf-setup.c.o"
+  "CMakeFiles/cmcurl.dir/cf-setup.c.o.d"
+  "CMakeFiles/cmcurl.dir/cf-socket.c.o"
+  "CMakeFiles/cmcurl.dir/cf-socket.c.o.d"
+  "CMakeFiles/cmcurl.dir/cfilters.c.o"
+  "CMakeFiles/cmcurl.dir/cfilters.c.o.d"
+  "CMakeFiles/cmcurl.dir/conncache.c.o"
+  "CMakeFiles/cmcurl.dir/conncache.c.o.d"
+  "CMakeFiles/cmcurl.dir/connect.c.o"
+  "CMakeFiles/cmcurl.dir/connect.c.o.d"
+  "CMakeFiles/cmcurl.dir/content_encoding.c.o"
+  "CMakeFiles/cmcurl.dir/content_encoding.c.o.d"
+  "CMakeFiles/cmcurl.dir/cookie.c.o"
+  "CMakeFiles/cmcurl.dir/cookie.c.o.d"
+  "CMakeFiles/cmcurl.dir/creds.c.o"
+  "CMakeFiles/cmcurl.dir/creds.c.o.d"
+  "CMakeFiles/cmcurl.dir/cshutdn.c.o"
+  "CMakeFiles/cmcurl.dir/cshutdn.c.o.d"
+  "CMakeFiles/cmcurl.dir/curl_addrinfo.c.o"
+  "CMakeFiles/cmcurl.dir/curl_addrinfo.c.o.d"
+  "CMakeFiles/cmcurl.dir/curl_endian.c.o"
+  "CMakeFiles/cmcurl.dir/curl_endian.c.o.d"
+  "CMakeFiles/cmcurl.dir/curl_fnmatch.c.o"
+  "CMakeFiles/cmcurl.dir/curl_fnmatch.c.o.d"
+  "CMakeFiles/cmcurl.dir/curl_fopen.c.o"
+  "CMakeFiles/cmcurl.dir/curl_fopen.c.o.d"
+  "CMakeFiles/cmcurl.dir/curl_get_line.c.o"
+  "CMakeFiles/cmcurl.dir/curl_get_line.c.o.d"
+  "CMakeFiles/cmcurl.dir/curl_gethostname.c.o"
+  "CMakeFiles/cmcurl.dir/curl_gethostname.c.o.d"
+  "CMakeFiles/cmcurl.dir/curl_gssapi.c.o"
+  "CMakeFiles/cmcurl.dir/curl_gssapi.c.o.d"
+  "CMakeFiles/cmcurl.dir/curl_memrchr.c.o"
+  "CMakeFiles/cmcurl.dir/curl_memrchr.c.o.d"
+  "CMakeFiles/cmcurl.dir/curl_ntlm_core.c.o"
+  "CMakeFiles/cmcurl.dir/curl_ntlm_core.c.o.d"
+  "CMakeFiles/cmcurl.dir/curl_range.c.o"
+  "CMakeFiles/cmcurl.dir/curl_range.c.o.d"
+  "CMakeFiles/cmcurl.dir/curl_sasl.c.o"
+  "CMakeFiles/cmcurl.dir/curl_sasl.c.o.d"
+  "CMakeFiles/cmcurl.dir/curl_sha512_256.c.o"
+  "CMakeFiles/cmcurl.dir/curl_sha512_256.c.o.d"
+  "CMakeFiles/cmcurl.dir/curl_share.c.o"
+  "CMakeFiles/cmcurl.dir/curl_share.c.o.d"
+  "CMakeFiles/cmcurl.dir/curl_sspi.c.o"
+  "CMakeFiles/cmcurl.dir/curl_sspi.c.o.d"
+  "CMakeFiles/cmcurl.dir/curl_threads.c.o"
+  "CMakeFiles/cmcurl.dir/curl_threads.c.o.d"
+  "CMakeFiles/cmcurl.dir/curl_trc.c.o"
+  "CMakeFiles/cmcurl.dir/curl_trc.c.o.d"
+  "CMakeFiles/cmcurl.dir/curlx/base64.c.o"
+  "CMakeFiles/cmcurl.dir/curlx/base64.c.o.d"
+  "CMakeFiles/cmcurl.dir/curlx/basename.c.o"
+  "CMakeFiles/cmcurl.dir/curlx/basename.c.o.d"
+  "CMakeFiles/cmcurl.dir/curlx/dynbuf.c.o"
+  "CMakeFiles/cmcurl.dir/curlx/dynbuf.c.o.d"
+  "CMakeFiles/cmcurl.dir/curlx/fopen.c.o"
+  "CMakeFiles/cmcurl.dir/curlx/fopen.c.o.d"
+  "CMakeFiles/cmcurl.dir/curlx/inet_ntop.c.o"
+  "CMakeFiles/cmcurl.dir/curlx/inet_ntop.c.o.d"
+  "CMakeFiles/cmcurl.dir/curlx/inet_pton.c.o"
+  "CMakeFiles/cmcurl.dir/curlx/inet_pton.c.o.d"
+  "CMakeFiles/cmcurl.dir/curlx/multibyte.c.o"
+  "CMakeFiles/cmcurl.dir/curlx/multibyte.c.o.d"
+  "CMakeFiles/cmcurl.dir/curlx/nonblock.c.o"
+  "CMakeFiles/cmcurl.dir/curlx/nonblock.c.o.d"
+  "CMakeFiles/cmcurl.dir/curlx/snprintf.c.o"
+  "CMakeFiles/cmcurl.dir/curlx/snprintf.c.o.d"
+  "CMakeFiles/cmcurl.dir/curlx/strcopy.c.o"
+  "CMakeFiles/cmcurl.dir/curlx/strcopy.c.o.d"
+  "CMakeFiles/cmcurl.dir/curlx/strdup.c.o"
+  "CMakeFiles/cmcurl.dir/curlx/strdup.c.o.d"
+  "CMakeFiles/cmcurl.dir/curlx/strerr.c.o"
+  "CMakeFiles/cmcurl.dir/curlx/strerr.c.o.d"
+  "CMakeFiles/cmcurl.dir/curlx/strparse.c.o"
+  "CMakeFiles/cmcurl.dir/curlx/strparse.c.o.d"
+  "CMakeFiles/cmcurl.dir/curlx/timediff.c.o"
+  "CMakeFiles/cmcurl.dir/curlx/timediff.c.o.d"
+  "CMakeFiles/cmcurl.dir/curlx/timeval.c.o"
+  "CMakeFiles/cmcurl.dir/curlx/timeval.c.o.d"
+  "CMakeFiles/cmcurl.dir/curlx/version_win32.c.o"
+  "CMakeFiles/cmcurl.dir/curlx/version_win32.c.o.d"
+  "CMakeFiles/cmcurl.dir/curlx/wait.c.o"
+  "CMakeFiles/cmcurl.dir/curlx/wait.c.o.d"
+  "CMakeFiles/cmcurl.dir/curlx/warnless.c.o"
+  "CMakeFiles/cmcurl.dir/curlx/warnless.c.o.d"
+  "CMakeFiles/cmcurl.dir/curlx/winapi.c.o"
+  "CMakeFiles/cmcurl.dir/curlx/winapi.c.o.d"
+  "CMakeFiles/cmcurl.dir/cw-out.c.o"
+  "CMakeFiles/cmcurl.dir/cw-out.c.o.d"
+  "CMakeFiles/cmcurl.dir/cw-pause.c.o"
+  "CMakeFiles/cmcurl.dir/cw-pause.c.o.d"
+  "CMakeFiles/cmcurl.dir/dict.c.o"
+  "CMakeFiles/cmcurl.dir/dict.c.o.d"
+  "CMakeFiles/cmcurl.dir/dnscache.c.o"
+  "CMakeFiles/cmcurl.dir/dnscache.c.o.d"
+  "CMakeFiles/cmcurl.dir/doh.c.o"
+  "CMakeFiles/cmcurl.dir/doh.c.o.d"
+  "CMakeFiles/cmcurl.dir/dynhds.c.o"
+  "CMakeFiles/cmcurl.dir/dynhds.c.o.d"
+  "CMakeFiles/cmcurl.dir/easy.c.o"
+  "CMakeFiles/cmcurl.dir/easy.c.o.d"
+  "CMakeFiles/cmcurl.dir/easygetopt.c.o"
+  "CMakeFiles/cmcurl.dir/easygetopt.c.o.d"
+  "CMakeFiles/cmcurl.dir/easyoptions.c.o"
+  "CMakeFiles/cmcurl.dir/easyoptions.c.o.d"
+  "CMakeFiles/cmcurl.dir/escape.c.o"
+  "CMakeFiles/cmcurl.dir/escape.c.o.d"
+  "CMakeFiles/cmcurl.dir/fake_addrinfo.c.o"
+  "CMakeFiles/cmcurl.dir/fake_addrinfo.c.o.d"
+  "CMakeFiles/cmcurl.dir/file.c.o"
+  "CMakeFiles/cmcurl.dir/file.c.o.d"
+  "CMakeFiles/cmcurl.dir/fileinfo.c.o"
+  "CMakeFiles/cmcurl.dir/fileinfo.c.o.d"
+  "CMakeFiles/cmcurl.dir/formdata.c.o"
+  "CMakeFiles/cmcurl.dir/formdata.c.o.d"
+  "CMakeFiles/cmcurl.dir/ftp.c.o"
+  "CMakeFiles/cmcurl.dir/ftp.c.o.d"
+  "CMakeFiles/cmcurl.dir/ftplistparser.c.o"
+  "CMakeFiles/cmcurl.dir/ftplistparser.c.o.d"
+  "CMakeFiles/cmcurl.dir/getenv.c.o"
+  "CMakeFiles/cmcurl.dir/getenv.c.o.d"
+  "CMakeFiles/cmcurl.dir/getinfo.c.o"
+  "CMakeFiles/cmcurl.dir/getinfo.c.o.d"
+  "CMakeFiles/cmcurl.dir/gopher.c.o"
+  "CMakeFiles/cmcurl.dir/gopher.c.o.d"
+  "CMakeFiles/cmcurl.dir/hash.c.o"
+  "CMakeFiles/cmcurl.dir/hash.c.o.d"
+  "CMakeFiles/cmcurl.dir/headers.c.o"
+  "CMakeFiles/cmcurl.dir/headers.c.o.d"
+  "CMakeFiles/cmcurl.dir/hmac.c.o"
+  "CMakeFiles/cmcurl.dir/hmac.c.o.d"
+  "CMakeFiles/cmcurl.dir/hostip.c.o"
+  "CMakeFiles/cmcurl.dir/hostip.c.o.d"
+  "CMakeFiles/cmcurl.dir/hostip4.c.o"
+  "CMakeFiles/cmcurl.dir/hostip4.c.o.d"
+  "CMakeFiles/cmcurl.dir/hostip6.c.o"
+  "CMakeFiles/cmcurl.dir/hostip6.c.o.d"
+  "CMakeFiles/cmcurl.dir/hsts.c.o"
+  "CMakeFiles/cmcurl.dir/hsts.c.o.d"
+  "CMakeFiles/cmcurl.dir/http.c.o"
+  "CMakeFiles/cmcurl.dir/http.c.o.d"
+  "CMakeFiles/cmcurl.dir/http1.c.o"
+  "CMakeFiles/cmcurl.dir/http1.c.o.d"
+  "CMakeFiles/cmcurl.dir/http2.c.o"
+  "CMakeFiles/cmcurl.dir/http2.c.o.d"
+  "CMakeFiles/cmcurl.dir/http_aws_sigv4.c.o"
+  "CMakeFiles/cmcurl.dir/http_aws_sigv4.c.o.d"
+  "CMakeFiles/cmcurl.dir/http_chunks.c.o"
+  "CMakeFiles/cmcurl.dir/http_chunks.c.o.d"
+  "CMakeFiles/cmcurl.dir/http_digest.c.o"
+  "CMakeFiles/cmcurl.dir/http_digest.c.o.d"
+  "CMakeFiles/cmcurl.dir/http_negotiate.c.o"
+  "CMakeFiles/cmcurl.dir/http_negotiate.c.o.d"
+  "CMakeFiles/cmcurl.dir/http_ntlm.c.o"
+  "CMakeFiles/cmcurl.dir/http_ntlm.c.o.d"
+  "CMakeFiles/cmcurl.dir/http_proxy.c.o"
+  "CMakeFiles/cmcurl.dir/http_proxy.c.o.d"
+  "CMakeFiles/cmcurl.dir/httpsrr.c.o"
+  "CMakeFiles/cmcurl.dir/httpsrr.c.o.d"
+  "CMakeFiles/cmcurl.dir/idn.c.o"
+  "CMakeFiles/cmcurl.dir/idn.c.o.d"
+  "CMakeFiles/cmcurl.dir/if2ip.c.o"
+  "CMakeFiles/cmcurl.dir/if2ip.c.o.d"
+  "CMakeFiles/cmcurl.dir/imap.c.o"
+  "CMakeFiles/cmcurl.dir/imap.c.o.d"
+  "CMakeFiles/cmcurl.dir/ldap.c.o"
+  "CMakeFiles/cmcurl.dir/ldap.c.o.d"
+  "CMakeFiles/cmcurl.dir/llist.c.o"
+  "CMakeFiles/cmcurl.dir/llist.c.o.d"
+  "CMakeFiles/cmcurl.dir/macos.c.o"
+  "CMakeFiles/cmcurl.dir/macos.c.o.d"
+  "CMakeFiles/cmcurl.dir/md4.c.o"
+  "CMakeFiles/cmcurl.dir/md4.c.o.d"
+  "CMakeFiles/cmcurl.dir/md5.c.o"
+  "CMakeFiles/cmcurl.dir/md5.c.o.d"
+  "CMakeFiles/cmcurl.dir/memdebug.c.o"
+  "CMakeFiles/cmcurl.dir/memdebug.c.o.d"
+  "CMakeFiles/cmcurl.dir/mime.c.o"
+  "CMakeFiles/cmcurl.dir/mime.c.o.d"
+  "CMakeFiles/cmcurl.dir/mprintf.c.o"
+  "CMakeFiles/cmcurl.dir/mprintf.c.o.d"
+  "CMakeFiles/cmcurl.dir/mqtt.c.o"
+  "CMakeFiles/cmcurl.dir/mqtt.c.o.d"
+  "CMakeFiles/cmcurl.dir/multi.c.o"
+  "CMakeFiles/cmcurl.dir/multi.c.o.d"
+  "CMakeFiles/cmcurl.dir/multi_ev.c.o"
+  "CMakeFiles/cmcurl.dir/multi_ev.c.o.d"
+  "CMakeFiles/cmcurl.dir/multi_ntfy.c.o"
+  "CMakeFiles/cmcurl.dir/multi_ntfy.c.o.d"
+  "CMakeFiles/cmcurl.dir/netrc.c.o"
+  "CMakeFiles/cmcurl.dir/netrc.c.o.d"
+  "CMakeFiles/cmcurl.dir/openldap.c.o"
+  "CMakeFiles/cmcurl.dir/openldap.c.o.d"
+  "CMakeFiles/cmcurl.dir/parsedate.c.o"
+  "CMakeFiles/cmcurl.dir/parsedate.c.o.d"
+  "CMakeFiles/cmcurl.dir/peer.c.o"
+  "CMakeFiles/cmcurl.dir/peer.c.o.d"
+  "CMakeFiles/cmcurl.dir/pingpong.c.o"
+  "CMakeFiles/cmcurl.dir/pingpong.c.o.d"
+  "CMakeFiles/cmcurl.dir/pop3.c.o"
+  "CMakeFiles/cmcurl.dir/pop3.c.o.d"
+  "CMakeFiles/cmcurl.dir/progress.c.o"
+  "CMakeFiles/cmcurl.dir/progress.c.o.d"
+  "CMakeFiles/cmcurl.dir/protocol.c.o"
+  "CMakeFiles/cmcurl.dir/protocol.c.o.d"
+  "CMakeFiles/cmcurl.dir/proxy.c.o"
+  "CMakeFiles/cmcurl.dir/proxy.c.o.d"
+  "CMakeFiles/cmcurl.dir/psl.c.o"
+  "CMakeFiles/cmcurl.dir/psl.c.o.d"
+  "CMakeFiles/cmcurl.dir/rand.c.o"
+  "CMakeFiles/cmcurl.dir/rand.c.o.d"
+  "CMakeFiles/cmcurl.dir/ratelimit.c.o"
+  "CMakeFiles/cmcurl.dir/ratelimit.c.o.d"
+  "CMakeFiles/cmcurl.dir/request.c.o"
+  "CMakeFiles/cmcurl.dir/request.c.o.d"
+  "CMakeFiles/cmcurl.dir/rtsp.c.o"
+  "CMakeFiles/cmcurl.dir/rtsp.c.o.d"
+  "CMakeFiles/cmcurl.dir/select.c.o"
+  "CMakeFiles/cmcurl.dir/select.c.o.d"
+  "CMakeFiles/cmcurl.dir/sendf.c.o"
+  "CMakeFiles/cmcurl.dir/sendf.c.o.d"
+  "CMakeFiles/cmcurl.dir/setopt.c.o"
+  "CMakeFiles/cmcurl.dir/setopt.c.o.d"
+  "CMakeFiles/cmcurl.dir/sha256.c.o"
+  "CMakeFiles/cmcurl.dir/sha256.c.o.d"
+  "CMakeFiles/cmcurl.dir/slist.c.o"
+  "CMakeFiles/cmcurl.dir/slist.c.o.d"
+  "CMakeFiles/cmcurl.dir/smb.c.o"
+  "CMakeFiles/cmcurl.dir/smb.c.o.d"
+  "CMakeFiles/cmcurl.dir/smtp.c.o"
+  "CMakeFiles/cmcurl.dir/smtp.c.o.d"
+  "CMakeFiles/cmcurl.dir/socketpair.c.o"
+  "CMakeFiles/cmcurl.dir/socketpair.c.o.d"
+  "CMakeFiles/cmcurl.dir/socks.c.o"
+  "CMakeFiles/cmcurl.dir/socks.c.o.d"
+  "CMakeFiles/cmcurl.dir/socks_gssapi.c.o"
+  "CMakeFiles/cmcurl.dir/socks_gssapi.c.o.d"
+  "CMakeFiles/cmcurl.dir/socks_sspi.c.o"
+  "CMakeFiles/cmcurl.dir/socks_sspi.c.o.d"
+  "CMakeFiles/cmcurl.dir/splay.c.o"
+  "CMakeFiles/cmcurl.dir/splay.c.o.d"
+  "CMakeFiles/cmcurl.dir/strcase.c.o"
+  "CMakeFiles/cmcurl.dir/strcase.c.o.d"
+  "CMakeFiles/cmcurl.dir/strequal.c.o"
+  "CMakeFiles/cmcurl.dir/strequal.c.o.d"
+  "CMakeFiles/cmcurl.dir/strerror.c.o"
+  "CMakeFiles/cmcurl.dir/strerror.c.o.d"
+  "CMakeFiles/cmcurl.dir/system_win32.c.o"
+  "CMakeFiles/cmcurl.dir/system_win32.c.o.d"
+  "CMakeFiles/cmcurl.dir/telnet.c.o"
+  "CMakeFiles/cmcurl.dir/telnet.c.o.d"
+  "CMakeFiles/cmcurl.dir/tftp.c.o"
+  "CMakeFiles/cmcurl.dir/tftp.c.o.d"
+  "CMakeFiles/cmcurl.dir/thrdpool.c.o"
+  "CMakeFiles/cmcurl.dir/thrdpool.c.o.d"
+  "CMakeFiles/cmcurl.dir/thrdqueue.c.o"
+  "CMakeFiles/cmcurl.dir/thrdqueue.c.o.d"
+  "CMakeFiles/cmcurl.dir/transfer.c.o"
+  "CMakeFiles/cmcurl.dir/transfer.c.o.d"
+  "CMakeFiles/cmcurl.dir/uint-bset.c.o"
+  "CMakeFiles/cmcurl.dir/uint-bset.c.o.d"
+  "CMakeFiles/cmcurl.dir/uint-hash.c.o"
+  "CMakeFiles/cmcurl.dir/uint-hash.c.o.d"
+  "CMakeFiles/cmcurl.dir/uint-spbset.c.o"
+  "CMakeFiles/cmcurl.dir/uint-spbset.c.o.d"
+  "CMakeFiles/cmcurl.dir/uint-table.c.o"
+  "CMakeFiles/cmcurl.dir/uint-table.c.o.d"
+  "CMakeFiles/cmcurl.dir/url.c.o"
+  "CMakeFiles/cmcurl.dir/url.c.o.d"
+  "CMakeFiles/cmcurl.dir/urlapi.c.o"
+  "CMakeFiles/cmcurl.dir/urlapi.c.o.d"
+  "CMakeFiles/cmcurl.dir/vauth/cleartext.c.o"
+  "CMakeFiles/cmcurl.dir/vauth/cleartext.c.o.d"
+  "CMakeFiles/cmcurl.dir/vauth/cram.c.o"
+  "CMakeFiles/cmcurl.dir/vauth/cram.c.o.d"
+  "CMakeFiles/cmcurl.dir/vauth/digest.c.o"
+  "CMakeFiles/cmcurl.dir/vauth/digest.c.o.d"
+  "CMakeFiles/cmcurl.dir/vauth/digest_sspi.c.o"
+  "CMakeFiles/cmcurl.dir/vauth/digest_sspi.c.o.d"
+  "CMakeFiles/cmcurl.dir/vauth/gsasl.c.o"
+  "CMakeFiles/cmcurl.dir/vauth/gsasl.c.o.d"
+  "CMakeFiles/cmcurl.dir/vauth/krb5_gssapi.c.o"
+  "CMakeFiles/cmcurl.dir/vauth/krb5_gssapi.c.o.d"
+  "CMakeFiles/cmcurl.dir/vauth/krb5_sspi.c.o"
+  "CMakeFiles/cmcurl.dir/vauth/krb5_sspi.c.o.d"
+  "CMakeFiles/cmcurl.dir/vauth/ntlm.c.o"
+  "CMakeFiles/cmcurl.dir/vauth/ntlm.c.o.d"
+  "CMakeFiles/cmcurl.dir/vauth/ntlm_sspi.c.o"
+  "CMakeFiles/cmcurl.dir/vauth/ntlm_sspi.c.o.d"
+  "CMakeFiles/cmcurl.dir/vauth/oauth2.c.o"
+  "CMakeFiles/cmcurl.dir/vauth/oauth2.c.o.d"
+  "CMakeFiles/cmcurl.dir/vauth/spnego_gssapi.c.o"
+  "CMakeFiles/cmcurl.dir/vauth/spnego_gssapi.c.o.d"
+  "CMakeFiles/cmcurl.dir/vauth/spnego_sspi.c.o"
+  "CMakeFiles/cmcurl.dir/vauth/spnego_sspi.c.o.d"
+  "CMakeFiles/cmcurl.dir/vauth/vauth.c.o"
+  "CMakeFiles/cmcurl.dir/vauth/vauth.c.o.d"
+  "CMakeFiles/cmcurl.dir/version.c.o"
+  "CMakeFiles/cmcurl.dir/version.c.o.d"
+  "CMakeFiles/cmcurl.dir/vquic/capsule.c.o"
+  "CMakeFiles/cmcurl.dir/vquic/capsule.c.o.d"
+  "CMakeFiles/cmcurl.dir/vquic/cf-capsule.c.o"
+  "CMakeFiles/cmcurl.dir/vquic/cf-capsule.c.o.d"
+  "CMakeFiles/cmcurl.dir/vquic/cf-ngtcp2-cmn.c.o"
+  "CMakeFiles/cmcurl.dir/vquic/cf-ngtcp2-cmn.c.o.d"
+  "CMakeFiles/cmcurl.dir/vquic/cf-ngtcp2-proxy.c.o"
+  "CMakeFiles/cmcurl.dir/vquic/cf-ngtcp2-proxy.c.o.d"
+  "CMakeFiles/cmcurl.dir/vquic/cf-ngtcp2.c.o"
+  "CMakeFiles/cmcurl.dir/vquic/cf-ngtcp2.c.o.d"
+  "CMakeFiles/cmcurl.dir/vquic/cf-quiche.c.o"
+  "CMakeFiles/cmcurl.dir/vquic/cf-quiche.c.o.d"
+  "CMakeFiles/cmcurl.dir/vquic/vquic-tls.c.o"
+  "CMakeFiles/cmcurl.dir/vquic/vquic-tls.c.o.d"
+  "CMakeFiles/cmcurl.dir/vquic/vquic.c.o"
+  "CMakeFiles/cmcurl.dir/vquic/vquic.c.o.d"
+  "CMakeFiles/cmcurl.dir/vssh/libssh.c.o"
+  "CMakeFiles/cmcurl.dir/vssh/libssh.c.o.d"
+  "CMakeFiles/cmcurl.dir/vssh/libssh2.c.o"
+  "CMakeFiles/cmcurl.dir/vssh/libssh2.c.o.d"
+  "CMakeFiles/cmcurl.dir/vssh/vssh.c.o"
+  "CMakeFiles/cmcurl.dir/vssh/vssh.c.o.d"
+  "CMakeFiles/cmcurl.dir/vtls/apple.c.o"
+  "CMakeFiles/cmcurl.dir/vtls/apple.c.o.d"
+  "CMakeFiles/cmcurl.dir/vtls/cipher_suite.c.o"
+  "CMakeFiles/cmcurl.dir/vtls/cipher_suite.c.o.d"
+  "CMakeFiles/cmcurl.dir/vtls/gtls.c.o"
+  "CMakeFiles/cmcurl.dir/vtls/gtls.c.o.d"
+  "CMakeFiles/cmcurl.dir/vtls/hostcheck.c.o"
+  "CMakeFiles/cmcurl.dir/vtls/hostcheck.c.o.d"
+  "CMakeFiles/cmcurl.dir/vtls/keylog.c.o"
+  "CMakeFiles/cmcurl.dir/vtls/keylog.c.o.d"
+  "CMakeFiles/cmcurl.dir/vtls/mbedtls.c.o"
+  "CMakeFiles/cmcurl.dir/vtls/mbedtls.c.o.d"
+  "CMakeFiles/cmcurl.dir/vtls/openssl.c.o"
+  "CMakeFiles/cmcurl.dir/vtls/openssl.c.o.d"
+  "CMakeFiles/cmcurl.dir/vtls/rustls.c.o"
+  "CMakeFiles/cmcurl.dir/vtls/rustls.c.o.d"
+  "CMakeFiles/cmcurl.dir/vtls/schannel.c.o"
+  "CMakeFiles/cmcurl.dir/vtls/schannel.c.o.d"
+  "CMakeFiles/cmcurl.dir/vtls/schannel_verify.c.o"
+  "CMakeFiles/cmcurl.dir/vtls/schannel_verify.c.o.d"
+  "CMakeFiles/cmcurl.dir/vtls/vtls.c.o"
+  "CMakeFiles/cmcurl.dir/vtls/vtls.c.o.d"
+  "CMakeFiles/cmcurl.dir/vtls/vtls_config.c.o"
+  "CMakeFiles/cmcurl.dir/vtls/vtls_config.c.o.d"
+  "CMakeFiles/cmcurl.dir/vtls/vtls_scache.c.o"
+  "CMakeFiles/cmcurl.dir/vtls/vtls_scache.c.o.d"
+  "CMakeFiles/cmcurl.dir/vtls/vtls_spack.c.o"
+  "CMakeFiles/cmcurl.dir/vtls/vtls_spack.c.o.d"
+  "CMakeFiles/cmcurl.dir/vtls/wolfssl.c.o"
+  "CMakeFiles/cmcurl.dir/vtls/wolfssl.c.o.d"
+  "CMakeFiles/cmcurl.dir/vtls/x509asn1.c.o"
+  "CMakeFiles/cmcurl.dir/vtls/x509asn1.c.o.d"
+  "CMakeFiles/cmcurl.dir/ws.c.o"
+  "CMakeFiles/cmcurl.dir/ws.c.o.d"
+  "libcmcurl.a"
+  "libcmcurl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cmcurl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
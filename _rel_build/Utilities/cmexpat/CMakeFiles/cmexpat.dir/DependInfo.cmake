@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Utilities/cmexpat/lib/xmlparse.c" "Utilities/cmexpat/CMakeFiles/cmexpat.dir/lib/xmlparse.c.o" "gcc" "Utilities/cmexpat/CMakeFiles/cmexpat.dir/lib/xmlparse.c.o.d"
+  "/root/repo/Utilities/cmexpat/lib/xmlrole.c" "Utilities/cmexpat/CMakeFiles/cmexpat.dir/lib/xmlrole.c.o" "gcc" "Utilities/cmexpat/CMakeFiles/cmexpat.dir/lib/xmlrole.c.o.d"
+  "/root/repo/Utilities/cmexpat/lib/xmltok.c" "Utilities/cmexpat/CMakeFiles/cmexpat.dir/lib/xmltok.c.o" "gcc" "Utilities/cmexpat/CMakeFiles/cmexpat.dir/lib/xmltok.c.o.d"
+  "/root/repo/Utilities/cmexpat/lib/xmltok_impl.c" "Utilities/cmexpat/CMakeFiles/cmexpat.dir/lib/xmltok_impl.c.o" "gcc" "Utilities/cmexpat/CMakeFiles/cmexpat.dir/lib/xmltok_impl.c.o.d"
+  "/root/repo/Utilities/cmexpat/lib/xmltok_ns.c" "Utilities/cmexpat/CMakeFiles/cmexpat.dir/lib/xmltok_ns.c.o" "gcc" "Utilities/cmexpat/CMakeFiles/cmexpat.dir/lib/xmltok_ns.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
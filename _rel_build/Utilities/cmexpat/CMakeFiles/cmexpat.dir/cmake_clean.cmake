@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmexpat.dir/lib/xmlparse.c.o"
+  "CMakeFiles/cmexpat.dir/lib/xmlparse.c.o.d"
+  "CMakeFiles/cmexpat.dir/lib/xmlrole.c.o"
+  "CMakeFiles/cmexpat.dir/lib/xmlrole.c.o.d"
+  "CMakeFiles/cmexpat.dir/lib/xmltok.c.o"
+  "CMakeFiles/cmexpat.dir/lib/xmltok.c.o.d"
+  "CMakeFiles/cmexpat.dir/lib/xmltok_impl.c.o"
+  "CMakeFiles/cmexpat.dir/lib/xmltok_impl.c.o.d"
+  "CMakeFiles/cmexpat.dir/lib/xmltok_ns.c.o"
+  "CMakeFiles/cmexpat.dir/lib/xmltok_ns.c.o.d"
+  "libcmexpat.a"
+  "libcmexpat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cmexpat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
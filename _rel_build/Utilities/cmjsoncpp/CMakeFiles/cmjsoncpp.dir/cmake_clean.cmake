@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmjsoncpp.dir/src/lib_json/json_reader.cpp.o"
+  "CMakeFiles/cmjsoncpp.dir/src/lib_json/json_reader.cpp.o.d"
+  "CMakeFiles/cmjsoncpp.dir/src/lib_json/json_value.cpp.o"
+  "CMakeFiles/cmjsoncpp.dir/src/lib_json/json_value.cpp.o.d"
+  "CMakeFiles/cmjsoncpp.dir/src/lib_json/json_writer.cpp.o"
+  "CMakeFiles/cmjsoncpp.dir/src/lib_json/json_writer.cpp.o.d"
+  "libcmjsoncpp.a"
+  "libcmjsoncpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmjsoncpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,16 @@
+#ifdef __STDC__
+#include <limits.h>
+#else
+#include <assert.h>
+#endif
+
+int
+main()
+{
+#if defined __stub__get_timezone || defined __stub____get_timezone
+  return 0;
+#else
+this system have stub
+  return 0;
+#endif
+}
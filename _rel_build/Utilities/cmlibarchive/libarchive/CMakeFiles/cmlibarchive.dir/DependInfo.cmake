@@ -0,0 +1,145 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_acl.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_acl.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_acl.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_blake2s_ref.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_blake2s_ref.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_blake2s_ref.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_blake2sp_ref.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_blake2sp_ref.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_blake2sp_ref.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_check_magic.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_check_magic.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_check_magic.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_cmdline.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_cmdline.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_cmdline.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_cryptor.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_cryptor.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_cryptor.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_digest.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_digest.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_digest.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_entry.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_entry.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_entry.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_entry_copy_stat.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_entry_copy_stat.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_entry_copy_stat.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_entry_link_resolver.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_entry_link_resolver.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_entry_link_resolver.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_entry_sparse.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_entry_sparse.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_entry_sparse.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_entry_stat.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_entry_stat.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_entry_stat.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_entry_strmode.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_entry_strmode.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_entry_strmode.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_entry_xattr.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_entry_xattr.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_entry_xattr.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_hmac.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_hmac.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_hmac.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_match.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_match.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_match.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_options.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_options.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_options.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_pack_dev.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_pack_dev.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_pack_dev.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_parse_date.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_parse_date.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_parse_date.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_pathmatch.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_pathmatch.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_pathmatch.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_ppmd7.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_ppmd7.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_ppmd7.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_ppmd8.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_ppmd8.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_ppmd8.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_random.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_random.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_random.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_rb.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_rb.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_rb.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_add_passphrase.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_add_passphrase.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_add_passphrase.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_append_filter.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_append_filter.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_append_filter.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_data_into_fd.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_data_into_fd.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_data_into_fd.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_disk_entry_from_file.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_disk_entry_from_file.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_disk_entry_from_file.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_disk_posix.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_disk_posix.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_disk_posix.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_disk_set_standard_lookup.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_disk_set_standard_lookup.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_disk_set_standard_lookup.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_extract.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_extract.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_extract.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_extract2.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_extract2.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_extract2.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_open_fd.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_open_fd.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_open_fd.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_open_file.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_open_file.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_open_file.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_open_filename.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_open_filename.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_open_filename.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_open_memory.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_open_memory.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_open_memory.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_set_format.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_set_format.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_set_format.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_set_options.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_set_options.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_set_options.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_filter_all.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_all.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_all.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_filter_by_code.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_by_code.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_by_code.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_filter_bzip2.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_bzip2.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_bzip2.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_filter_compress.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_compress.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_compress.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_filter_grzip.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_grzip.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_grzip.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_filter_gzip.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_gzip.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_gzip.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_filter_lrzip.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_lrzip.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_lrzip.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_filter_lz4.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_lz4.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_lz4.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_filter_lzop.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_lzop.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_lzop.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_filter_none.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_none.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_none.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_filter_program.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_program.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_program.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_filter_rpm.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_rpm.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_rpm.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_filter_uu.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_uu.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_uu.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_filter_xz.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_xz.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_xz.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_filter_zstd.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_zstd.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_filter_zstd.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_format_7zip.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_7zip.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_7zip.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_format_all.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_all.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_all.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_format_ar.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_ar.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_ar.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_format_by_code.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_by_code.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_by_code.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_format_cab.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_cab.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_cab.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_format_cpio.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_cpio.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_cpio.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_format_empty.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_empty.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_empty.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_format_iso9660.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_iso9660.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_iso9660.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_format_lha.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_lha.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_lha.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_format_mtree.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_mtree.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_mtree.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_format_rar.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_rar.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_rar.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_format_rar5.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_rar5.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_rar5.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_format_raw.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_raw.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_raw.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_format_tar.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_tar.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_tar.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_format_warc.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_warc.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_warc.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_format_xar.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_xar.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_xar.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_read_support_format_zip.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_zip.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_read_support_format_zip.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_string.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_string.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_string.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_string_sprintf.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_string_sprintf.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_string_sprintf.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_time.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_time.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_time.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_util.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_util.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_util.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_version_details.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_version_details.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_version_details.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_virtual.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_virtual.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_virtual.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_add_filter.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_add_filter_b64encode.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_b64encode.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_b64encode.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_add_filter_by_name.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_by_name.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_by_name.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_add_filter_bzip2.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_bzip2.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_bzip2.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_add_filter_compress.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_compress.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_compress.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_add_filter_grzip.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_grzip.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_grzip.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_add_filter_gzip.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_gzip.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_gzip.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_add_filter_lrzip.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_lrzip.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_lrzip.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_add_filter_lz4.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_lz4.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_lz4.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_add_filter_lzop.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_lzop.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_lzop.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_add_filter_none.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_none.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_none.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_add_filter_program.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_program.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_program.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_add_filter_uuencode.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_uuencode.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_uuencode.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_add_filter_xz.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_xz.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_xz.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_add_filter_zstd.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_zstd.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_add_filter_zstd.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_disk_posix.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_disk_posix.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_disk_posix.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_disk_set_standard_lookup.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_disk_set_standard_lookup.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_disk_set_standard_lookup.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_open_fd.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_open_fd.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_open_fd.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_open_file.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_open_file.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_open_file.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_open_filename.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_open_filename.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_open_filename.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_open_memory.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_open_memory.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_open_memory.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_format.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_format_7zip.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_7zip.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_7zip.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_format_ar.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_ar.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_ar.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_format_by_name.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_by_name.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_by_name.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_format_cpio.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_cpio.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_cpio.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_format_cpio_binary.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_cpio_binary.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_cpio_binary.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_format_cpio_newc.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_cpio_newc.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_cpio_newc.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_format_cpio_odc.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_cpio_odc.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_cpio_odc.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_format_filter_by_ext.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_filter_by_ext.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_filter_by_ext.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_format_gnutar.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_gnutar.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_gnutar.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_format_iso9660.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_iso9660.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_iso9660.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_format_mtree.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_mtree.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_mtree.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_format_pax.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_pax.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_pax.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_format_raw.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_raw.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_raw.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_format_shar.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_shar.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_shar.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_format_ustar.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_ustar.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_ustar.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_format_v7tar.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_v7tar.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_v7tar.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_format_warc.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_warc.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_warc.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_format_xar.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_xar.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_xar.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_format_zip.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_zip.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_format_zip.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_options.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_options.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_options.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/archive_write_set_passphrase.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_passphrase.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/archive_write_set_passphrase.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/filter_fork_posix.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/filter_fork_posix.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/filter_fork_posix.c.o.d"
+  "/root/repo/Utilities/cmlibarchive/libarchive/xxhash.c" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/xxhash.c.o" "gcc" "Utilities/cmlibarchive/libarchive/CMakeFiles/cmlibarchive.dir/xxhash.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/Utilities/cmzlib/CMakeFiles/cmzlib.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmbzip2/CMakeFiles/cmbzip2.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/Utilities/cmzstd/CMakeFiles/cmzstd.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
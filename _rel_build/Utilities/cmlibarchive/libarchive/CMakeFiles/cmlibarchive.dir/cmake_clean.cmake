@@ -0,0 +1,255 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmlibarchive.dir/archive_acl.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_acl.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_blake2s_ref.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_blake2s_ref.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_blake2sp_ref.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_blake2sp_ref.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_check_magic.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_check_magic.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_cmdline.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_cmdline.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_cryptor.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_cryptor.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_digest.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_digest.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_entry.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_entry.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_entry_copy_stat.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_entry_copy_stat.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_entry_link_resolver.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_entry_link_resolver.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_entry_sparse.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_entry_sparse.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_entry_stat.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_entry_stat.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_entry_strmode.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_entry_strmode.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_entry_xattr.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_entry_xattr.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_hmac.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_hmac.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_match.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_match.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_options.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_options.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_pack_dev.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_pack_dev.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_parse_date.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_parse_date.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_pathmatch.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_pathmatch.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_ppmd7.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_ppmd7.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_ppmd8.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_ppmd8.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_random.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_random.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_rb.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_rb.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_add_passphrase.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_add_passphrase.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_append_filter.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_append_filter.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_data_into_fd.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_data_into_fd.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_disk_entry_from_file.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_disk_entry_from_file.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_disk_posix.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_disk_posix.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_disk_set_standard_lookup.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_disk_set_standard_lookup.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_extract.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_extract.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_extract2.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_extract2.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_open_fd.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_open_fd.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_open_file.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_open_file.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_open_filename.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_open_filename.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_open_memory.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_open_memory.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_set_format.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_set_format.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_set_options.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_set_options.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_all.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_all.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_by_code.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_by_code.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_bzip2.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_bzip2.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_compress.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_compress.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_grzip.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_grzip.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_gzip.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_gzip.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_lrzip.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_lrzip.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_lz4.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_lz4.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_lzop.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_lzop.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_none.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_none.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_program.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_program.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_rpm.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_rpm.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_uu.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_uu.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_xz.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_xz.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_zstd.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_filter_zstd.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_7zip.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_7zip.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_all.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_all.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_ar.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_ar.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_by_code.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_by_code.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_cab.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_cab.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_cpio.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_cpio.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_empty.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_empty.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_iso9660.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_iso9660.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_lha.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_lha.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_mtree.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_mtree.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_rar.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_rar.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_rar5.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_rar5.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_raw.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_raw.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_tar.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_tar.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_warc.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_warc.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_xar.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_xar.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_zip.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_read_support_format_zip.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_string.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_string.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_string_sprintf.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_string_sprintf.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_time.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_time.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_util.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_util.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_version_details.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_version_details.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_virtual.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_virtual.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_b64encode.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_b64encode.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_by_name.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_by_name.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_bzip2.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_bzip2.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_compress.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_compress.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_grzip.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_grzip.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_gzip.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_gzip.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_lrzip.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_lrzip.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_lz4.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_lz4.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_lzop.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_lzop.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_none.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_none.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_program.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_program.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_uuencode.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_uuencode.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_xz.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_xz.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_zstd.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_add_filter_zstd.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_disk_posix.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_disk_posix.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_disk_set_standard_lookup.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_disk_set_standard_lookup.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_open_fd.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_open_fd.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_open_file.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_open_file.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_open_filename.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_open_filename.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_open_memory.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_open_memory.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_7zip.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_7zip.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_ar.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_ar.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_by_name.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_by_name.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_cpio.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_cpio.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_cpio_binary.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_cpio_binary.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_cpio_newc.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_cpio_newc.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_cpio_odc.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_cpio_odc.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_filter_by_ext.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_filter_by_ext.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_gnutar.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_gnutar.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_iso9660.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_iso9660.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_mtree.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_mtree.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_pax.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_pax.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_raw.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_raw.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_shar.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_shar.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_ustar.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_ustar.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_v7tar.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_v7tar.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_warc.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_warc.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_xar.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_xar.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_zip.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_format_zip.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_options.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_options.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_passphrase.c.o"
+  "CMakeFiles/cmlibarchive.dir/archive_write_set_passphrase.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/filter_fork_posix.c.o"
+  "CMakeFiles/cmlibarchive.dir/filter_fork_posix.c.o.d"
+  "CMakeFiles/cmlibarchive.dir/xxhash.c.o"
+  "CMakeFiles/cmlibarchive.dir/xxhash.c.o.d"
+  "libcmlibarchive.a"
+  "libcmlibarchive.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cmlibarchive.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
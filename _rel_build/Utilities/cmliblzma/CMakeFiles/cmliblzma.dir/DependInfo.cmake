@@ -0,0 +1,90 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Utilities/cmliblzma/common/tuklib_cpucores.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/common/tuklib_cpucores.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/common/tuklib_cpucores.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/check/check.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/check/check.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/check/check.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/check/crc32_fast.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/check/crc32_fast.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/check/crc32_fast.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/check/crc32_table.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/check/crc32_table.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/check/crc32_table.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/check/crc64_fast.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/check/crc64_fast.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/check/crc64_fast.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/check/crc64_table.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/check/crc64_table.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/check/crc64_table.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/check/sha256.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/check/sha256.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/check/sha256.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/alone_decoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/alone_decoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/alone_decoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/alone_encoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/alone_encoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/alone_encoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/auto_decoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/auto_decoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/auto_decoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/block_buffer_decoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/block_buffer_decoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/block_buffer_decoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/block_buffer_encoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/block_buffer_encoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/block_buffer_encoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/block_decoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/block_decoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/block_decoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/block_encoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/block_encoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/block_encoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/block_header_decoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/block_header_decoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/block_header_decoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/block_header_encoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/block_header_encoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/block_header_encoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/block_util.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/block_util.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/block_util.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/common.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/common.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/common.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/easy_buffer_encoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/easy_buffer_encoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/easy_buffer_encoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/easy_decoder_memusage.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/easy_decoder_memusage.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/easy_decoder_memusage.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/easy_encoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/easy_encoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/easy_encoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/easy_encoder_memusage.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/easy_encoder_memusage.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/easy_encoder_memusage.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/easy_preset.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/easy_preset.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/easy_preset.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/filter_buffer_decoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/filter_buffer_decoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/filter_buffer_decoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/filter_buffer_encoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/filter_buffer_encoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/filter_buffer_encoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/filter_common.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/filter_common.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/filter_common.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/filter_decoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/filter_decoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/filter_decoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/filter_encoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/filter_encoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/filter_encoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/filter_flags_decoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/filter_flags_decoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/filter_flags_decoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/filter_flags_encoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/filter_flags_encoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/filter_flags_encoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/hardware_cputhreads.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/hardware_cputhreads.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/hardware_cputhreads.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/index.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/index.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/index.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/index_decoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/index_decoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/index_decoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/index_encoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/index_encoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/index_encoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/index_hash.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/index_hash.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/index_hash.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/outqueue.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/outqueue.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/outqueue.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/stream_buffer_decoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/stream_buffer_decoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/stream_buffer_decoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/stream_buffer_encoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/stream_buffer_encoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/stream_buffer_encoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/stream_decoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/stream_decoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/stream_decoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/stream_encoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/stream_encoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/stream_encoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/stream_encoder_mt.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/stream_encoder_mt.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/stream_encoder_mt.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/stream_flags_common.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/stream_flags_common.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/stream_flags_common.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/stream_flags_decoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/stream_flags_decoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/stream_flags_decoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/stream_flags_encoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/stream_flags_encoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/stream_flags_encoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/vli_decoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/vli_decoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/vli_decoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/vli_encoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/vli_encoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/vli_encoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/common/vli_size.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/vli_size.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/common/vli_size.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/delta/delta_common.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/delta/delta_common.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/delta/delta_common.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/delta/delta_decoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/delta/delta_decoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/delta/delta_decoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/delta/delta_encoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/delta/delta_encoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/delta/delta_encoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/lz/lz_decoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lz/lz_decoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lz/lz_decoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/lz/lz_encoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lz/lz_encoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lz/lz_encoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/lz/lz_encoder_mf.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lz/lz_encoder_mf.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lz/lz_encoder_mf.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/lzma/fastpos_table.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lzma/fastpos_table.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lzma/fastpos_table.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/lzma/lzma2_decoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma2_decoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma2_decoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/lzma/lzma2_encoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma2_encoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma2_encoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/lzma/lzma_decoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma_decoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma_decoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/lzma/lzma_encoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma_encoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma_encoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/lzma/lzma_encoder_optimum_fast.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma_encoder_optimum_fast.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma_encoder_optimum_fast.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/lzma/lzma_encoder_optimum_normal.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma_encoder_optimum_normal.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma_encoder_optimum_normal.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/lzma/lzma_encoder_presets.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma_encoder_presets.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma_encoder_presets.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/rangecoder/price_table.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/rangecoder/price_table.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/rangecoder/price_table.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/simple/arm.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/simple/arm.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/simple/arm.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/simple/arm64.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/simple/arm64.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/simple/arm64.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/simple/armthumb.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/simple/armthumb.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/simple/armthumb.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/simple/ia64.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/simple/ia64.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/simple/ia64.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/simple/powerpc.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/simple/powerpc.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/simple/powerpc.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/simple/simple_coder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/simple/simple_coder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/simple/simple_coder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/simple/simple_decoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/simple/simple_decoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/simple/simple_decoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/simple/simple_encoder.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/simple/simple_encoder.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/simple/simple_encoder.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/simple/sparc.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/simple/sparc.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/simple/sparc.c.o.d"
+  "/root/repo/Utilities/cmliblzma/liblzma/simple/x86.c" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/simple/x86.c.o" "gcc" "Utilities/cmliblzma/CMakeFiles/cmliblzma.dir/liblzma/simple/x86.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
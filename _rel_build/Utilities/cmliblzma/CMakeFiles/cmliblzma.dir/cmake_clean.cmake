@@ -0,0 +1,153 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmliblzma.dir/common/tuklib_cpucores.c.o"
+  "CMakeFiles/cmliblzma.dir/common/tuklib_cpucores.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/check/check.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/check/check.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/check/crc32_fast.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/check/crc32_fast.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/check/crc32_table.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/check/crc32_table.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/check/crc64_fast.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/check/crc64_fast.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/check/crc64_table.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/check/crc64_table.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/check/sha256.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/check/sha256.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/alone_decoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/alone_decoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/alone_encoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/alone_encoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/auto_decoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/auto_decoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/block_buffer_decoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/block_buffer_decoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/block_buffer_encoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/block_buffer_encoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/block_decoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/block_decoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/block_encoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/block_encoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/block_header_decoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/block_header_decoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/block_header_encoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/block_header_encoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/block_util.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/block_util.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/common.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/common.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/easy_buffer_encoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/easy_buffer_encoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/easy_decoder_memusage.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/easy_decoder_memusage.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/easy_encoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/easy_encoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/easy_encoder_memusage.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/easy_encoder_memusage.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/easy_preset.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/easy_preset.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/filter_buffer_decoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/filter_buffer_decoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/filter_buffer_encoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/filter_buffer_encoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/filter_common.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/filter_common.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/filter_decoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/filter_decoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/filter_encoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/filter_encoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/filter_flags_decoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/filter_flags_decoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/filter_flags_encoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/filter_flags_encoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/hardware_cputhreads.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/hardware_cputhreads.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/index.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/index.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/index_decoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/index_decoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/index_encoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/index_encoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/index_hash.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/index_hash.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/outqueue.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/outqueue.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/stream_buffer_decoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/stream_buffer_decoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/stream_buffer_encoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/stream_buffer_encoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/stream_decoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/stream_decoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/stream_encoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/stream_encoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/stream_encoder_mt.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/stream_encoder_mt.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/stream_flags_common.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/stream_flags_common.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/stream_flags_decoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/stream_flags_decoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/stream_flags_encoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/stream_flags_encoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/vli_decoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/vli_decoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/vli_encoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/vli_encoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/vli_size.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/common/vli_size.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/delta/delta_common.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/delta/delta_common.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/delta/delta_decoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/delta/delta_decoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/delta/delta_encoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/delta/delta_encoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/lz/lz_decoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/lz/lz_decoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/lz/lz_encoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/lz/lz_encoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/lz/lz_encoder_mf.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/lz/lz_encoder_mf.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/lzma/fastpos_table.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/lzma/fastpos_table.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma2_decoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma2_decoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma2_encoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma2_encoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma_decoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma_decoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma_encoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma_encoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma_encoder_optimum_fast.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma_encoder_optimum_fast.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma_encoder_optimum_normal.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma_encoder_optimum_normal.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma_encoder_presets.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/lzma/lzma_encoder_presets.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/rangecoder/price_table.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/rangecoder/price_table.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/simple/arm.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/simple/arm.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/simple/arm64.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/simple/arm64.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/simple/armthumb.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/simple/armthumb.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/simple/ia64.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/simple/ia64.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/simple/powerpc.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/simple/powerpc.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/simple/simple_coder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/simple/simple_coder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/simple/simple_decoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/simple/simple_decoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/simple/simple_encoder.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/simple/simple_encoder.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/simple/sparc.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/simple/sparc.c.o.d"
+  "CMakeFiles/cmliblzma.dir/liblzma/simple/x86.c.o"
+  "CMakeFiles/cmliblzma.dir/liblzma/simple/x86.c.o.d"
+  "libcmliblzma.a"
+  "libcmliblzma.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cmliblzma.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
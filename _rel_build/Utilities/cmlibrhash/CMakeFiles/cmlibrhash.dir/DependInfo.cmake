@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Utilities/cmlibrhash/librhash/algorithms.c" "Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/librhash/algorithms.c.o" "gcc" "Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/librhash/algorithms.c.o.d"
+  "/root/repo/Utilities/cmlibrhash/librhash/byte_order.c" "Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/librhash/byte_order.c.o" "gcc" "Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/librhash/byte_order.c.o.d"
+  "/root/repo/Utilities/cmlibrhash/librhash/hex.c" "Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/librhash/hex.c.o" "gcc" "Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/librhash/hex.c.o.d"
+  "/root/repo/Utilities/cmlibrhash/librhash/md5.c" "Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/librhash/md5.c.o" "gcc" "Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/librhash/md5.c.o.d"
+  "/root/repo/Utilities/cmlibrhash/librhash/rhash.c" "Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/librhash/rhash.c.o" "gcc" "Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/librhash/rhash.c.o.d"
+  "/root/repo/Utilities/cmlibrhash/librhash/sha1.c" "Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/librhash/sha1.c.o" "gcc" "Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/librhash/sha1.c.o.d"
+  "/root/repo/Utilities/cmlibrhash/librhash/sha256.c" "Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/librhash/sha256.c.o" "gcc" "Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/librhash/sha256.c.o.d"
+  "/root/repo/Utilities/cmlibrhash/librhash/sha3.c" "Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/librhash/sha3.c.o" "gcc" "Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/librhash/sha3.c.o.d"
+  "/root/repo/Utilities/cmlibrhash/librhash/sha512.c" "Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/librhash/sha512.c.o" "gcc" "Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/librhash/sha512.c.o.d"
+  "/root/repo/Utilities/cmlibrhash/librhash/util.c" "Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/librhash/util.c.o" "gcc" "Utilities/cmlibrhash/CMakeFiles/cmlibrhash.dir/librhash/util.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmlibrhash.dir/librhash/algorithms.c.o"
+  "CMakeFiles/cmlibrhash.dir/librhash/algorithms.c.o.d"
+  "CMakeFiles/cmlibrhash.dir/librhash/byte_order.c.o"
+  "CMakeFiles/cmlibrhash.dir/librhash/byte_order.c.o.d"
+  "CMakeFiles/cmlibrhash.dir/librhash/hex.c.o"
+  "CMakeFiles/cmlibrhash.dir/librhash/hex.c.o.d"
+  "CMakeFiles/cmlibrhash.dir/librhash/md5.c.o"
+  "CMakeFiles/cmlibrhash.dir/librhash/md5.c.o.d"
+  "CMakeFiles/cmlibrhash.dir/librhash/rhash.c.o"
+  "CMakeFiles/cmlibrhash.dir/librhash/rhash.c.o.d"
+  "CMakeFiles/cmlibrhash.dir/librhash/sha1.c.o"
+  "CMakeFiles/cmlibrhash.dir/librhash/sha1.c.o.d"
+  "CMakeFiles/cmlibrhash.dir/librhash/sha256.c.o"
+  "CMakeFiles/cmlibrhash.dir/librhash/sha256.c.o.d"
+  "CMakeFiles/cmlibrhash.dir/librhash/sha3.c.o"
+  "CMakeFiles/cmlibrhash.dir/librhash/sha3.c.o.d"
+  "CMakeFiles/cmlibrhash.dir/librhash/sha512.c.o"
+  "CMakeFiles/cmlibrhash.dir/librhash/sha512.c.o.d"
+  "CMakeFiles/cmlibrhash.dir/librhash/util.c.o"
+  "CMakeFiles/cmlibrhash.dir/librhash/util.c.o.d"
+  "libcmlibrhash.a"
+  "libcmlibrhash.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cmlibrhash.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
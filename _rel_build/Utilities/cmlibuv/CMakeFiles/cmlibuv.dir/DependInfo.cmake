@@ -0,0 +1,50 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Utilities/cmlibuv/src/fs-poll.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/fs-poll.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/fs-poll.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/idna.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/idna.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/idna.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/inet.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/inet.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/inet.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/strscpy.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/strscpy.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/strscpy.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/strtok.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/strtok.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/strtok.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/threadpool.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/threadpool.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/threadpool.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/timer.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/timer.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/timer.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/async.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/async.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/async.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/core.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/core.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/core.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/dl.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/dl.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/dl.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/fs.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/fs.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/fs.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/getaddrinfo.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/getaddrinfo.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/getaddrinfo.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/getnameinfo.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/getnameinfo.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/getnameinfo.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/linux.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/linux.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/linux.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/loop-watcher.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/loop-watcher.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/loop-watcher.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/loop.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/loop.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/loop.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/pipe.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/pipe.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/pipe.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/poll.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/poll.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/poll.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/process.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/process.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/process.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/procfs-exepath.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/procfs-exepath.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/procfs-exepath.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/proctitle.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/proctitle.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/proctitle.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/signal.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/signal.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/signal.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/stream.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/stream.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/stream.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/sysinfo-loadavg.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/sysinfo-loadavg.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/sysinfo-loadavg.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/sysinfo-memory.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/sysinfo-memory.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/sysinfo-memory.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/tcp.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/tcp.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/tcp.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/thread.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/thread.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/thread.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/tty.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/tty.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/tty.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/unix/udp.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/udp.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/unix/udp.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/uv-common.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/uv-common.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/uv-common.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/uv-data-getter-setters.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/uv-data-getter-setters.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/uv-data-getter-setters.c.o.d"
+  "/root/repo/Utilities/cmlibuv/src/version.c" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/version.c.o" "gcc" "Utilities/cmlibuv/CMakeFiles/cmlibuv.dir/src/version.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
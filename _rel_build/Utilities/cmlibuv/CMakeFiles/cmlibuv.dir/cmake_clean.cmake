@@ -0,0 +1,73 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmlibuv.dir/src/fs-poll.c.o"
+  "CMakeFiles/cmlibuv.dir/src/fs-poll.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/idna.c.o"
+  "CMakeFiles/cmlibuv.dir/src/idna.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/inet.c.o"
+  "CMakeFiles/cmlibuv.dir/src/inet.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/strscpy.c.o"
+  "CMakeFiles/cmlibuv.dir/src/strscpy.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/strtok.c.o"
+  "CMakeFiles/cmlibuv.dir/src/strtok.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/threadpool.c.o"
+  "CMakeFiles/cmlibuv.dir/src/threadpool.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/timer.c.o"
+  "CMakeFiles/cmlibuv.dir/src/timer.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/async.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/async.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/core.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/core.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/dl.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/dl.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/fs.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/fs.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/getaddrinfo.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/getaddrinfo.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/getnameinfo.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/getnameinfo.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/linux.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/linux.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/loop-watcher.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/loop-watcher.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/loop.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/loop.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/pipe.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/pipe.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/poll.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/poll.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/process.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/process.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/procfs-exepath.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/procfs-exepath.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/proctitle.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/proctitle.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/signal.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/signal.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/stream.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/stream.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/sysinfo-loadavg.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/sysinfo-loadavg.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/sysinfo-memory.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/sysinfo-memory.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/tcp.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/tcp.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/thread.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/thread.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/tty.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/tty.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/unix/udp.c.o"
+  "CMakeFiles/cmlibuv.dir/src/unix/udp.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/uv-common.c.o"
+  "CMakeFiles/cmlibuv.dir/src/uv-common.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/uv-data-getter-setters.c.o"
+  "CMakeFiles/cmlibuv.dir/src/uv-data-getter-setters.c.o.d"
+  "CMakeFiles/cmlibuv.dir/src/version.c.o"
+  "CMakeFiles/cmlibuv.dir/src/version.c.o.d"
+  "libcmlibuv.a"
+  "libcmlibuv.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cmlibuv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Utilities/cmllpkgc/llpkgc_dep.c" "Utilities/cmllpkgc/CMakeFiles/cmllpkgc.dir/llpkgc_dep.c.o" "gcc" "Utilities/cmllpkgc/CMakeFiles/cmllpkgc.dir/llpkgc_dep.c.o.d"
+  "/root/repo/Utilities/cmllpkgc/llpkgc_dep__internal.c" "Utilities/cmllpkgc/CMakeFiles/cmllpkgc.dir/llpkgc_dep__internal.c.o" "gcc" "Utilities/cmllpkgc/CMakeFiles/cmllpkgc.dir/llpkgc_dep__internal.c.o.d"
+  "/root/repo/Utilities/cmllpkgc/llpkgc_file.c" "Utilities/cmllpkgc/CMakeFiles/cmllpkgc.dir/llpkgc_file.c.o" "gcc" "Utilities/cmllpkgc/CMakeFiles/cmllpkgc.dir/llpkgc_file.c.o.d"
+  "/root/repo/Utilities/cmllpkgc/llpkgc_file__internal.c" "Utilities/cmllpkgc/CMakeFiles/cmllpkgc.dir/llpkgc_file__internal.c.o" "gcc" "Utilities/cmllpkgc/CMakeFiles/cmllpkgc.dir/llpkgc_file__internal.c.o.d"
+  "/root/repo/Utilities/cmllpkgc/llpkgc_frag.c" "Utilities/cmllpkgc/CMakeFiles/cmllpkgc.dir/llpkgc_frag.c.o" "gcc" "Utilities/cmllpkgc/CMakeFiles/cmllpkgc.dir/llpkgc_frag.c.o.d"
+  "/root/repo/Utilities/cmllpkgc/llpkgc_frag__internal.c" "Utilities/cmllpkgc/CMakeFiles/cmllpkgc.dir/llpkgc_frag__internal.c.o" "gcc" "Utilities/cmllpkgc/CMakeFiles/cmllpkgc.dir/llpkgc_frag__internal.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmllpkgc.dir/llpkgc_dep.c.o"
+  "CMakeFiles/cmllpkgc.dir/llpkgc_dep.c.o.d"
+  "CMakeFiles/cmllpkgc.dir/llpkgc_dep__internal.c.o"
+  "CMakeFiles/cmllpkgc.dir/llpkgc_dep__internal.c.o.d"
+  "CMakeFiles/cmllpkgc.dir/llpkgc_file.c.o"
+  "CMakeFiles/cmllpkgc.dir/llpkgc_file.c.o.d"
+  "CMakeFiles/cmllpkgc.dir/llpkgc_file__internal.c.o"
+  "CMakeFiles/cmllpkgc.dir/llpkgc_file__internal.c.o.d"
+  "CMakeFiles/cmllpkgc.dir/llpkgc_frag.c.o"
+  "CMakeFiles/cmllpkgc.dir/llpkgc_frag.c.o.d"
+  "CMakeFiles/cmllpkgc.dir/llpkgc_frag__internal.c.o"
+  "CMakeFiles/cmllpkgc.dir/llpkgc_frag__internal.c.o.d"
+  "libcmllpkgc.a"
+  "libcmllpkgc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cmllpkgc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
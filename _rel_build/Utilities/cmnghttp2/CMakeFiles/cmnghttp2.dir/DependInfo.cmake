@@ -0,0 +1,44 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_alpn.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_alpn.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_alpn.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_buf.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_buf.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_buf.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_callbacks.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_callbacks.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_callbacks.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_debug.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_debug.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_debug.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_extpri.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_extpri.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_extpri.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_frame.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_frame.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_frame.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_hd.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_hd.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_hd.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_hd_huffman.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_hd_huffman.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_hd_huffman.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_hd_huffman_data.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_hd_huffman_data.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_hd_huffman_data.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_helper.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_helper.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_helper.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_http.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_http.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_http.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_map.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_map.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_map.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_mem.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_mem.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_mem.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_option.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_option.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_option.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_outbound_item.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_outbound_item.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_outbound_item.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_pq.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_pq.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_pq.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_priority_spec.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_priority_spec.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_priority_spec.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_queue.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_queue.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_queue.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_ratelim.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_ratelim.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_ratelim.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_rcbuf.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_rcbuf.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_rcbuf.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_session.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_session.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_session.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_stream.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_stream.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_stream.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_submit.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_submit.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_submit.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_time.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_time.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_time.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/nghttp2_version.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_version.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/nghttp2_version.c.o.d"
+  "/root/repo/Utilities/cmnghttp2/lib/sfparse.c" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/sfparse.c.o" "gcc" "Utilities/cmnghttp2/CMakeFiles/cmnghttp2.dir/lib/sfparse.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,61 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_alpn.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_alpn.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_buf.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_buf.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_callbacks.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_callbacks.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_debug.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_debug.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_extpri.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_extpri.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_frame.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_frame.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_hd.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_hd.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_hd_huffman.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_hd_huffman.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_hd_huffman_data.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_hd_huffman_data.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_helper.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_helper.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_http.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_http.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_map.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_map.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_mem.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_mem.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_option.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_option.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_outbound_item.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_outbound_item.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_pq.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_pq.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_priority_spec.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_priority_spec.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_queue.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_queue.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_ratelim.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_ratelim.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_rcbuf.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_rcbuf.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_session.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_session.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_stream.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_stream.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_submit.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_submit.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_time.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_time.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_version.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/nghttp2_version.c.o.d"
+  "CMakeFiles/cmnghttp2.dir/lib/sfparse.c.o"
+  "CMakeFiles/cmnghttp2.dir/lib/sfparse.c.o.d"
+  "libcmnghttp2.a"
+  "libcmnghttp2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cmnghttp2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Utilities/cmzlib/adler32.c" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/adler32.c.o" "gcc" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/adler32.c.o.d"
+  "/root/repo/Utilities/cmzlib/compress.c" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/compress.c.o" "gcc" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/compress.c.o.d"
+  "/root/repo/Utilities/cmzlib/crc32.c" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/crc32.c.o" "gcc" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/crc32.c.o.d"
+  "/root/repo/Utilities/cmzlib/deflate.c" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/deflate.c.o" "gcc" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/deflate.c.o.d"
+  "/root/repo/Utilities/cmzlib/gzclose.c" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/gzclose.c.o" "gcc" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/gzclose.c.o.d"
+  "/root/repo/Utilities/cmzlib/gzlib.c" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/gzlib.c.o" "gcc" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/gzlib.c.o.d"
+  "/root/repo/Utilities/cmzlib/gzread.c" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/gzread.c.o" "gcc" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/gzread.c.o.d"
+  "/root/repo/Utilities/cmzlib/gzwrite.c" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/gzwrite.c.o" "gcc" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/gzwrite.c.o.d"
+  "/root/repo/Utilities/cmzlib/inffast.c" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/inffast.c.o" "gcc" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/inffast.c.o.d"
+  "/root/repo/Utilities/cmzlib/inflate.c" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/inflate.c.o" "gcc" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/inflate.c.o.d"
+  "/root/repo/Utilities/cmzlib/inftrees.c" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/inftrees.c.o" "gcc" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/inftrees.c.o.d"
+  "/root/repo/Utilities/cmzlib/trees.c" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/trees.c.o" "gcc" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/trees.c.o.d"
+  "/root/repo/Utilities/cmzlib/uncompr.c" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/uncompr.c.o" "gcc" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/uncompr.c.o.d"
+  "/root/repo/Utilities/cmzlib/zutil.c" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/zutil.c.o" "gcc" "Utilities/cmzlib/CMakeFiles/cmzlib.dir/zutil.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
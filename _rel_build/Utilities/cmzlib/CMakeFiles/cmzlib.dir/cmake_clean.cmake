@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmzlib.dir/adler32.c.o"
+  "CMakeFiles/cmzlib.dir/adler32.c.o.d"
+  "CMakeFiles/cmzlib.dir/compress.c.o"
+  "CMakeFiles/cmzlib.dir/compress.c.o.d"
+  "CMakeFiles/cmzlib.dir/crc32.c.o"
+  "CMakeFiles/cmzlib.dir/crc32.c.o.d"
+  "CMakeFiles/cmzlib.dir/deflate.c.o"
+  "CMakeFiles/cmzlib.dir/deflate.c.o.d"
+  "CMakeFiles/cmzlib.dir/gzclose.c.o"
+  "CMakeFiles/cmzlib.dir/gzclose.c.o.d"
+  "CMakeFiles/cmzlib.dir/gzlib.c.o"
+  "CMakeFiles/cmzlib.dir/gzlib.c.o.d"
+  "CMakeFiles/cmzlib.dir/gzread.c.o"
+  "CMakeFiles/cmzlib.dir/gzread.c.o.d"
+  "CMakeFiles/cmzlib.dir/gzwrite.c.o"
+  "CMakeFiles/cmzlib.dir/gzwrite.c.o.d"
+  "CMakeFiles/cmzlib.dir/inffast.c.o"
+  "CMakeFiles/cmzlib.dir/inffast.c.o.d"
+  "CMakeFiles/cmzlib.dir/inflate.c.o"
+  "CMakeFiles/cmzlib.dir/inflate.c.o.d"
+  "CMakeFiles/cmzlib.dir/inftrees.c.o"
+  "CMakeFiles/cmzlib.dir/inftrees.c.o.d"
+  "CMakeFiles/cmzlib.dir/trees.c.o"
+  "CMakeFiles/cmzlib.dir/trees.c.o.d"
+  "CMakeFiles/cmzlib.dir/uncompr.c.o"
+  "CMakeFiles/cmzlib.dir/uncompr.c.o.d"
+  "CMakeFiles/cmzlib.dir/zutil.c.o"
+  "CMakeFiles/cmzlib.dir/zutil.c.o.d"
+  "libcmzlib.a"
+  "libcmzlib.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cmzlib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
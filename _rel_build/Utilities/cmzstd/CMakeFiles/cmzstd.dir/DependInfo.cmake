@@ -0,0 +1,50 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Utilities/cmzstd/lib/common/entropy_common.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/common/entropy_common.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/common/entropy_common.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/common/error_private.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/common/error_private.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/common/error_private.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/common/fse_decompress.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/common/fse_decompress.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/common/fse_decompress.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/common/pool.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/common/pool.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/common/pool.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/common/threading.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/common/threading.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/common/threading.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/common/xxhash.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/common/xxhash.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/common/xxhash.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/common/zstd_common.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/common/zstd_common.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/common/zstd_common.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/compress/fse_compress.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/fse_compress.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/fse_compress.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/compress/hist.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/hist.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/hist.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/compress/huf_compress.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/huf_compress.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/huf_compress.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/compress/zstd_compress.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstd_compress.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstd_compress.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/compress/zstd_compress_literals.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstd_compress_literals.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstd_compress_literals.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/compress/zstd_compress_sequences.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstd_compress_sequences.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstd_compress_sequences.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/compress/zstd_compress_superblock.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstd_compress_superblock.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstd_compress_superblock.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/compress/zstd_double_fast.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstd_double_fast.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstd_double_fast.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/compress/zstd_fast.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstd_fast.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstd_fast.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/compress/zstd_lazy.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstd_lazy.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstd_lazy.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/compress/zstd_ldm.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstd_ldm.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstd_ldm.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/compress/zstd_opt.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstd_opt.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstd_opt.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/compress/zstd_preSplit.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstd_preSplit.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstd_preSplit.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/compress/zstdmt_compress.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstdmt_compress.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/compress/zstdmt_compress.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/decompress/huf_decompress.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/decompress/huf_decompress.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/decompress/huf_decompress.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/decompress/zstd_ddict.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/decompress/zstd_ddict.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/decompress/zstd_ddict.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/decompress/zstd_decompress.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/decompress/zstd_decompress.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/decompress/zstd_decompress.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/decompress/zstd_decompress_block.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/decompress/zstd_decompress_block.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/decompress/zstd_decompress_block.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/deprecated/zbuff_common.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/deprecated/zbuff_common.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/deprecated/zbuff_common.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/deprecated/zbuff_compress.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/deprecated/zbuff_compress.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/deprecated/zbuff_compress.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/deprecated/zbuff_decompress.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/deprecated/zbuff_decompress.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/deprecated/zbuff_decompress.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/dictBuilder/cover.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/dictBuilder/cover.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/dictBuilder/cover.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/dictBuilder/divsufsort.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/dictBuilder/divsufsort.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/dictBuilder/divsufsort.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/dictBuilder/fastcover.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/dictBuilder/fastcover.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/dictBuilder/fastcover.c.o.d"
+  "/root/repo/Utilities/cmzstd/lib/dictBuilder/zdict.c" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/dictBuilder/zdict.c.o" "gcc" "Utilities/cmzstd/CMakeFiles/cmzstd.dir/lib/dictBuilder/zdict.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,73 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmzstd.dir/lib/common/entropy_common.c.o"
+  "CMakeFiles/cmzstd.dir/lib/common/entropy_common.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/common/error_private.c.o"
+  "CMakeFiles/cmzstd.dir/lib/common/error_private.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/common/fse_decompress.c.o"
+  "CMakeFiles/cmzstd.dir/lib/common/fse_decompress.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/common/pool.c.o"
+  "CMakeFiles/cmzstd.dir/lib/common/pool.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/common/threading.c.o"
+  "CMakeFiles/cmzstd.dir/lib/common/threading.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/common/xxhash.c.o"
+  "CMakeFiles/cmzstd.dir/lib/common/xxhash.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/common/zstd_common.c.o"
+  "CMakeFiles/cmzstd.dir/lib/common/zstd_common.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/compress/fse_compress.c.o"
+  "CMakeFiles/cmzstd.dir/lib/compress/fse_compress.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/compress/hist.c.o"
+  "CMakeFiles/cmzstd.dir/lib/compress/hist.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/compress/huf_compress.c.o"
+  "CMakeFiles/cmzstd.dir/lib/compress/huf_compress.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstd_compress.c.o"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstd_compress.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstd_compress_literals.c.o"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstd_compress_literals.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstd_compress_sequences.c.o"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstd_compress_sequences.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstd_compress_superblock.c.o"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstd_compress_superblock.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstd_double_fast.c.o"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstd_double_fast.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstd_fast.c.o"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstd_fast.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstd_lazy.c.o"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstd_lazy.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstd_ldm.c.o"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstd_ldm.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstd_opt.c.o"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstd_opt.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstd_preSplit.c.o"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstd_preSplit.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstdmt_compress.c.o"
+  "CMakeFiles/cmzstd.dir/lib/compress/zstdmt_compress.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/decompress/huf_decompress.c.o"
+  "CMakeFiles/cmzstd.dir/lib/decompress/huf_decompress.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/decompress/zstd_ddict.c.o"
+  "CMakeFiles/cmzstd.dir/lib/decompress/zstd_ddict.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/decompress/zstd_decompress.c.o"
+  "CMakeFiles/cmzstd.dir/lib/decompress/zstd_decompress.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/decompress/zstd_decompress_block.c.o"
+  "CMakeFiles/cmzstd.dir/lib/decompress/zstd_decompress_block.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/deprecated/zbuff_common.c.o"
+  "CMakeFiles/cmzstd.dir/lib/deprecated/zbuff_common.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/deprecated/zbuff_compress.c.o"
+  "CMakeFiles/cmzstd.dir/lib/deprecated/zbuff_compress.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/deprecated/zbuff_decompress.c.o"
+  "CMakeFiles/cmzstd.dir/lib/deprecated/zbuff_decompress.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/dictBuilder/cover.c.o"
+  "CMakeFiles/cmzstd.dir/lib/dictBuilder/cover.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/dictBuilder/divsufsort.c.o"
+  "CMakeFiles/cmzstd.dir/lib/dictBuilder/divsufsort.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/dictBuilder/fastcover.c.o"
+  "CMakeFiles/cmzstd.dir/lib/dictBuilder/fastcover.c.o.d"
+  "CMakeFiles/cmzstd.dir/lib/dictBuilder/zdict.c.o"
+  "CMakeFiles/cmzstd.dir/lib/dictBuilder/zdict.c.o.d"
+  "libcmzstd.a"
+  "libcmzstd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cmzstd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Utilities/std/cm/bits/fs_path.cxx" "Utilities/std/CMakeFiles/cmstd.dir/cm/bits/fs_path.cxx.o" "gcc" "Utilities/std/CMakeFiles/cmstd.dir/cm/bits/fs_path.cxx.o.d"
+  "/root/repo/Utilities/std/cm/bits/string_view.cxx" "Utilities/std/CMakeFiles/cmstd.dir/cm/bits/string_view.cxx.o" "gcc" "Utilities/std/CMakeFiles/cmstd.dir/cm/bits/string_view.cxx.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmstd.dir/cm/bits/fs_path.cxx.o"
+  "CMakeFiles/cmstd.dir/cm/bits/fs_path.cxx.o.d"
+  "CMakeFiles/cmstd.dir/cm/bits/string_view.cxx.o"
+  "CMakeFiles/cmstd.dir/cm/bits/string_view.cxx.o.d"
+  "libcmstd.a"
+  "libcmstd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmstd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()